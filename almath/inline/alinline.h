@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALINLINE_H_
+#define _LIBALMATH_ALMATH_INLINE_ALINLINE_H_
+
+/// <summary>
+/// Header-inline mode for the small operations of the basic types.
+///
+/// By default the operators of Position2D, Position3D, Pose2D, Velocity6D
+/// and the Transform/Position3D product are called through the shared
+/// library. When ALMATH_INLINE_OPERATORS is defined (see the CMake option of
+/// the same name), the headers of the almath/inline directory provide their
+/// definitions as inline functions, so that the compiler can inline them
+/// into the calling loops.
+///
+/// The library always exports the out of line symbols, built from the very
+/// same definitions: the ABI of the library does not depend on the option.
+/// All the other translation units of a program must use the same mode: a
+/// function which is inline in some of them only is ill-formed, with no
+/// diagnostic required. Define ALMATH_INLINE_OPERATORS for the whole target,
+/// never in a source file.
+/// </summary>
+
+#if defined(ALMATH_INLINE_OPERATORS) && !defined(ALMATH_BUILDING_OUT_OF_LINE)
+# define ALMATH_INLINE_HEADERS
+# define ALMATH_INLINE_FN inline
+#else
+// library translation units which export the symbols
+# define ALMATH_INLINE_FN
+#endif
+
+#endif  // _LIBALMATH_ALMATH_INLINE_ALINLINE_H_
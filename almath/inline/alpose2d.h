@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the small Pose2D operations.
+// Included by almath/types/alpose2d.h in header-inline mode, and by
+// src/types/alpose2d.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALPOSE2D_H_
+#define _LIBALMATH_ALMATH_INLINE_ALPOSE2D_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/types/alpose2d.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Pose2D::Pose2D():x(0.0f), y(0.0f), theta(0.0f) {}
+
+    ALMATH_INLINE_FN Pose2D::Pose2D(float pInit)
+      :x(pInit), y(pInit), theta(pInit) {}
+
+    ALMATH_INLINE_FN Pose2D::Pose2D(
+      float pX,
+      float pY,
+      float pTheta)
+      :x(pX)
+      ,y(pY)
+      ,theta(pTheta) {}
+
+    ALMATH_INLINE_FN Pose2D& Pose2D::operator*= (const Pose2D& pPos2)
+    {
+      const float x0 = pPos2.x;
+      const float y0 = pPos2.y;
+      const float cs = std::cos(theta);
+      const float sn = std::sin(theta);
+
+      x += cs*x0 - sn*y0;
+      y += sn*x0 + cs*y0;
+      theta += pPos2.theta;
+
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Pose2D& Pose2D::operator+= (const Pose2D& pPos2)
+    {
+      x     += pPos2.x;
+      y     += pPos2.y;
+      theta += pPos2.theta;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Pose2D& Pose2D::operator-= (const Pose2D& pPos2)
+    {
+      x     -= pPos2.x;
+      y     -= pPos2.y;
+      theta -= pPos2.theta;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Pose2D& Pose2D::operator*= (const float pVal)
+    {
+      x     *= pVal;
+      y     *= pVal;
+      theta *= pVal;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN bool Pose2D::operator==(const Pose2D& pPos2) const
+    {
+      return (x == pPos2.x &&
+              y == pPos2.y &&
+              theta == pPos2.theta);
+    }
+
+    ALMATH_INLINE_FN bool Pose2D::operator!=(const Pose2D& pPos2) const
+    {
+      return ! (*this==pPos2);
+    }
+
+    ALMATH_INLINE_FN float Pose2D::distanceSquared(const Pose2D& pPos) const
+    {
+      return Math::distanceSquared(*this, pPos);
+    }
+
+    ALMATH_INLINE_FN float Pose2D::distance(const Pose2D& pPos2) const
+    {
+      return Math::distance(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float distanceSquared(
+      const Pose2D& pPos1,
+      const Pose2D& pPos2)
+    {
+      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+(pPos1.y-pPos2.y)*(pPos1.y-pPos2.y);
+    }
+
+    ALMATH_INLINE_FN float distance(
+      const Pose2D& pPos1,
+      const Pose2D& pPos2)
+    {
+      return std::sqrt(distanceSquared(pPos1, pPos2));
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALPOSE2D_H_
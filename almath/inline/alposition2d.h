@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the small Position2D operations.
+// Included by almath/types/alposition2d.h in header-inline mode, and by
+// src/types/alposition2d.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALPOSITION2D_H_
+#define _LIBALMATH_ALMATH_INLINE_ALPOSITION2D_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/types/alposition2d.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Position2D::Position2D(): x(0.0f), y(0.0f) {}
+
+    ALMATH_INLINE_FN Position2D::Position2D(float pInit): x(pInit), y(pInit) {}
+
+    ALMATH_INLINE_FN Position2D::Position2D(float pX, float pY): x(pX), y(pY) {}
+
+    ALMATH_INLINE_FN Position2D& Position2D::operator+= (
+      const Position2D& pPos2)
+    {
+      x += pPos2.x;
+      y += pPos2.y;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Position2D& Position2D::operator-= (
+      const Position2D& pPos2)
+    {
+      x -= pPos2.x;
+      y -= pPos2.y;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN bool Position2D::operator==(
+      const Position2D& pPos2) const
+    {
+      return (x == pPos2.x &&
+              y == pPos2.y);
+    }
+
+    ALMATH_INLINE_FN bool Position2D::operator!=(
+      const Position2D& pPos2) const
+    {
+      return !(*this==pPos2);
+    }
+
+    ALMATH_INLINE_FN Position2D operator* (
+      const float       pVal,
+      const Position2D& pPos1)
+    {
+      return pPos1*pVal;
+    }
+
+    ALMATH_INLINE_FN Position2D& Position2D::operator*= (float pVal)
+    {
+      x *= pVal;
+      y *= pVal;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN float Position2D::distanceSquared(
+      const Position2D& pPos2) const
+    {
+      return Math::distanceSquared(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position2D::distance(const Position2D& pPos2) const
+    {
+      return Math::distance(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position2D::norm() const
+    {
+      return Math::norm(*this);
+    }
+
+    ALMATH_INLINE_FN float Position2D::dotProduct(
+      const Position2D& pPos2) const
+    {
+      return Math::dotProduct(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position2D::crossProduct(
+      const Position2D& pPos2) const
+    {
+      return Math::crossProduct(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float distanceSquared(
+      const Position2D& pPos1,
+      const Position2D& pPos2)
+    {
+      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+(pPos1.y-pPos2.y)*(pPos1.y-pPos2.y);
+    }
+
+    ALMATH_INLINE_FN float distance(
+      const Position2D& pPos1,
+      const Position2D& pPos2)
+    {
+      return std::sqrt(distanceSquared(pPos1, pPos2));
+    }
+
+    ALMATH_INLINE_FN float norm(const Position2D& p)
+    {
+      return std::sqrt( (p.x*p.x) + (p.y*p.y) );
+    }
+
+    ALMATH_INLINE_FN float dotProduct(
+      const Position2D& pPos1,
+      const Position2D& pPos2)
+    {
+      return (pPos1.x * pPos2.x + pPos1.y * pPos2.y);
+    }
+
+    ALMATH_INLINE_FN float crossProduct(
+      const Position2D& pPos1,
+      const Position2D& pPos2)
+    {
+      return (pPos1.x*pPos2.y - pPos1.y*pPos2.x);
+    }
+
+    ALMATH_INLINE_FN void crossProduct(
+      const Position2D& pPos1,
+      const Position2D& pPos2,
+      float&            result)
+    {
+      result = (pPos1.x*pPos2.y - pPos1.y*pPos2.x);
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALPOSITION2D_H_
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the small Position3D operations.
+// Included by almath/types/alposition3d.h in header-inline mode, and by
+// src/types/alposition3d.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALPOSITION3D_H_
+#define _LIBALMATH_ALMATH_INLINE_ALPOSITION3D_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/types/alposition3d.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Position3D::Position3D() : x(0.0f), y(0.0f), z(0.0f) {}
+
+    ALMATH_INLINE_FN Position3D::Position3D(float pInit)
+      : x(pInit), y(pInit), z(pInit) {}
+
+    ALMATH_INLINE_FN Position3D::Position3D(
+      float pX,
+      float pY,
+      float pZ):
+      x(pX), y(pY), z(pZ) {}
+
+    ALMATH_INLINE_FN Position3D& Position3D::operator+= (
+      const Position3D& pPos2)
+    {
+      x += pPos2.x;
+      y += pPos2.y;
+      z += pPos2.z;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Position3D& Position3D::operator-= (
+      const Position3D& pPos2)
+    {
+      x -= pPos2.x;
+      y -= pPos2.y;
+      z -= pPos2.z;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN Position3D Position3D::operator* (float pVal) const
+    {
+      return Position3D(x*pVal, y*pVal, z*pVal);
+    }
+
+    ALMATH_INLINE_FN Position3D& Position3D::operator*= (float pVal)
+    {
+      x *= pVal;
+      y *= pVal;
+      z *= pVal;
+      return *this;
+    }
+
+    ALMATH_INLINE_FN bool Position3D::operator== (
+      const Position3D& pPos2) const
+    {
+      return (x == pPos2.x &&
+              y == pPos2.y &&
+              z == pPos2.z);
+    }
+
+    ALMATH_INLINE_FN bool Position3D::operator!= (
+      const Position3D& pPos2) const
+    {
+      return !(*this==pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position3D::distanceSquared(
+      const Position3D& pPos2) const
+    {
+      return Math::distanceSquared(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position3D::distance(const Position3D& pPos2) const
+    {
+      return Math::distance(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float Position3D::norm() const
+    {
+      return Math::norm(*this);
+    }
+
+    ALMATH_INLINE_FN float Position3D::dotProduct(
+      const Position3D& pPos2) const
+    {
+      return Math::dotProduct(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN Position3D Position3D::crossProduct(
+      const Position3D& pPos2) const
+    {
+      return Math::crossProduct(*this, pPos2);
+    }
+
+    ALMATH_INLINE_FN float distanceSquared(
+      const Position3D& pPos1,
+      const Position3D& pPos2)
+    {
+      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+
+          (pPos1.y-pPos2.y)*(pPos1.y-pPos2.y)+
+          (pPos1.z-pPos2.z)*(pPos1.z-pPos2.z);
+    }
+
+    ALMATH_INLINE_FN float distance(
+      const Position3D& pPos1,
+      const Position3D& pPos2)
+    {
+      return std::sqrt(distanceSquared(pPos1, pPos2));
+    }
+
+    ALMATH_INLINE_FN float norm(const Position3D& p)
+    {
+      return std::sqrt( (p.x*p.x) + (p.y*p.y) + (p.z*p.z) );
+    }
+
+    ALMATH_INLINE_FN float dotProduct(
+      const Position3D& pPos1,
+      const Position3D& pPos2)
+    {
+      return (pPos1.x * pPos2.x + pPos1.y * pPos2.y + pPos1.z * pPos2.z);
+    }
+
+    ALMATH_INLINE_FN void crossProduct(
+      const Position3D& pPos1,
+      const Position3D& pPos2,
+      Position3D&       pRes)
+    {
+      pRes.x = pPos1.y*pPos2.z - pPos1.z*pPos2.y;
+      pRes.y = pPos1.z*pPos2.x - pPos1.x*pPos2.z;
+      pRes.z = pPos1.x*pPos2.y - pPos1.y*pPos2.x;
+    }
+
+    ALMATH_INLINE_FN Position3D crossProduct(
+      const Position3D& pPos1,
+      const Position3D& pPos2)
+    {
+      Position3D res;
+      crossProduct(pPos1, pPos2, res);
+      return res;
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALPOSITION3D_H_
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the small Transform operations.
+// Included by almath/types/altransform.h in header-inline mode, and by
+// src/types/altransform.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+//
+// The products of Transforms are not part of this set: they go through the
+// SIMD kernels selected at run time (see almath/tools/alsimd.h).
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALTRANSFORM_H_
+#define _LIBALMATH_ALMATH_INLINE_ALTRANSFORM_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/types/altransform.h>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Transform::Transform():
+        r1_c1(1.0f), r1_c2(0.0f), r1_c3(0.0f), r1_c4(0.0f),
+        r2_c1(0.0f), r2_c2(1.0f), r2_c3(0.0f), r2_c4(0.0f),
+        r3_c1(0.0f), r3_c2(0.0f), r3_c3(1.0f), r3_c4(0.0f) {}
+
+    ALMATH_INLINE_FN Transform::Transform(
+      const float& pPosX,
+      const float& pPosY,
+      const float& pPosZ)
+    {
+      r1_c1 = 1.0f;
+      r1_c2 = 0.0f;
+      r1_c3 = 0.0f;
+
+      r2_c1 = 0.0f;
+      r2_c2 = 1.0f;
+      r2_c3 = 0.0f;
+
+      r3_c1 = 0.0f;
+      r3_c2 = 0.0f;
+      r3_c3 = 1.0f;
+
+      r1_c4 = pPosX;
+      r2_c4 = pPosY;
+      r3_c4 = pPosZ;
+    }
+
+    ALMATH_INLINE_FN bool Transform::operator==(const Transform& pT2) const
+    {
+      return (r1_c1 == pT2.r1_c1 &&
+              r1_c2 == pT2.r1_c2 &&
+              r1_c3 == pT2.r1_c3 &&
+              r1_c4 == pT2.r1_c4 &&
+              r2_c1 == pT2.r2_c1 &&
+              r2_c2 == pT2.r2_c2 &&
+              r2_c3 == pT2.r2_c3 &&
+              r2_c4 == pT2.r2_c4 &&
+              r3_c1 == pT2.r3_c1 &&
+              r3_c2 == pT2.r3_c2 &&
+              r3_c3 == pT2.r3_c3 &&
+              r3_c4 == pT2.r3_c4);
+    }
+
+    ALMATH_INLINE_FN bool Transform::operator!=(const Transform& pT2) const
+    {
+      return !(*this==pT2);
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALTRANSFORM_H_
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the products of a Transform and a position.
+// Included by almath/tools/altransformhelpers.h in header-inline mode, and
+// by src/tools/altransformhelpers.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALTRANSFORMHELPERS_H_
+#define _LIBALMATH_ALMATH_INLINE_ALTRANSFORMHELPERS_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/tools/altransformhelpers.h>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Position3D operator*(
+        const Transform& pT,
+        const Position2D&  pPos)
+    {
+      Position3D result;
+      result.x = (pT.r1_c1 * pPos.x) + (pT.r1_c2 * pPos.y) + pT.r1_c4;
+      result.y = (pT.r2_c1 * pPos.x) + (pT.r2_c2 * pPos.y) + pT.r2_c4;
+      result.z = (pT.r3_c1 * pPos.x) + (pT.r3_c2 * pPos.y) + pT.r3_c4;
+      return result;
+    }
+
+    ALMATH_INLINE_FN Position3D operator*(
+        const Transform& pT,
+        const Position3D&  pPos)
+    {
+      Position3D result;
+      result.x = (pT.r1_c1 * pPos.x) + (pT.r1_c2 * pPos.y) + (pT.r1_c3 * pPos.z) + pT.r1_c4;
+      result.y = (pT.r2_c1 * pPos.x) + (pT.r2_c2 * pPos.y) + (pT.r2_c3 * pPos.z) + pT.r2_c4;
+      result.z = (pT.r3_c1 * pPos.x) + (pT.r3_c2 * pPos.y) + (pT.r3_c3 * pPos.z) + pT.r3_c4;
+      return result;
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALTRANSFORMHELPERS_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Definitions of the small Velocity6D operations.
+// Included by almath/types/alvelocity6d.h in header-inline mode, and by
+// src/types/alvelocity6d.cpp to build the exported symbols.
+// See almath/inline/alinline.h.
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_INLINE_ALVELOCITY6D_H_
+#define _LIBALMATH_ALMATH_INLINE_ALVELOCITY6D_H_
+
+#include <almath/inline/alinline.h>
+#include <almath/types/alvelocity6d.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    ALMATH_INLINE_FN Velocity6D::Velocity6D():
+      xd(0.0f),
+      yd(0.0f),
+      zd(0.0f),
+      wxd(0.0f),
+      wyd(0.0f),
+      wzd(0.0f) {}
+
+    ALMATH_INLINE_FN Velocity6D::Velocity6D(float pInit):
+      xd(pInit),
+      yd(pInit),
+      zd(pInit),
+      wxd(pInit),
+      wyd(pInit),
+      wzd(pInit) {}
+
+    ALMATH_INLINE_FN Velocity6D::Velocity6D(
+        float pXd,
+        float pYd,
+        float pZd,
+        float pWxd,
+        float pWyd,
+        float pWzd):
+      xd(pXd),
+      yd(pYd),
+      zd(pZd),
+      wxd(pWxd),
+      wyd(pWyd),
+      wzd(pWzd) {}
+
+    ALMATH_INLINE_FN bool Velocity6D::operator== (
+      const Velocity6D& pVel2) const
+    {
+      return (xd == pVel2.xd &&
+              yd == pVel2.yd &&
+              zd == pVel2.zd &&
+              wxd == pVel2.wxd &&
+              wyd == pVel2.wyd &&
+              wzd == pVel2.wzd);
+    }
+
+    ALMATH_INLINE_FN bool Velocity6D::operator!= (
+      const Velocity6D& pVel2) const
+    {
+      return !(*this==pVel2);
+    }
+
+    ALMATH_INLINE_FN Velocity6D& Velocity6D::operator*= (const float pVal)
+    {
+      xd  *= pVal;
+      yd  *= pVal;
+      zd  *= pVal;
+      wxd *= pVal;
+      wyd *= pVal;
+      wzd *= pVal;
+
+      return *this;
+    }
+
+    ALMATH_INLINE_FN float Velocity6D::norm() const
+    {
+      return Math::norm(*this);
+    }
+
+    ALMATH_INLINE_FN Velocity6D operator* (
+        const float       pVal,
+        const Velocity6D& pVel)
+    {
+      return pVel * pVal;
+    }
+
+    ALMATH_INLINE_FN float norm(const Velocity6D& pVel)
+    {
+      // norm of a 6 component vector
+      return std::sqrt(pVel.xd*pVel.xd +
+                       pVel.yd*pVel.yd +
+                       pVel.zd*pVel.zd +
+                       pVel.wxd*pVel.wxd +
+                       pVel.wyd*pVel.wyd +
+                       pVel.wzd*pVel.wzd);
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_INLINE_ALVELOCITY6D_H_
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_SCENEGRAPH_INVERSEKINEMATICS_H_
+#define _LIBALMATH_ALMATH_SCENEGRAPH_INVERSEKINEMATICS_H_
+
+#include <almath/api.h>
+#include <almath/scenegraph/kinematicmodel.h>
+#include <cstddef>
+#include <vector>
+
+namespace AL {
+namespace Math {
+
+// An inverse kinematics solver for the links of a KinematicModel, by damped
+// least squares.
+//
+// At each iteration, the error is the logarithm e = log(pose^-1 * target),
+// the twist from the link to its target in the link frame, and the step of
+// the variables is
+//
+//   dq = J^T (J J^T + damping^2 I)^-1 e
+//
+// with J the Jacobian of the link in its frame. The rows of the orientation
+// are weighted by rotationWeight in e and J: 0 solves for the position only.
+// The variables are then clamped to their limits.
+//
+// The variables given to solve are its initial guess, for warm starts, and
+// get the solution. The single solves use a workspace allocated once by the
+// constructor: they do not allocate. The solver keeps a reference to the
+// model, which must outlive it.
+class ALMATH_API InverseKinematics {
+ public:
+  struct Options {
+    Options();
+    int maxIterations;
+    // the norm of the weighted error at which a solve has converged
+    float tolerance;
+    // The damping of the least squares: larger values give smaller, more
+    // stable steps near singular configurations. With 0, the step is that
+    // of Gauss-Newton, and the directions in which the link cannot move
+    // are left out.
+    float damping;
+    float rotationWeight;
+    // the largest change of a variable in one iteration
+    float maxStep;
+  };
+
+  struct Result {
+    bool converged;
+    int iterations;
+    // the norm of the weighted error of the solution
+    float error;
+  };
+
+  explicit InverseKinematics(const KinematicModel &model,
+                             const Options &options = Options());
+
+  const KinematicModel &model() const { return _model; }
+  const Options &options() const { return _options; }
+  void setOptions(const Options &options) { _options = options; }
+
+  // Move the link to the target pose, in the root link frame.
+  // q has model().variableCount() values: the initial guess, then the
+  // solution. Throw if the link is not a link of the model.
+  Result solve(const Transform &target, std::size_t link, float *q);
+  // the same, throw if q has not model().variableCount() values
+  Result solve(const Transform &target, std::size_t link,
+               std::vector<float> &q);
+
+  // Solve count targets of the link: q has count configurations of
+  // model().variableCount() values, one after the other, and results room
+  // for count Result. When maxThreads is not 1, the targets are split
+  // across at most maxThreads threads (0 means one thread per hardware
+  // thread), each with its own workspace.
+  void solve(const Transform *targets, std::size_t count, std::size_t link,
+             float *q, Result *results, unsigned int maxThreads = 1u) const;
+
+ private:
+  struct Workspace {
+    explicit Workspace(const KinematicModel &model);
+    std::vector<Transform> poses;
+    std::vector<std::size_t> path;
+    std::vector<float> jacobian;
+    std::vector<float> step;
+  };
+
+  Result solveWith(const Transform &target, std::size_t link, float *q,
+                   Workspace &workspace) const;
+
+  const KinematicModel &_model;
+  Options _options;
+  Workspace _workspace;
+};
+}
+}
+#endif  // _LIBALMATH_ALMATH_SCENEGRAPH_INVERSEKINEMATICS_H_
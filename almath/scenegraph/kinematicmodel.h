@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICMODEL_H_
+#define _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICMODEL_H_
+
+#include <almath/api.h>
+#include <almath/types/altransform.h>
+#include <almath/types/altransformbatch.h>
+#include <almath/types/alposition3d.h>
+#include <almath/scenegraph/urdf.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace AL {
+namespace Math {
+
+// The kinematic tree of a robot, compiled from an urdf::RobotTree for fast
+// forward kinematics.
+//
+// The links are stored in flat arrays, sorted so that each link comes after
+// its parent: link 0 is the root link, and the pose of every other link i is
+//
+//   pose[i] = pose[parent(i)] * jointOrigin(i) * motion(i, q)
+//
+// where motion is the motion of the joint whose child is link i, for the
+// joint configuration q. The poses are computed in a single pass over the
+// links, with dedicated kernels for the joints about the x, y and z axes.
+//
+// The joint configuration q is a vector of variables, one for each revolute,
+// continuous or prismatic joint, in the order of the depth first traversal
+// of urdf::RobotTree::traverse_joints. Mimic joints have no variable: they
+// follow the variable of the joint they mimic, with its multiplier and
+// offset. Fixed joints have no motion. Floating and planar joints are not
+// supported and throw.
+//
+// The model copies what it needs: it does not keep references to the
+// RobotTree, nor to its XML tree. Its const methods do not modify it: a
+// model may be shared by several threads.
+class ALMATH_API KinematicModel {
+ public:
+  enum JointType {
+    JOINT_FIXED = 0,
+    // revolute about the x, y or z axis of the joint frame
+    JOINT_RX,
+    JOINT_RY,
+    JOINT_RZ,
+    // revolute about another axis
+    JOINT_REVOLUTE,
+    JOINT_PRISMATIC
+  };
+
+  // The frame of the Jacobians. Their columns are velocities with the
+  // layout of Velocity6D: the linear velocity, then the angular velocity.
+  enum JacobianFrame {
+    // the spatial velocity of the link, in the root link frame: the
+    // velocity of the point of the link at the origin of the root link
+    JACOBIAN_WORLD = 0,
+    // the velocity of the link origin, in the link frame
+    JACOBIAN_LOCAL,
+    // the velocity of the link origin, in the root link frame
+    JACOBIAN_MIXED
+  };
+
+  explicit KinematicModel(const urdf::RobotTree &tree);
+
+  std::size_t linkCount() const { return _parents.size(); }
+  std::size_t variableCount() const { return _variableNames.size(); }
+
+  const std::string &linkName(std::size_t link) const;
+  // the index of the link, throw if there is no such link
+  std::size_t linkIndex(const std::string &name) const;
+
+  // the name of the joint whose child is the given link,
+  // empty for the root link
+  const std::string &jointName(std::size_t link) const;
+
+  const std::string &variableName(std::size_t variable) const;
+  // The limits of the variable, from the URDF limit of its joint: -inf and
+  // +inf for continuous joints and for joints without limit. The limits of
+  // the mimic joints restrict those of the variable they follow; throw if
+  // they leave it no value.
+  float variableLower(std::size_t variable) const {
+    return _variableLowers[variable];
+  }
+  float variableUpper(std::size_t variable) const {
+    return _variableUppers[variable];
+  }
+  // the index of the variable of the joint, throw if the joint has none
+  std::size_t variableIndex(const std::string &jointName) const;
+
+  // the parent of the link, -1 for the root link
+  int parent(std::size_t link) const { return _parents[link]; }
+  JointType jointType(std::size_t link) const { return _types[link]; }
+  // the pose of the joint frame in the parent link frame
+  const Transform &jointOrigin(std::size_t link) const {
+    return _origins[link];
+  }
+  // the unit axis of the joint, in the joint frame
+  const Position3D &jointAxis(std::size_t link) const { return _axes[link]; }
+  // the variable which drives the joint, -1 for a fixed joint
+  int jointVariable(std::size_t link) const { return _variables[link]; }
+  // The position of the joint (an angle or a distance) is
+  // multiplier * q[jointVariable] + offset. The multiplier is 1 and the
+  // offset 0, but for mimic joints and for the joints about -x, -y or -z,
+  // which are stored as joints about x, y or z with a negative multiplier.
+  float jointMultiplier(std::size_t link) const { return _multipliers[link]; }
+  float jointOffset(std::size_t link) const { return _offsets[link]; }
+
+  // The links are in depth first order: the subtree of a link, the link
+  // and all its descendants, is the range [link, subtreeEnd(link)).
+  std::size_t subtreeEnd(std::size_t link) const {
+    return _subtreeEnds[link];
+  }
+
+  // Compute the pose of all the links in the root link frame.
+  // q has variableCount() values, poses has room for linkCount() Transform.
+  void forwardKinematics(const float *q, Transform *poses) const;
+
+  // Compute the pose of the links in [begin, end) only, from the poses of
+  // their parents. The poses of the parents out of the range must be up to
+  // date. A link gets the very same pose as with a full computation.
+  void forwardKinematics(const float *q, Transform *poses, std::size_t begin,
+                         std::size_t end) const;
+
+  // The same with std::vector. Throw if q has not variableCount() values;
+  // poses is resized to linkCount().
+  void forwardKinematics(const std::vector<float> &q,
+                         std::vector<Transform> &poses) const;
+
+  // Compute the poses of all the links for count configurations: q has
+  // count configurations of variableCount() values, one after the other.
+  // poses is resized to linkCount() batches of count transforms: the pose
+  // of link l in configuration k is poses[l].get(k).
+  //
+  // The configurations are computed by blocks, link by link, each
+  // operation on all the configurations of a block at once. When maxThreads is
+  // not 1, the blocks are split across at most maxThreads threads (0 means
+  // one thread per hardware thread). The poses do not depend on the number
+  // of threads. They are those of forwardKinematics up to the rounding:
+  // the sines and cosines go through the vectorized fastSinCos, and the
+  // Transform kernels may fuse multiply-adds.
+  void forwardKinematics(const float *q, std::size_t count,
+                         std::vector<TransformBatch> &poses,
+                         unsigned int maxThreads = 1u) const;
+
+  // Compute the geometric Jacobian of the link, from the poses computed by
+  // forwardKinematics; only the poses of the link and of its ancestors are
+  // read. jacobian has room for the 6 x variableCount() matrix, stored
+  // column by column: column v, at jacobian + 6 * v, is the velocity of the
+  // link for a unit velocity of variable v. Does not allocate.
+  void jacobian(const Transform *poses, std::size_t link,
+                JacobianFrame frame, float *jacobian) const;
+
+  // The Jacobians of the link for count configurations: q has count
+  // configurations of variableCount() values, poses gets count sets of
+  // linkCount() poses and jacobians count matrices, one after the other.
+  // Does not allocate.
+  void jacobians(const float *q, std::size_t count, std::size_t link,
+                 JacobianFrame frame, Transform *poses,
+                 float *jacobians) const;
+
+ private:
+  std::vector<int> _parents;
+  std::vector<std::size_t> _subtreeEnds;
+  std::vector<JointType> _types;
+  std::vector<Transform> _origins;
+  std::vector<Position3D> _axes;
+  std::vector<int> _variables;
+  std::vector<float> _multipliers;
+  std::vector<float> _offsets;
+  std::vector<std::string> _linkNames;
+  std::vector<std::string> _jointNames;
+  std::vector<std::string> _variableNames;
+  std::vector<float> _variableLowers;
+  std::vector<float> _variableUppers;
+};
+}
+}
+#endif  // _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICMODEL_H_
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICSTATE_H_
+#define _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICSTATE_H_
+
+#include <almath/api.h>
+#include <almath/scenegraph/kinematicmodel.h>
+#include <cstddef>
+#include <vector>
+
+namespace AL {
+namespace Math {
+
+// A joint configuration of a KinematicModel, with the cached poses of its
+// links, for incremental forward kinematics.
+//
+// Setting a variable to a new value marks the subtrees of the joints it
+// drives as dirty; setting it to its current value does nothing. Only the
+// dirty subtrees are computed again, by update() or by the first pose()
+// query of a link they contain. The other links keep their cached poses.
+//
+// The links computed again get the very same poses as with
+// KinematicModel::forwardKinematics: the results do not depend on the
+// order nor on the number of the updates.
+//
+// The state keeps a reference to the model, which must outlive it.
+class ALMATH_API KinematicState {
+ public:
+  // all the variables are zero
+  explicit KinematicState(const KinematicModel &model);
+
+  const KinematicModel &model() const { return _model; }
+
+  const std::vector<float> &variables() const { return _q; }
+  float variable(std::size_t variable) const { return _q[variable]; }
+
+  void setVariable(std::size_t variable, float value);
+  // q has model().variableCount() values
+  void setVariables(const float *q);
+  // throw if q has not model().variableCount() values
+  void setVariables(const std::vector<float> &q);
+
+  // true if some link poses are not up to date
+  bool dirty() const { return !_dirtyLinks.empty(); }
+
+  // Compute the poses of the dirty subtrees.
+  // Return the number of links whose pose was computed.
+  std::size_t update();
+
+  // The pose of the link in the root link frame. If the link is in a dirty
+  // subtree, update() is called first; else the cached pose is returned.
+  const Transform &pose(std::size_t link);
+
+  // the pose of all the links, after update()
+  const std::vector<Transform> &poses();
+
+  // The Jacobian of the link, as KinematicModel::jacobian, from the cached
+  // poses. Like pose(), update() is called first if the link is dirty.
+  void jacobian(std::size_t link, KinematicModel::JacobianFrame frame,
+                float *jacobian);
+
+ private:
+  const KinematicModel &_model;
+  std::vector<float> _q;
+  std::vector<Transform> _poses;
+  // the links driven by each variable: the links of variable v are
+  // _variableLinks[_variableLinkOffsets[v] .. _variableLinkOffsets[v + 1])
+  std::vector<std::size_t> _variableLinkOffsets;
+  std::vector<std::size_t> _variableLinks;
+  // the roots of the dirty subtrees, and whether each link is one of them
+  std::vector<std::size_t> _dirtyLinks;
+  std::vector<char> _dirtyFlags;
+};
+}
+}
+#endif  // _LIBALMATH_ALMATH_SCENEGRAPH_KINEMATICSTATE_H_
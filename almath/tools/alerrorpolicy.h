@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TOOLS_ALERRORPOLICY_H_
+#define _LIBALMATH_ALMATH_TOOLS_ALERRORPOLICY_H_
+
+#include <almath/api.h>
+#include <cstddef>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// The errors ALMath recovers from: instead of failing, the function
+    /// goes on with a default value, and reports the error following the
+    /// ErrorPolicy.
+    /// </summary>
+    /// \ingroup Tools
+    enum ErrorKind {
+      /// A std::vector of the wrong size was given to a constructor or a
+      /// function; the result has a default value.
+      ERROR_WRONG_SIZE = 0,
+      /// A Transform built from floats had a rotation part which was not a
+      /// rotation, and was normalized. This one is only counted: it is not
+      /// reported.
+      ERROR_NORMALIZED,
+      /// A rotation could not be normalized (null column, NaN): it was set
+      /// to identity or left as is.
+      ERROR_NOT_NORMALIZABLE,
+      /// A deprecated function was called.
+      ERROR_DEPRECATED,
+      /// The number of error kinds.
+      ERROR_KIND_COUNT
+    };
+
+    /// <summary>
+    /// How the errors of ErrorKind are reported.
+    ///
+    /// Whatever the policy, each error increments the counter of its kind,
+    /// see errorCount. The counters are updated with relaxed atomic
+    /// increments: ERROR_POLICY_IGNORE is the policy for real-time threads,
+    /// which can check the counters from elsewhere.
+    /// </summary>
+    /// \ingroup Tools
+    enum ErrorPolicy {
+      /// Write "ALMath: WARNING: " and the message on std::cerr (default).
+      ERROR_POLICY_WARN = 0,
+      /// Only count the error.
+      ERROR_POLICY_IGNORE,
+      /// Call the ErrorCallback given to setErrorCallback, if any.
+      ERROR_POLICY_CALLBACK,
+      /// Throw a std::runtime_error with the message.
+      ERROR_POLICY_THROW,
+      /// For setThreadErrorPolicy: follow the global policy.
+      ERROR_POLICY_GLOBAL
+    };
+
+    /// <summary>
+    /// The callback of ERROR_POLICY_CALLBACK. It is called by the thread
+    /// which met the error; pMessage is only valid during the call.
+    /// </summary>
+    /// \ingroup Tools
+    typedef void (*ErrorCallback)(ErrorKind pKind, const char* pMessage);
+
+    /// <summary>
+    /// Set the policy of the threads which have no policy of their own.
+    /// ERROR_POLICY_GLOBAL is not a valid global policy, and throws.
+    /// </summary>
+    /// <param name="pPolicy"> the new policy </param>
+    /// <returns>
+    /// the previous policy
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API ErrorPolicy setErrorPolicy(ErrorPolicy pPolicy);
+
+    /// <summary>
+    /// Set the policy of the calling thread, which takes precedence over
+    /// the global policy. ERROR_POLICY_GLOBAL removes it.
+    /// </summary>
+    /// <param name="pPolicy"> the new policy of the calling thread </param>
+    /// <returns>
+    /// the previous policy of the calling thread
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API ErrorPolicy setThreadErrorPolicy(ErrorPolicy pPolicy);
+
+    /// <summary>
+    /// Return the policy which applies to the calling thread: its own
+    /// policy if it has one, else the global policy.
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API ErrorPolicy errorPolicy();
+
+    /// <summary>
+    /// Set the callback of ERROR_POLICY_CALLBACK, shared by all threads.
+    /// A null callback ignores the errors.
+    /// </summary>
+    /// <param name="pCallback"> the new callback </param>
+    /// <returns>
+    /// the previous callback
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API ErrorCallback setErrorCallback(ErrorCallback pCallback);
+
+    /// <summary>
+    /// Return the number of errors of kind pKind met by all threads since
+    /// the library was loaded or resetErrorCounts was called.
+    /// </summary>
+    /// <param name="pKind"> the error kind </param>
+    /// \ingroup Tools
+    ALMATH_API std::size_t errorCount(ErrorKind pKind);
+
+    /// <summary>
+    /// Set all the error counters to zero.
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API void resetErrorCounts();
+
+  }
+}
+#endif  // _LIBALMATH_ALMATH_TOOLS_ALERRORPOLICY_H_
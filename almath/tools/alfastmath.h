@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TOOLS_ALFASTMATH_H_
+#define _LIBALMATH_ALMATH_TOOLS_ALFASTMATH_H_
+
+#include <almath/api.h>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+namespace AL {
+  namespace Math {
+
+    namespace detail {
+      // fastSinCos: the angle is reduced to r in [-pi/4, pi/4] with
+      // x = q*pi/2 + r, pi/2 being split in three floats (Cody-Waite) so
+      // that q*pi/2 is exact for |x| <= FASTMATH_MAX_ANGLE. sin(r) and
+      // cos(r) are minimax polynomials from the cephes library.
+      const float FASTMATH_MAX_ANGLE = 8192.0f;
+      const float FASTMATH_TWO_OVER_PI = 0.636619772367581343f;
+      // adding then subtracting 1.5*2^23 rounds to the nearest integer
+      const float FASTMATH_ROUND = 12582912.0f;
+      const float FASTMATH_PIO2_1 = 1.5703125f;
+      const float FASTMATH_PIO2_2 = 4.837512969970703125e-4f;
+      const float FASTMATH_PIO2_3 = 7.54978995489188216e-8f;
+      const float FASTMATH_S1 = -1.6666654611e-1f;
+      const float FASTMATH_S2 = 8.3321608736e-3f;
+      const float FASTMATH_S3 = -1.9515295891e-4f;
+      const float FASTMATH_C1 = 4.166664568298827e-2f;
+      const float FASTMATH_C2 = -1.388731625493765e-3f;
+      const float FASTMATH_C3 = 2.443315711809948e-5f;
+
+      // fastAtan2: atan(t) for t in [0, 1], with the cephes reduction
+      // atan(t) = pi/4 + atan((t-1)/(t+1)) above tan(pi/8)
+      const float FASTMATH_TAN_PI_8 = 0.414213562373095049f;
+      const float FASTMATH_PI = 3.14159265358979323846f;
+      const float FASTMATH_PI_2 = 1.57079632679489661923f;
+      const float FASTMATH_PI_4 = 0.785398163397448309616f;
+      const float FASTMATH_A1 = -3.33329491539e-1f;
+      const float FASTMATH_A2 = 1.99777106478e-1f;
+      const float FASTMATH_A3 = -1.38776856032e-1f;
+      const float FASTMATH_A4 = 8.05374449538e-2f;
+
+      // approxAtan2: minimax polynomial of atan(t) for t in [0, 1]
+      const float FASTMATH_B0 = 0.9998660f;
+      const float FASTMATH_B1 = -0.3302995f;
+      const float FASTMATH_B2 = 0.1801410f;
+      const float FASTMATH_B3 = -0.0851330f;
+      const float FASTMATH_B4 = 0.0208351f;
+
+      inline uint32_t fastMathSignBit(float pValue)
+      {
+        uint32_t lBits;
+        std::memcpy(&lBits, &pValue, sizeof(lBits));
+        return lBits & 0x80000000u;
+      }
+
+      inline float fastMathFlipSign(float pValue, uint32_t pSignBit)
+      {
+        uint32_t lBits;
+        std::memcpy(&lBits, &pValue, sizeof(lBits));
+        lBits ^= pSignBit;
+        std::memcpy(&pValue, &lBits, sizeof(lBits));
+        return pValue;
+      }
+
+      // atan2 from atan(pNum/pDen), 0 <= pNum <= pDen: unfold the octant
+      inline float fastMathOctant(
+        float pAngle,
+        bool  pSwap,
+        float pY,
+        float pX)
+      {
+        if (pSwap)
+        {
+          pAngle = FASTMATH_PI_2 - pAngle;
+        }
+        if (fastMathSignBit(pX) != 0u)
+        {
+          pAngle = FASTMATH_PI - pAngle;
+        }
+        return fastMathFlipSign(pAngle, fastMathSignBit(pY));
+      }
+    } // end namespace detail
+
+    /// <summary>
+    /// Compute the sine and the cosine of an angle with a polynomial.
+    ///
+    /// For |pAngle| <= 8192 rad, the absolute error is below 1.2e-7
+    /// (2 float ulps of 1). Larger angles, infinities and NaN are passed to
+    /// std::sin and std::cos. The array version and the Pose2D array
+    /// operations use the same computation, vectorized (see alsimd.h).
+    ///
+    /// To use it for the trigonometry inside ALMath (Transform and Rotation
+    /// from angles, Position6D from Transform, Dubins curves, meshes...),
+    /// build the library with the ALMATH_FAST_TRIGONOMETRY option.
+    /// </summary>
+    /// <param name="pAngle"> the angle in radians </param>
+    /// <param name="pSin"> the sine of pAngle </param>
+    /// <param name="pCos"> the cosine of pAngle </param>
+    /// \ingroup Tools
+    inline void fastSinCos(float pAngle, float& pSin, float& pCos)
+    {
+      using namespace detail;
+      if (!(std::abs(pAngle) <= FASTMATH_MAX_ANGLE))
+      {
+        pSin = std::sin(pAngle);
+        pCos = std::cos(pAngle);
+        return;
+      }
+      const float q = (pAngle*FASTMATH_TWO_OVER_PI + FASTMATH_ROUND) -
+          FASTMATH_ROUND;
+      const uint32_t lQuadrant = static_cast<uint32_t>(
+            static_cast<int32_t>(q));
+      const float r = ((pAngle - q*FASTMATH_PIO2_1) - q*FASTMATH_PIO2_2) -
+          q*FASTMATH_PIO2_3;
+      const float z = r*r;
+      const float lSin = ((FASTMATH_S3*z + FASTMATH_S2)*z + FASTMATH_S1)*z*r +
+          r;
+      const float lCos = ((FASTMATH_C3*z + FASTMATH_C2)*z + FASTMATH_C1)*z*z -
+          0.5f*z + 1.0f;
+      // q mod 4 = 0: ( s,  c), 1: ( c, -s), 2: (-s, -c), 3: (-c,  s)
+      const bool lSwap = (lQuadrant & 1u) != 0u;
+      pSin = fastMathFlipSign(lSwap ? lCos : lSin, (lQuadrant & 2u) << 30);
+      pCos = fastMathFlipSign(lSwap ? lSin : lCos,
+                              ((lQuadrant + 1u) & 2u) << 30);
+    }
+
+    /// <summary>
+    /// Compute the sine of an angle with a polynomial, see fastSinCos.
+    /// </summary>
+    /// <param name="pAngle"> the angle in radians </param>
+    /// <returns>
+    /// the sine of pAngle
+    /// </returns>
+    /// \ingroup Tools
+    inline float fastSin(float pAngle)
+    {
+      float lSin, lCos;
+      fastSinCos(pAngle, lSin, lCos);
+      return lSin;
+    }
+
+    /// <summary>
+    /// Compute the cosine of an angle with a polynomial, see fastSinCos.
+    /// </summary>
+    /// <param name="pAngle"> the angle in radians </param>
+    /// <returns>
+    /// the cosine of pAngle
+    /// </returns>
+    /// \ingroup Tools
+    inline float fastCos(float pAngle)
+    {
+      float lSin, lCos;
+      fastSinCos(pAngle, lSin, lCos);
+      return lCos;
+    }
+
+    /// <summary>
+    /// Compute atan2(pY, pX) with a polynomial.
+    ///
+    /// The absolute error is below 3.5e-7 rad (1.5 float ulps of pi).
+    /// Signed zeros are handled as std::atan2 does. Infinities and NaN
+    /// are passed to std::atan2.
+    /// </summary>
+    /// <param name="pY"> the ordinate </param>
+    /// <param name="pX"> the abscissa </param>
+    /// <returns>
+    /// the angle of (pX, pY), in [-pi, pi]
+    /// </returns>
+    /// \ingroup Tools
+    inline float fastAtan2(float pY, float pX)
+    {
+      using namespace detail;
+      const float lAbsX = std::abs(pX);
+      const float lAbsY = std::abs(pY);
+      if (!(lAbsX <= FLT_MAX && lAbsY <= FLT_MAX))
+      {
+        return std::atan2(pY, pX);
+      }
+      const bool lSwap = lAbsY > lAbsX;
+      const float lNum = lSwap ? lAbsX : lAbsY;
+      const float lDen = lSwap ? lAbsY : lAbsX;
+      const bool lShift = lNum > FASTMATH_TAN_PI_8*lDen;
+      float t = 0.0f;
+      if (lDen != 0.0f)
+      {
+        t = lShift ? (lNum - lDen)/(lNum + lDen) : lNum/lDen;
+      }
+      const float z = t*t;
+      float lAngle = (((FASTMATH_A4*z + FASTMATH_A3)*z + FASTMATH_A2)*z +
+                      FASTMATH_A1)*z*t + t;
+      if (lShift)
+      {
+        lAngle += FASTMATH_PI_4;
+      }
+      return fastMathOctant(lAngle, lSwap, pY, pX);
+    }
+
+    /// <summary>
+    /// Compute atan2(pY, pX) with a shorter polynomial and a single
+    /// division, when 1e-4 rad are enough.
+    ///
+    /// The absolute error is below 1.2e-5 rad. Signed zeros are handled
+    /// as std::atan2 does. Infinities and NaN are passed to std::atan2.
+    /// </summary>
+    /// <param name="pY"> the ordinate </param>
+    /// <param name="pX"> the abscissa </param>
+    /// <returns>
+    /// the angle of (pX, pY), in [-pi, pi]
+    /// </returns>
+    /// \ingroup Tools
+    inline float approxAtan2(float pY, float pX)
+    {
+      using namespace detail;
+      const float lAbsX = std::abs(pX);
+      const float lAbsY = std::abs(pY);
+      if (!(lAbsX <= FLT_MAX && lAbsY <= FLT_MAX))
+      {
+        return std::atan2(pY, pX);
+      }
+      const bool lSwap = lAbsY > lAbsX;
+      const float lNum = lSwap ? lAbsX : lAbsY;
+      const float lDen = lSwap ? lAbsY : lAbsX;
+      const float t = lDen != 0.0f ? lNum/lDen : 0.0f;
+      const float z = t*t;
+      const float lAngle = ((((FASTMATH_B4*z + FASTMATH_B3)*z + FASTMATH_B2)*z +
+                             FASTMATH_B1)*z + FASTMATH_B0)*t;
+      return fastMathOctant(lAngle, lSwap, pY, pX);
+    }
+
+    /// <summary>
+    /// Compute the sines and cosines of an array of angles with the
+    /// vectorized kernels of alsimd.h. The results are those of
+    /// fastSinCos, within 2 float ulps with SIMD_AVX2.
+    /// pSin and pCos must not overlap pAngles.
+    /// </summary>
+    /// <param name="pAngles"> pointer to the first angle </param>
+    /// <param name="pSin"> pointer to the first sine </param>
+    /// <param name="pCos"> pointer to the first cosine </param>
+    /// <param name="pSize"> the number of angles </param>
+    /// \ingroup Tools
+    ALMATH_API void fastSinCos(
+      const float* pAngles,
+      float*       pSin,
+      float*       pCos,
+      std::size_t  pSize);
+
+    /// <summary>
+    /// Compute atan2(pY[i], pX[i]) for arrays with the vectorized kernels
+    /// of alsimd.h. The results are those of fastAtan2, within 2 float
+    /// ulps with SIMD_AVX2. pOut may be pY or pX.
+    /// </summary>
+    /// <param name="pY"> pointer to the first ordinate </param>
+    /// <param name="pX"> pointer to the first abscissa </param>
+    /// <param name="pOut"> pointer to the first angle </param>
+    /// <param name="pSize"> the number of angles </param>
+    /// \ingroup Tools
+    ALMATH_API void fastAtan2(
+      const float* pY,
+      const float* pX,
+      float*       pOut,
+      std::size_t  pSize);
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TOOLS_ALFASTMATH_H_
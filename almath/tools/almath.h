@@ -72,6 +72,117 @@ namespace AL {
   ALMATH_API float weightedMeanAngle(const std::vector<float>& pAngles,
                           const std::vector<float>& pWeights);
 
+  /// <summary>
+  /// Returns the mean of pSize angles, see meanAngle. Nothing is allocated.
+  /// The sines and cosines are those of std::sin and std::cos, or of the
+  /// vectorized fastSinCos (see alfastmath.h) when the library is built with
+  /// the ALMATH_FAST_TRIGONOMETRY option.
+  /// </summary>
+  /// <param name="pAngles"> pointer to the first angle </param>
+  /// <param name="pSize"> the number of angles </param>
+  /// <returns>
+  /// The computed mean (in ]-PI, PI]).
+  /// </returns>
+  /// \ingroup Tools
+  ALMATH_API float meanAngle(const float* pAngles, std::size_t pSize);
+
+  /// <summary>
+  /// Returns the weighted mean of pSize angles, see weightedMeanAngle.
+  /// Nothing is allocated, and the sines and cosines are computed as in
+  /// meanAngle.
+  ///
+  /// All weights must be strictly positive, else the method throws.
+  /// </summary>
+  /// <param name="pAngles"> pointer to the first angle </param>
+  /// <param name="pWeights"> pointer to the first weight </param>
+  /// <param name="pSize"> the number of angles and of weights </param>
+  /// <returns>
+  /// The computed mean (in ]-PI, PI]).
+  /// </returns>
+  /// \ingroup Tools
+  ALMATH_API float weightedMeanAngle(const float* pAngles,
+                                     const float* pWeights,
+                                     std::size_t  pSize);
+
+  /// <summary>
+  /// Circular statistics of a stream of weighted angles, updated one sample
+  /// at a time: add a sample when it arrives and remove it when it leaves a
+  /// sliding window, then read the mean at any time in O(1).
+  ///
+  /// The sums of the weighted unit vectors are kept in double, so that a
+  /// window can slide for a long time: a sample must be removed with the
+  /// angle and weight it was added with.
+  /// </summary>
+  /// \ingroup Tools
+  class ALMATH_API CircularMeanAccumulator
+  {
+  public:
+    /// <summary>
+    /// Create an empty accumulator.
+    /// </summary>
+    CircularMeanAccumulator();
+
+    /// <summary>
+    /// Add a sample. The weight must be strictly positive, else the method
+    /// throws.
+    /// </summary>
+    /// <param name="pAngle"> the angle </param>
+    /// <param name="pWeight"> the weight of the angle </param>
+    void add(float pAngle, float pWeight = 1.0f);
+
+    /// <summary>
+    /// Remove a sample previously added. Throws if the accumulator is
+    /// empty.
+    /// </summary>
+    /// <param name="pAngle"> the angle, as it was added </param>
+    /// <param name="pWeight"> the weight, as it was added </param>
+    void remove(float pAngle, float pWeight = 1.0f);
+
+    /// <summary>
+    /// Remove all the samples.
+    /// </summary>
+    void reset();
+
+    /// <summary>
+    /// The number of samples.
+    /// </summary>
+    std::size_t count() const;
+
+    /// <summary>
+    /// The sum of the weights of the samples.
+    /// </summary>
+    float weightSum() const;
+
+    /// <summary>
+    /// Return true if the mean is defined, see meanAngle.
+    /// </summary>
+    bool hasMean() const;
+
+    /// <summary>
+    /// The mean of the samples (in ]-PI, PI]), as weightedMeanAngle would
+    /// compute it. Throws if the mean is not defined.
+    /// </summary>
+    float mean() const;
+
+    /// <summary>
+    /// The mean resultant length R, in [0, 1]: the norm of the weighted
+    /// mean of the unit vectors. 1 when all the angles are equal, 0 for an
+    /// empty accumulator.
+    /// </summary>
+    float resultantLength() const;
+
+    /// <summary>
+    /// The circular variance 1 - R, in [0, 1].
+    /// </summary>
+    float circularVariance() const;
+
+  private:
+    double fSumCos;
+    double fSumSin;
+    double fWeightSum;
+    std::size_t fCount;
+  };
+
   /// <summary>
   /// Clip an input data inside min and max limit.
   ///
@@ -100,6 +211,47 @@ namespace AL {
     const float& pMax,
     std::vector<std::vector<float> >& pData);
 
+  /// <summary>
+  /// Clip each value of an array inside its own limits, for example joint
+  /// positions inside their joint limits.
+  ///
+  /// \f$ pMin[i] \leq pData[i] \leq pMax[i] \f$
+  ///
+  /// The values are clipped as clipData(const float&, const float&, float&)
+  /// does, with the SIMD instructions of alsimd.h. NaN values are left as
+  /// they are and not counted.
+  /// </summary>
+  /// <param name="pMin"> pointer to the first min limit </param>
+  /// <param name="pMax"> pointer to the first max limit </param>
+  /// <param name="pData"> pointer to the first clipped data </param>
+  /// <param name="pSize"> the number of data </param>
+  /// <returns>
+  /// Return the number of clipped data.
+  /// </returns>
+  /// \ingroup Tools
+  ALMATH_API std::size_t clipData(
+    const float* pMin,
+    const float* pMax,
+    float*       pData,
+    std::size_t  pSize);
+
+  /// <summary>
+  /// Clip each value of an array inside min and max limits, see above.
+  /// </summary>
+  /// <param name="pMin"> the min limit </param>
+  /// <param name="pMax"> the max limit </param>
+  /// <param name="pData"> pointer to the first clipped data </param>
+  /// <param name="pSize"> the number of data </param>
+  /// <returns>
+  /// Return the number of clipped data.
+  /// </returns>
+  /// \ingroup Tools
+  ALMATH_API std::size_t clipData(
+    const float& pMin,
+    const float& pMax,
+    float*       pData,
+    std::size_t  pSize);
+
   /// <summary>
   /** \f$ \left[\begin{array}{c}
     * pPosOut.x \\
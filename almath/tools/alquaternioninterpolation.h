@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TOOLS_ALQUATERNIONINTERPOLATION_H_
+#define _LIBALMATH_ALMATH_TOOLS_ALQUATERNIONINTERPOLATION_H_
+
+#include <almath/api.h>
+#include <almath/types/alquaternion.h>
+#include <cstddef>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// Normalized linear interpolation between two unit Quaternion.
+    ///
+    /// The result follows the shortest path: pQua2 is negated if needed.
+    /// Cheaper than quaternionSlerp, but the angular velocity is not
+    /// constant along the path.
+    /// </summary>
+    /// <param name="pQua1"> the Quaternion at pT = 0 </param>
+    /// <param name="pQua2"> the Quaternion at pT = 1 </param>
+    /// <param name="pT"> the interpolation parameter, in [0, 1] </param>
+    /// <returns>
+    /// the interpolated unit Quaternion
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API Quaternion quaternionNlerp(
+      const Quaternion& pQua1,
+      const Quaternion& pQua2,
+      float             pT);
+
+    /// <summary>
+    /// Spherical linear interpolation between two unit Quaternion.
+    ///
+    /// The result follows the shortest path at constant angular velocity:
+    /// pQua2 is negated if needed. Nearly equal Quaternion fall back to
+    /// quaternionNlerp.
+    /// </summary>
+    /// <param name="pQua1"> the Quaternion at pT = 0 </param>
+    /// <param name="pQua2"> the Quaternion at pT = 1 </param>
+    /// <param name="pT"> the interpolation parameter, in [0, 1] </param>
+    /// <returns>
+    /// the interpolated unit Quaternion
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API Quaternion quaternionSlerp(
+      const Quaternion& pQua1,
+      const Quaternion& pQua2,
+      float             pT);
+
+    /// <summary>
+    /// Compute pOut[i] = quaternionNlerp(pQua1[i], pQua2[i], pT[i]) for
+    /// i in [0, pSize).
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API void quaternionNlerp(
+      const Quaternion* pQua1,
+      const Quaternion* pQua2,
+      const float*      pT,
+      Quaternion*       pOut,
+      std::size_t       pSize);
+
+    /// <summary>
+    /// Compute pOut[i] = quaternionSlerp(pQua1[i], pQua2[i], pT[i]) for
+    /// i in [0, pSize).
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API void quaternionSlerp(
+      const Quaternion* pQua1,
+      const Quaternion* pQua2,
+      const float*      pT,
+      Quaternion*       pOut,
+      std::size_t       pSize);
+
+    /// <summary>
+    /// Compute the inner control point of squad at key pQua:
+    ///
+    /// \f$ s = q \exp\left(-\frac{\log(q^{-1}q_{next}) +
+    ///                          \log(q^{-1}q_{prev})}{4}\right) \f$
+    ///
+    /// pPrevious and pNext are negated if needed to be in the hemisphere
+    /// of pQua.
+    /// </summary>
+    /// <param name="pPrevious"> the key before pQua </param>
+    /// <param name="pQua"> the key </param>
+    /// <param name="pNext"> the key after pQua </param>
+    /// <returns>
+    /// the control point of pQua
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API Quaternion quaternionSquadControlPoint(
+      const Quaternion& pPrevious,
+      const Quaternion& pQua,
+      const Quaternion& pNext);
+
+    /// <summary>
+    /// Spherical quadrangle interpolation between the keys pQua1 and pQua2,
+    /// with their control points pS1 and pS2 (see
+    /// quaternionSquadControlPoint):
+    ///
+    /// slerp(slerp(pQua1, pQua2, pT), slerp(pS1, pS2, pT), 2 pT (1 - pT))
+    ///
+    /// The path is C1 continuous across consecutive segments. The keys are
+    /// expected to be in the same hemisphere: unlike quaternionSlerp, no
+    /// Quaternion is negated.
+    /// </summary>
+    /// <param name="pQua1"> the key at pT = 0 </param>
+    /// <param name="pS1"> the control point of pQua1 </param>
+    /// <param name="pS2"> the control point of pQua2 </param>
+    /// <param name="pQua2"> the key at pT = 1 </param>
+    /// <param name="pT"> the interpolation parameter, in [0, 1] </param>
+    /// <returns>
+    /// the interpolated unit Quaternion
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API Quaternion quaternionSquad(
+      const Quaternion& pQua1,
+      const Quaternion& pS1,
+      const Quaternion& pS2,
+      const Quaternion& pQua2,
+      float             pT);
+
+    /// <summary>
+    /// A slerp segment with its trigonometry computed once.
+    ///
+    /// Interpolating a segment costs two sinus and no acos, and
+    /// quaternionSlerpUniform samples it without any trigonometric call.
+    /// </summary>
+    /// \ingroup Tools
+    struct ALMATH_API QuaternionSlerpSegment
+    {
+      /// <summary> the Quaternion at t = 0 </summary>
+      Quaternion q1;
+      /// <summary>
+      /// the Quaternion at t = 1, negated if needed to follow the
+      /// shortest path
+      /// </summary>
+      Quaternion q2;
+      /// <summary> the angle between q1 and q2 on the unit sphere </summary>
+      float angle;
+      /// <summary>
+      /// 1/sin(angle), or 0 if q1 and q2 are so close that the segment is
+      /// interpolated linearly
+      /// </summary>
+      float inverseSinAngle;
+
+      /// <summary>
+      /// Create a segment with identity Quaternion.
+      /// </summary>
+      QuaternionSlerpSegment();
+
+      /// <summary>
+      /// Create the segment from pQua1 to pQua2.
+      /// </summary>
+      /// <param name="pQua1"> the Quaternion at t = 0 </param>
+      /// <param name="pQua2"> the Quaternion at t = 1 </param>
+      QuaternionSlerpSegment(
+        const Quaternion& pQua1,
+        const Quaternion& pQua2);
+
+      /// <summary>
+      /// Return quaternionSlerp(q1, q2, pT).
+      /// </summary>
+      /// <param name="pT"> the interpolation parameter, in [0, 1] </param>
+      Quaternion interpolate(float pT) const;
+    };
+
+    /// <summary>
+    /// A squad segment: the slerp segments between the keys and between
+    /// their control points.
+    /// </summary>
+    /// \ingroup Tools
+    struct ALMATH_API QuaternionSquadSegment
+    {
+      /// <summary> the segment between the two keys </summary>
+      QuaternionSlerpSegment keys;
+      /// <summary> the segment between the two control points </summary>
+      QuaternionSlerpSegment controls;
+
+      /// <summary>
+      /// Create a segment with identity Quaternion.
+      /// </summary>
+      QuaternionSquadSegment();
+
+      /// <summary>
+      /// Create the segment from pQua1 to pQua2, with their control points.
+      /// </summary>
+      QuaternionSquadSegment(
+        const Quaternion& pQua1,
+        const Quaternion& pS1,
+        const Quaternion& pS2,
+        const Quaternion& pQua2);
+
+      /// <summary>
+      /// Return quaternionSquad(keys.q1, controls.q1, controls.q2, keys.q2,
+      /// pT).
+      /// </summary>
+      /// <param name="pT"> the interpolation parameter, in [0, 1] </param>
+      Quaternion interpolate(float pT) const;
+    };
+
+    /// <summary>
+    /// Compute the pKeyCount - 1 slerp segments between consecutive keys.
+    /// </summary>
+    /// <param name="pKeys"> the keys </param>
+    /// <param name="pKeyCount"> the number of keys </param>
+    /// <param name="pSegments">
+    /// the output, with room for pKeyCount - 1 segments
+    /// </param>
+    /// \ingroup Tools
+    ALMATH_API void quaternionSlerpSegments(
+      const Quaternion*       pKeys,
+      std::size_t             pKeyCount,
+      QuaternionSlerpSegment* pSegments);
+
+    /// <summary>
+    /// Compute the pKeyCount - 1 squad segments between consecutive keys.
+    ///
+    /// The keys are first brought to the hemisphere of their predecessor.
+    /// The first and last keys are their own control points, so the path
+    /// starts and ends like a slerp.
+    /// </summary>
+    /// <param name="pKeys"> the keys </param>
+    /// <param name="pKeyCount"> the number of keys </param>
+    /// <param name="pSegments">
+    /// the output, with room for pKeyCount - 1 segments
+    /// </param>
+    /// \ingroup Tools
+    ALMATH_API void quaternionSquadSegments(
+      const Quaternion*       pKeys,
+      std::size_t             pKeyCount,
+      QuaternionSquadSegment* pSegments);
+
+    /// <summary>
+    /// Sample a slerp segment at t = pT0 + i*pDt for i in [0, pCount).
+    ///
+    /// The weights sin((1-t) angle) and sin(t angle) are updated with the
+    /// recurrence sin(a + d) = 2 cos(d) sin(a) - sin(a - d): the whole
+    /// sampling costs four sinus and one cosinus.
+    /// </summary>
+    /// <param name="pSegment"> the segment </param>
+    /// <param name="pT0"> the first interpolation parameter </param>
+    /// <param name="pDt"> the step of the interpolation parameter </param>
+    /// <param name="pCount"> the number of samples </param>
+    /// <param name="pOut"> the output, with room for pCount Quaternion </param>
+    /// \ingroup Tools
+    ALMATH_API void quaternionSlerpUniform(
+      const QuaternionSlerpSegment& pSegment,
+      float                         pT0,
+      float                         pDt,
+      std::size_t                   pCount,
+      Quaternion*                   pOut);
+
+    /// <summary>
+    /// Sample a squad segment at t = pT0 + i*pDt for i in [0, pCount).
+    ///
+    /// The two inner slerp are sampled as in quaternionSlerpUniform, only
+    /// the outer one needs trigonometric calls.
+    /// </summary>
+    /// <param name="pSegment"> the segment </param>
+    /// <param name="pT0"> the first interpolation parameter </param>
+    /// <param name="pDt"> the step of the interpolation parameter </param>
+    /// <param name="pCount"> the number of samples </param>
+    /// <param name="pOut"> the output, with room for pCount Quaternion </param>
+    /// \ingroup Tools
+    ALMATH_API void quaternionSquadUniform(
+      const QuaternionSquadSegment& pSegment,
+      float                         pT0,
+      float                         pDt,
+      std::size_t                   pCount,
+      Quaternion*                   pOut);
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TOOLS_ALQUATERNIONINTERPOLATION_H_
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TOOLS_ALSIMD_H_
+#define _LIBALMATH_ALMATH_TOOLS_ALSIMD_H_
+
+#include <almath/api.h>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// The instruction sets of the kernels behind Transform::operator*,
+    /// Transform::inverse, transformPreMultiply, Rotation::operator*,
+    /// operator*(Rotation, Position3D), and of the array versions of
+    /// fastSinCos and fastAtan2, which the Pose2D array operations use.
+    ///
+    /// The kernels are selected when the library is loaded, from the CPUID
+    /// of the host. The environment variable ALMATH_SIMD (generic, sse2 or
+    /// avx2) can lower the selected level.
+    ///
+    /// The SIMD_SSE2 kernels do the same float operations in the same order
+    /// as SIMD_GENERIC: results are identical, up to the sign of zero
+    /// coefficients.
+    ///
+    /// The SIMD_AVX2 kernels use fused multiply-add: each coefficient is
+    /// rounded once per product accumulation instead of twice. Results
+    /// differ from SIMD_GENERIC by at most a few float ulps of the largest
+    /// product term, that is 1e-6 relative for normalized transforms, and
+    /// by at most 2 float ulps for sines, cosines and atan2.
+    /// </summary>
+    /// \ingroup Tools
+    enum SimdLevel {
+      SIMD_GENERIC = 0,
+      SIMD_SSE2    = 1,
+      SIMD_AVX2    = 2
+    };
+
+    /// <summary>
+    /// Return the level of the kernels in use.
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API SimdLevel simdLevel();
+
+    /// <summary>
+    /// Return the highest level supported by the host and the build.
+    /// </summary>
+    /// \ingroup Tools
+    ALMATH_API SimdLevel simdLevelSupported();
+
+    /// <summary>
+    /// Select the kernels, mainly for tests and benchmarks.
+    /// The level is clamped to simdLevelSupported().
+    /// This function is not thread safe with the operations it affects.
+    /// </summary>
+    /// <param name="pLevel"> the requested level </param>
+    /// <returns>
+    /// the level in use.
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API SimdLevel setSimdLevel(SimdLevel pLevel);
+
+  }
+}
+#endif  // _LIBALMATH_ALMATH_TOOLS_ALSIMD_H_
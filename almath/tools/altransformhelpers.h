@@ -20,6 +20,8 @@
 #include <almath/types/alpose2d.h>
 #include <almath/types/alquaternion.h>
 #include <almath/types/aldisplacement.h>
+#include <cstddef>
+#include <deque>
 
 namespace AL {
   namespace Math {
@@ -88,6 +90,136 @@ namespace AL {
       const Velocity6D& pVel,
       Transform&        pT);
 
+    /// <summary>
+    /// Compute the logarithm of each transform of an array:
+    /// pVel[i] = transformLogarithm(pT[i]).
+    ///
+    /// The small angle and near pi cases are computed without branches:
+    /// Taylor series below 0.5 rad, and the axis is taken from the
+    /// symmetric part of the rotation when the angle is above 2pi/3, so
+    /// that any angle in [0, pi] is handled, not only rotations about x,
+    /// y or z. The angles go through the vectorized fastAtan2.
+    /// When pMaxThreads is not 1, large arrays are split across at most
+    /// pMaxThreads threads (0 means one thread per hardware thread).
+    /// </summary>
+    /// <param name="pT"> pointer to the first Transform </param>
+    /// <param name="pVel"> pointer to the first logarithm </param>
+    /// <param name="pSize"> the number of Transform </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void transformLogarithm(
+      const Transform* pT,
+      Velocity6D*      pVel,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the exponential of each velocity of an array:
+    /// pT[i] = velocityExponential(pVel[i]).
+    ///
+    /// The small angles are computed with Taylor series below 0.5 rad,
+    /// without branches, and the sines and cosines with the vectorized
+    /// fastSinCos. See transformLogarithm for pMaxThreads.
+    /// </summary>
+    /// <param name="pVel"> pointer to the first Velocity6D </param>
+    /// <param name="pT"> pointer to the first exponential </param>
+    /// <param name="pSize"> the number of Velocity6D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void velocityExponential(
+      const Velocity6D* pVel,
+      Transform*        pT,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the left Jacobian of velocityExponential at each velocity
+    /// of an array, that is the 6x6 matrix Jl such that, for a small
+    /// velocity d:
+    ///
+    /// velocityExponential(v + d) = velocityExponential(Jl*d) *
+    ///                              velocityExponential(v)
+    ///
+    /// Each Jacobian is written as 36 floats, row major, the rows and
+    /// columns in the order of Velocity6D (xd, yd, zd, wxd, wyd, wzd).
+    /// See transformLogarithm for pMaxThreads.
+    /// </summary>
+    /// <param name="pVel"> pointer to the first Velocity6D </param>
+    /// <param name="pJacobians"> pointer to the 36*pSize floats of the
+    /// Jacobians </param>
+    /// <param name="pSize"> the number of Velocity6D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void velocityExponentialLeftJacobian(
+      const Velocity6D* pVel,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the right Jacobian of velocityExponential at each velocity
+    /// of an array, that is the 6x6 matrix Jr such that, for a small
+    /// velocity d:
+    ///
+    /// velocityExponential(v + d) = velocityExponential(v) *
+    ///                              velocityExponential(Jr*d)
+    ///
+    /// See velocityExponentialLeftJacobian for the layout.
+    /// </summary>
+    /// <param name="pVel"> pointer to the first Velocity6D </param>
+    /// <param name="pJacobians"> pointer to the 36*pSize floats of the
+    /// Jacobians </param>
+    /// <param name="pSize"> the number of Velocity6D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void velocityExponentialRightJacobian(
+      const Velocity6D* pVel,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the left Jacobian of transformLogarithm, the inverse of the
+    /// left Jacobian of velocityExponential, for an array of logarithms
+    /// pLog[i] = transformLogarithm(T[i]). For a small velocity d:
+    ///
+    /// transformLogarithm(velocityExponential(d) * T) = pLog + J*d
+    ///
+    /// See velocityExponentialLeftJacobian for the layout.
+    /// </summary>
+    /// <param name="pLog"> pointer to the first logarithm </param>
+    /// <param name="pJacobians"> pointer to the 36*pSize floats of the
+    /// Jacobians </param>
+    /// <param name="pSize"> the number of logarithms </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void transformLogarithmLeftJacobian(
+      const Velocity6D* pLog,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the right Jacobian of transformLogarithm, the inverse of the
+    /// right Jacobian of velocityExponential, for an array of logarithms
+    /// pLog[i] = transformLogarithm(T[i]). For a small velocity d:
+    ///
+    /// transformLogarithm(T * velocityExponential(d)) = pLog + J*d
+    ///
+    /// See velocityExponentialLeftJacobian for the layout.
+    /// </summary>
+    /// <param name="pLog"> pointer to the first logarithm </param>
+    /// <param name="pJacobians"> pointer to the 36*pSize floats of the
+    /// Jacobians </param>
+    /// <param name="pSize"> the number of logarithms </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void transformLogarithmRightJacobian(
+      const Velocity6D* pLog,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
     /// <summary>
     /** \f$ \left[\begin{array}{c}
       * pVOut.xd  \\
@@ -240,6 +372,149 @@ namespace AL {
       const Position3D& pPosIn,
       Position3D&       pPosOut);
 
+    /// <summary>
+    /// Apply changeReferencePosition3D to a contiguous array of Position3D.
+    ///
+    /// pPosIn and pPosOut may be the same array, but must not partially
+    /// overlap. The loop is vectorized. When pMaxThreads is not 1, large
+    /// arrays are split across at most pMaxThreads threads (0 means one
+    /// thread per hardware thread).
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pPosIn"> pointer to the first Position3D to change
+    /// </param>
+    /// <param name = "pPosOut"> pointer to the first changed Position3D
+    /// </param>
+    /// <param name = "pSize"> the number of Position3D </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferencePosition3D(
+      const Transform&  pT,
+      const Position3D* pPosIn,
+      Position3D*       pPosOut,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferencePosition3D to pSize xyz float triplets.
+    /// See changeReferencePosition3D(const Transform&, const Position3D*,
+    /// Position3D*, std::size_t, unsigned int).
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pXYZIn"> pointer to the 3*pSize floats to change
+    /// </param>
+    /// <param name = "pXYZOut"> pointer to the 3*pSize changed floats
+    /// </param>
+    /// <param name = "pSize"> the number of xyz triplets </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferencePosition3D(
+      const Transform& pT,
+      const float*     pXYZIn,
+      float*           pXYZOut,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferencePosition3DInPlace to a contiguous array of
+    /// Position3D.
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pPos"> pointer to the first Position3D to change
+    /// </param>
+    /// <param name = "pSize"> the number of Position3D </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferencePosition3DInPlace(
+      const Transform& pT,
+      Position3D*      pPos,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferencePosition3DInPlace to pSize xyz float triplets.
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pXYZ"> pointer to the 3*pSize floats to change </param>
+    /// <param name = "pSize"> the number of xyz triplets </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferencePosition3DInPlace(
+      const Transform& pT,
+      float*           pXYZ,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferenceTransposePosition3D to a contiguous array of
+    /// Position3D.
+    /// See changeReferencePosition3D(const Transform&, const Position3D*,
+    /// Position3D*, std::size_t, unsigned int).
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pPosIn"> pointer to the first Position3D to change
+    /// </param>
+    /// <param name = "pPosOut"> pointer to the first changed Position3D
+    /// </param>
+    /// <param name = "pSize"> the number of Position3D </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferenceTransposePosition3D(
+      const Transform&  pT,
+      const Position3D* pPosIn,
+      Position3D*       pPosOut,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferenceTransposePosition3D to pSize xyz float triplets.
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pXYZIn"> pointer to the 3*pSize floats to change
+    /// </param>
+    /// <param name = "pXYZOut"> pointer to the 3*pSize changed floats
+    /// </param>
+    /// <param name = "pSize"> the number of xyz triplets </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferenceTransposePosition3D(
+      const Transform& pT,
+      const float*     pXYZIn,
+      float*           pXYZOut,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferenceTransposePosition3DInPlace to a contiguous array
+    /// of Position3D.
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pPos"> pointer to the first Position3D to change
+    /// </param>
+    /// <param name = "pSize"> the number of Position3D </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferenceTransposePosition3DInPlace(
+      const Transform& pT,
+      Position3D*      pPos,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
+    /// <summary>
+    /// Apply changeReferenceTransposePosition3DInPlace to pSize xyz float
+    /// triplets.
+    /// </summary>
+    /// <param name = "pT"> the given Transform </param>
+    /// <param name = "pXYZ"> pointer to the 3*pSize floats to change </param>
+    /// <param name = "pSize"> the number of xyz triplets </param>
+    /// <param name = "pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Tools
+    ALMATH_API void changeReferenceTransposePosition3DInPlace(
+      const Transform& pT,
+      float*           pXYZ,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads = 1u);
+
     /// <summary>
     /** \f$ \left[\begin{array}{c}
       * pTOut \\
@@ -407,6 +682,143 @@ namespace AL {
       const Transform& pTIn2,
       const float&     pVal = 0.5f);
 
+    /// <summary>
+    /// Average of a stream of weighted transforms, updated one sample at a
+    /// time: add a sample when it arrives and remove it when it leaves a
+    /// sliding window, then read the mean at any time in O(1).
+    ///
+    /// The mean is computed as averageTransforms of
+    /// almath/scenegraph/almatheigen.h computes it: the weighted mean of
+    /// the translations, and the normalized weighted sum of the rotation
+    /// quaternions, each one negated if it is not in the hemisphere of a
+    /// reference quaternion. averageTransforms takes the first transform of
+    /// the range as reference; here it is the sum of the samples in the
+    /// accumulator when a sample is added, so that the reference follows
+    /// the window as it drifts. The sign given to each sample is kept until
+    /// it is removed. With equal weights, both give the same result as long
+    /// as the rotations of the samples in the accumulator at any one time
+    /// stay within 90 degrees of each other, however far the window drifts.
+    ///
+    /// The accumulator keeps its samples, oldest first, and removes them in
+    /// the order they were added: the sums, kept in double, lose nothing
+    /// when a sample leaves, and a window can slide for a long time.
+    /// </summary>
+    /// \ingroup Tools
+    class ALMATH_API TransformMeanAccumulator
+    {
+    public:
+      /// <summary>
+      /// Create an empty accumulator.
+      /// </summary>
+      TransformMeanAccumulator();
+
+      /// <summary>
+      /// Add a sample. The weight must be strictly positive, else the
+      /// method throws.
+      /// </summary>
+      /// <param name="pT"> the transform </param>
+      /// <param name="pWeight"> the weight of the transform </param>
+      void add(const Transform& pT, float pWeight = 1.0f);
+
+      /// <summary>
+      /// Remove the oldest sample. Throws if the accumulator is empty.
+      /// </summary>
+      void remove();
+
+      /// <summary>
+      /// Remove the oldest sample, checking that it is the given one.
+      /// Throws, removing nothing, if the accumulator is empty or if pT and
+      /// pWeight are not exactly those of the oldest sample.
+      /// </summary>
+      /// <param name="pT"> the transform, as it was added </param>
+      /// <param name="pWeight"> the weight, as it was added </param>
+      void remove(const Transform& pT, float pWeight = 1.0f);
+
+      /// <summary>
+      /// Remove all the samples.
+      /// </summary>
+      void reset();
+
+      /// <summary>
+      /// The number of samples.
+      /// </summary>
+      std::size_t count() const;
+
+      /// <summary>
+      /// The sum of the weights of the samples.
+      /// </summary>
+      float weightSum() const;
+
+      /// <summary>
+      /// The mean of the samples. Throws if the accumulator is empty.
+      /// </summary>
+      Transform mean() const;
+
+    private:
+      struct Sample
+      {
+        Transform transform;
+        float weight;
+        // whether its quaternion was negated in the sum
+        bool negated;
+      };
+
+      // oldest first
+      std::deque<Sample> fSamples;
+      double fQuaternionSum[4];
+      double fTranslationSum[3];
+      double fWeightSum;
+    };
+
+    /// <summary>
+    /// Robust mean of an array of transforms, which rejects outliers by
+    /// iteratively reweighted least squares.
+    ///
+    /// The distance between a sample and the mean is
+    /// sqrt(|t - tMean|^2 + (pLength * angle)^2), where angle is the
+    /// rotation angle between them. At each iteration, the mean is
+    /// recomputed as in TransformMeanAccumulator, each sample weighted by
+    /// 1 if its distance is below pThreshold and by pThreshold / distance
+    /// otherwise (Huber loss). A null threshold weights each sample by
+    /// 1 / distance, which converges to the geometric median (Weiszfeld
+    /// algorithm). The first estimate is the plain mean of the samples.
+    ///
+    /// The iterations stop when the mean moves by less than pTolerance, in
+    /// the same unit, or after pMaxIterations. Each iteration is a
+    /// reduction over the samples, split across threads for large arrays;
+    /// the result does not depend on the number of threads. The threads
+    /// are started and joined at each iteration: they only pay off when
+    /// the array has tens of thousands of samples, use pMaxThreads = 1
+    /// below that.
+    /// Throws if the array is empty or if pThreshold is negative.
+    /// </summary>
+    /// <param name="pTransforms"> the transforms </param>
+    /// <param name="pSize"> the number of transforms </param>
+    /// <param name="pThreshold"> the distance above which a sample is
+    /// down-weighted </param>
+    /// <param name="pLength"> the distance equivalent to a rotation of
+    /// one radian </param>
+    /// <param name="pMaxIterations"> the maximum number of iterations </param>
+    /// <param name="pTolerance"> the move of the mean which stops the
+    /// iterations </param>
+    /// <param name="pWeights"> if not null, receives the final weight of
+    /// each sample, between 0 and 1 with a non null threshold </param>
+    /// <param name="pMaxThreads"> the maximum number of threads, 0 for
+    /// one per hardware thread </param>
+    /// <returns>
+    /// the robust mean
+    /// </returns>
+    /// \ingroup Tools
+    ALMATH_API Transform transformRobustMean(
+      const Transform* pTransforms,
+      std::size_t      pSize,
+      float            pThreshold,
+      float            pLength = 1.0f,
+      unsigned int     pMaxIterations = 50u,
+      float            pTolerance = 1e-6f,
+      float*           pWeights = NULL,
+      unsigned int     pMaxThreads = 1u);
+
     /// <summary>
     /// Create a Transform from 3D cartesian coordiantes and a Rotation.
     /**
@@ -954,4 +1366,9 @@ namespace AL {
 
   } // namespace Math
 } // namespace AL
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/altransformhelpers.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TOOLS_ALTRANSFORMHELPERS_H_
@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TOOLS_ALTRANSFORMHELPERST_H_
+#define _LIBALMATH_ALMATH_TOOLS_ALTRANSFORMHELPERST_H_
+
+#include <almath/types/altransformt.h>
+#include <almath/types/alvelocity6dt.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace AL {
+  namespace Math {
+
+    namespace detail {
+
+      // The logarithm and exponential of TransformT and Velocity6DT.
+      // TransformType and VelocityType only need the members of Transform
+      // and Velocity6D, with scalar type S.
+      //
+      // The formulas are those of the float functions of
+      // altransformhelpers.h, without their float-tuned thresholds: the
+      // small angle cases use Taylor series below the angle t at which
+      // t^4 < epsilon of S, and the cancellations of 1 - cos(t) are avoided,
+      // so that the results are accurate to a few epsilon of S.
+
+      template <typename S, typename TransformType, typename VelocityType>
+      void transformLogarithmInPlace(
+          const TransformType& pH,
+          VelocityType&        pVOut)
+      {
+        const S epsilon = std::numeric_limits<S>::epsilon();
+
+        // 2*sin(angle)*axis
+        const S ax = pH.r3_c2 - pH.r2_c3;
+        const S ay = pH.r1_c3 - pH.r3_c1;
+        const S az = pH.r2_c1 - pH.r1_c2;
+        const S si = S(0.5)*std::sqrt(ax*ax + ay*ay + az*az);
+        const S co = S(0.5)*(pH.r1_c1 + pH.r2_c2 + pH.r3_c3 - S(1));
+        const S angle = std::atan2(si, co);
+
+        S wx, wy, wz;
+        if (co >= S(0))
+        {
+          // angle/sin(angle) is accurate down to the identity
+          const S coeff = (si > S(0)) ? angle/(S(2)*si) : S(0.5);
+          wx = coeff*ax;
+          wy = coeff*ay;
+          wz = coeff*az;
+        }
+        else
+        {
+          // Towards a half turn, the antisymmetric part vanishes: the axis
+          // k comes from the symmetric part,
+          // R + R^T = 2*cos(angle)*I + 2*(1 - cos(angle))*k*k^T,
+          // and its sign from the antisymmetric part.
+          const S d = S(1) - co;
+          const S kx2 = (pH.r1_c1 - co)/d;
+          const S ky2 = (pH.r2_c2 - co)/d;
+          const S kz2 = (pH.r3_c3 - co)/d;
+          S kx, ky, kz;
+          if (kx2 >= ky2 && kx2 >= kz2)
+          {
+            kx = std::sqrt(kx2);
+            ky = (pH.r1_c2 + pH.r2_c1)/(S(2)*d*kx);
+            kz = (pH.r1_c3 + pH.r3_c1)/(S(2)*d*kx);
+          }
+          else if (ky2 >= kz2)
+          {
+            ky = std::sqrt(ky2);
+            kx = (pH.r1_c2 + pH.r2_c1)/(S(2)*d*ky);
+            kz = (pH.r2_c3 + pH.r3_c2)/(S(2)*d*ky);
+          }
+          else
+          {
+            kz = std::sqrt(kz2);
+            kx = (pH.r1_c3 + pH.r3_c1)/(S(2)*d*kz);
+            ky = (pH.r2_c3 + pH.r3_c2)/(S(2)*d*kz);
+          }
+          const S lSign = (kx*ax + ky*ay + kz*az < S(0)) ? S(-1) : S(1);
+          wx = lSign*angle*kx;
+          wy = lSign*angle*ky;
+          wz = lSign*angle*kz;
+        }
+
+        // v = p - 1/2 w x p + lambda w x (w x p), with
+        // lambda = (1 - angle*sin(angle)/(2*(1 - cos(angle))))/angle^2
+        const S angle2 = angle*angle;
+        S lambda;
+        if (angle2*angle2 < epsilon)
+        {
+          lambda = S(1)/S(12) + angle2/S(720);
+        }
+        else
+        {
+          const S sh = std::sin(S(0.5)*angle);
+          lambda = (S(1) - angle*std::sin(angle)/(S(4)*sh*sh))/angle2;
+        }
+
+        const S px = pH.r1_c4;
+        const S py = pH.r2_c4;
+        const S pz = pH.r3_c4;
+        const S cx = wy*pz - wz*py;
+        const S cy = wz*px - wx*pz;
+        const S cz = wx*py - wy*px;
+        pVOut.xd = px - S(0.5)*cx + lambda*(wy*cz - wz*cy);
+        pVOut.yd = py - S(0.5)*cy + lambda*(wz*cx - wx*cz);
+        pVOut.zd = pz - S(0.5)*cz + lambda*(wx*cy - wy*cx);
+        pVOut.wxd = wx;
+        pVOut.wyd = wy;
+        pVOut.wzd = wz;
+      }
+
+      template <typename S, typename VelocityType, typename TransformType>
+      void velocityExponentialInPlace(
+          const VelocityType& pM,
+          TransformType&      tM)
+      {
+        const S epsilon = std::numeric_limits<S>::epsilon();
+        const S t2 = pM.wxd*pM.wxd + pM.wyd*pM.wyd + pM.wzd*pM.wzd;
+
+        // sin(t)/t, (1 - cos(t))/t^2 and (t - sin(t))/t^3
+        S CC, SC, dSC;
+        if (t2*t2 < epsilon)
+        {
+          CC  = S(0.5) - t2/S(24);
+          SC  = S(1) - t2/S(6);
+          dSC = S(1)/S(6) - t2/S(120);
+        }
+        else
+        {
+          const S t = std::sqrt(t2);
+          const S sn = std::sin(t);
+          const S sh = std::sin(S(0.5)*t);
+          CC  = S(2)*sh*sh/t2;
+          SC  = sn/t;
+          dSC = (t - sn)/(t2*t);
+        }
+
+        tM.r1_c1 = S(1) - CC*(pM.wzd*pM.wzd + pM.wyd*pM.wyd);
+        tM.r1_c2 =   - SC*pM.wzd  + CC*pM.wxd*pM.wyd;
+        tM.r1_c3 =     SC*pM.wyd  + CC*pM.wxd*pM.wzd;
+        tM.r2_c1 =     SC*pM.wzd  + CC*pM.wxd*pM.wyd;
+        tM.r2_c2 = S(1) - CC*(pM.wxd*pM.wxd + pM.wzd*pM.wzd);
+        tM.r2_c3 =   - SC*pM.wxd  + CC*pM.wyd*pM.wzd;
+        tM.r3_c1 =   - SC*pM.wyd  + CC*pM.wxd*pM.wzd;
+        tM.r3_c2 =     SC*pM.wxd  + CC*pM.wyd*pM.wzd;
+        tM.r3_c3 = S(1) - CC*(pM.wxd*pM.wxd + pM.wyd*pM.wyd);
+
+        tM.r1_c4 = (SC + dSC*pM.wxd*pM.wxd)*pM.xd +
+                   (-CC*pM.wzd + dSC*pM.wxd*pM.wyd)*pM.yd +
+                   (+CC*pM.wyd + dSC*pM.wxd*pM.wzd)*pM.zd;
+
+        tM.r2_c4 = (CC*pM.wzd + dSC*pM.wyd*pM.wxd)*pM.xd +
+                   (SC + dSC*pM.wyd*pM.wyd)*pM.yd +
+                   (-CC*pM.wxd + dSC*pM.wyd*pM.wzd)*pM.zd;
+
+        tM.r3_c4 = (-CC*pM.wyd + dSC*pM.wzd*pM.wxd)*pM.xd +
+                   (CC*pM.wxd + dSC*pM.wzd*pM.wyd)*pM.yd +
+                   (SC + dSC*pM.wzd*pM.wzd)*pM.zd;
+      }
+
+    } // end namespace detail
+
+    /// <summary>
+    /// Compute the logarithme of a TransformT, at any precision.
+    /// See transformLogarithmInPlace(const Transform&, Velocity6D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void transformLogarithmInPlace(
+        const TransformT<S>& pT,
+        Velocity6DT<S>&      pVel)
+    {
+      detail::transformLogarithmInPlace<S>(pT, pVel);
+    }
+
+    /// <summary>
+    /// Compute the logarithme of a TransformT, at any precision.
+    /// See transformLogarithm(const Transform&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    Velocity6DT<S> transformLogarithm(const TransformT<S>& pT)
+    {
+      Velocity6DT<S> lVel;
+      detail::transformLogarithmInPlace<S>(pT, lVel);
+      return lVel;
+    }
+
+    /// <summary>
+    /// Compute the exponential of a Velocity6DT, at any precision.
+    /// See velocityExponentialInPlace(const Velocity6D&, Transform&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void velocityExponentialInPlace(
+        const Velocity6DT<S>& pVel,
+        TransformT<S>&        pT)
+    {
+      detail::velocityExponentialInPlace<S>(pVel, pT);
+    }
+
+    /// <summary>
+    /// Compute the exponential of a Velocity6DT, at any precision.
+    /// See velocityExponential(const Velocity6D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    TransformT<S> velocityExponential(const Velocity6DT<S>& pVel)
+    {
+      TransformT<S> lT;
+      detail::velocityExponentialInPlace<S>(pVel, lT);
+      return lT;
+    }
+
+    /// <summary>
+    /// Interpolate between two TransformT, at any precision.
+    /// See transformMeanInPlace(const Transform&, const Transform&,
+    /// const float&, Transform&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void transformMeanInPlace(
+        const TransformT<S>& pHIn1,
+        const TransformT<S>& pHIn2,
+        const S&             pDist,
+        TransformT<S>&       pHOut)
+    {
+      if ((pDist > S(1)) || (pDist < S(0)))
+      {
+        throw std::runtime_error(
+            "ALMath: transformMeanInPlace Distance must be between 0 and 1.");
+      }
+      const Velocity6DT<S> lVel = transformLogarithm(pHIn1.inverse()*pHIn2);
+      pHOut = pHIn1*velocityExponential(pDist*lVel);
+    }
+
+    /// <summary>
+    /// Interpolate between two TransformT, at any precision.
+    /// See transformMean(const Transform&, const Transform&, const float&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    TransformT<S> transformMean(
+        const TransformT<S>& pHIn1,
+        const TransformT<S>& pHIn2,
+        const S&             pDist = S(0.5))
+    {
+      TransformT<S> lOut;
+      transformMeanInPlace(pHIn1, pHIn2, pDist, lOut);
+      return lOut;
+    }
+
+    /// <summary>
+    /// Rotate a Velocity6DT by the rotation part of a TransformT.
+    /// See changeReferenceVelocity6D(const Transform&, const Velocity6D&,
+    /// Velocity6D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceVelocity6D(
+        const TransformT<S>&  pH,
+        const Velocity6DT<S>& pVIn,
+        Velocity6DT<S>&       pVOut)
+    {
+      const RotationT<S> lR = pH.rotation();
+      const Position3DT<S> lV =
+          lR*Position3DT<S>(pVIn.xd, pVIn.yd, pVIn.zd);
+      const Position3DT<S> lW =
+          lR*Position3DT<S>(pVIn.wxd, pVIn.wyd, pVIn.wzd);
+      pVOut = Velocity6DT<S>(lV.x, lV.y, lV.z, lW.x, lW.y, lW.z);
+    }
+
+    /// <summary>
+    /// Rotate a Velocity6DT by the transpose of the rotation part of a
+    /// TransformT.
+    /// See changeReferenceTransposeVelocity6D(const Transform&,
+    /// const Velocity6D&, Velocity6D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceTransposeVelocity6D(
+        const TransformT<S>&  pH,
+        const Velocity6DT<S>& pVIn,
+        Velocity6DT<S>&       pVOut)
+    {
+      const RotationT<S> lRt = pH.rotation().transpose();
+      const Position3DT<S> lV =
+          lRt*Position3DT<S>(pVIn.xd, pVIn.yd, pVIn.zd);
+      const Position3DT<S> lW =
+          lRt*Position3DT<S>(pVIn.wxd, pVIn.wyd, pVIn.wzd);
+      pVOut = Velocity6DT<S>(lV.x, lV.y, lV.z, lW.x, lW.y, lW.z);
+    }
+
+    /// <summary>
+    /// Rotate a Position3DT by the rotation part of a TransformT.
+    /// See changeReferencePosition3D(const Transform&, const Position3D&,
+    /// Position3D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferencePosition3D(
+        const TransformT<S>&  pH,
+        const Position3DT<S>& pPosIn,
+        Position3DT<S>&       pPosOut)
+    {
+      pPosOut = pH.rotation()*pPosIn;
+    }
+
+    /// <summary>
+    /// Rotate a Position3DT in place by the rotation part of a TransformT.
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferencePosition3DInPlace(
+        const TransformT<S>& pH,
+        Position3DT<S>&      pPosOut)
+    {
+      pPosOut = pH.rotation()*pPosOut;
+    }
+
+    /// <summary>
+    /// Rotate a Position3DT by the transpose of the rotation part of a
+    /// TransformT.
+    /// See changeReferenceTransposePosition3D(const Transform&,
+    /// const Position3D&, Position3D&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceTransposePosition3D(
+        const TransformT<S>&  pH,
+        const Position3DT<S>& pPosIn,
+        Position3DT<S>&       pPosOut)
+    {
+      pPosOut = pH.rotation().transpose()*pPosIn;
+    }
+
+    /// <summary>
+    /// Rotate a Position3DT in place by the transpose of the rotation part
+    /// of a TransformT.
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceTransposePosition3DInPlace(
+        const TransformT<S>& pH,
+        Position3DT<S>&      pPosOut)
+    {
+      pPosOut = pH.rotation().transpose()*pPosOut;
+    }
+
+    /// <summary>
+    /// Change the reference of a TransformT: pHOut = pH * pHIn, translation
+    /// of pH excluded.
+    /// See changeReferenceTransform(const Transform&, const Transform&,
+    /// Transform&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceTransform(
+        const TransformT<S>& pH,
+        const TransformT<S>& pHIn,
+        TransformT<S>&       pHOut)
+    {
+      pHOut = TransformT<S>(pH.rotation(), Position3DT<S>())*pHIn;
+    }
+
+    /// <summary>
+    /// Change the reference of a TransformT with the transpose of the
+    /// rotation part of pH.
+    /// See changeReferenceTransposeTransform(const Transform&,
+    /// const Transform&, Transform&).
+    /// </summary>
+    /// \ingroup Tools
+    template <typename S>
+    void changeReferenceTransposeTransform(
+        const TransformT<S>& pH,
+        const TransformT<S>& pHIn,
+        TransformT<S>&       pHOut)
+    {
+      pHOut = TransformT<S>(pH.rotation().transpose(), Position3DT<S>())*pHIn;
+    }
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TOOLS_ALTRANSFORMHELPERST_H_
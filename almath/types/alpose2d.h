@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALPOSE2D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALPOSE2D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <cmath>
 #include <almath/api.h>
@@ -115,6 +117,21 @@ namespace AL {
       /// </param>
       Pose2D(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Pose2D from an std::array [x, y, theta].
+      /// </summary>
+      /// <param name="pFloats"> the array of 3 floats </param>
+      explicit Pose2D(const std::array<float, 3>& pFloats);
+
+      /// <summary>
+      /// Create a Pose2D from pSize floats [x, y, theta].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 3 </param>
+      Pose2D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Create a Pose2D from polar coordinates.
       /// </summary>
@@ -293,6 +310,42 @@ namespace AL {
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
 
+      /// <summary>
+      /// Return the Pose2D as an std::array of float [x, y, theta].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 3> toArray(void) const;
+
+      /// <summary>
+      /// Write [x, y, theta] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 3 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = x;
+        *pIt++ = y;
+        *pIt++ = theta;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [x, y, theta] from an input iterator,
+      /// a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        x = *pIt++;
+        y = *pIt++;
+        theta = *pIt++;
+        return pIt;
+      }
+
       /// <summary>
       /// Compute the norm of the current Pose2D.
       ///
@@ -408,7 +461,118 @@ namespace AL {
       const Pose2D& pPos,
       Pose2D&       pRes);
 
+    /// <summary>
+    /// Compose a Pose2D with a contiguous array of Pose2D:
+    /// pOut[i] = pPos1 * pPos2[i].
+    ///
+    /// pPos2 and pOut may be the same array, but must not partially
+    /// overlap. When pMaxThreads is not 1, large arrays are split across at
+    /// most pMaxThreads threads (0 means one thread per hardware thread).
+    /// </summary>
+    /// <param name="pPos1"> the Pose2D applied to every element </param>
+    /// <param name="pPos2"> pointer to the first Pose2D to compose </param>
+    /// <param name="pOut"> pointer to the first result </param>
+    /// <param name="pSize"> the number of Pose2D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Types
+    ALMATH_API void pose2DMultiply(
+      const Pose2D& pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compose a contiguous array of Pose2D with a Pose2D:
+    /// pOut[i] = pPos1[i] * pPos2.
+    ///
+    /// The sines and cosines of the pPos1[i].theta are computed with the
+    /// array version of fastSinCos (see alfastmath.h): they are within
+    /// 2 float ulps of std::sin and std::cos. pPos1 and pOut may be the
+    /// same array, but must not partially overlap. When pMaxThreads is not 1, large arrays are
+    /// split across at most pMaxThreads threads (0 means one thread per
+    /// hardware thread).
+    /// </summary>
+    /// <param name="pPos1"> pointer to the first Pose2D to compose </param>
+    /// <param name="pPos2"> the Pose2D applied to every element </param>
+    /// <param name="pOut"> pointer to the first result </param>
+    /// <param name="pSize"> the number of Pose2D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Types
+    ALMATH_API void pose2DMultiply(
+      const Pose2D* pPos1,
+      const Pose2D& pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compose two contiguous arrays of Pose2D pairwise:
+    /// pOut[i] = pPos1[i] * pPos2[i].
+    ///
+    /// Sines, cosines, aliasing and threads as in
+    /// pose2DMultiply(const Pose2D*, const Pose2D&, ...).
+    /// </summary>
+    /// <param name="pPos1"> pointer to the first left hand side </param>
+    /// <param name="pPos2"> pointer to the first right hand side </param>
+    /// <param name="pOut"> pointer to the first result </param>
+    /// <param name="pSize"> the number of Pose2D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Types
+    ALMATH_API void pose2DMultiply(
+      const Pose2D* pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute the inverse of a contiguous array of Pose2D:
+    /// pOut[i] = pose2DInverse(pPos[i]).
+    ///
+    /// Sines, cosines, aliasing and threads as in
+    /// pose2DMultiply(const Pose2D*, const Pose2D&, ...).
+    /// </summary>
+    /// <param name="pPos"> pointer to the first Pose2D to invert </param>
+    /// <param name="pOut"> pointer to the first inverse </param>
+    /// <param name="pSize"> the number of Pose2D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Types
+    ALMATH_API void pose2DInverse(
+      const Pose2D* pPos,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads = 1u);
+
+    /// <summary>
+    /// Compute pairwise the Pose2D between two contiguous arrays of Pose2D:
+    /// pOut[i] = pose2dDiff(pPos1[i], pPos2[i]), that is
+    /// inverse(pPos1[i])*pPos2[i], with one sine and cosine per element.
+    ///
+    /// The steps of a path of pSize + 1 poses p are
+    /// pose2dDiff(p, p + 1, pOut, pSize).
+    /// Sines, cosines, aliasing and threads as in
+    /// pose2DMultiply(const Pose2D*, const Pose2D&, ...).
+    /// </summary>
+    /// <param name="pPos1"> pointer to the first reference Pose2D </param>
+    /// <param name="pPos2"> pointer to the first target Pose2D </param>
+    /// <param name="pOut"> pointer to the first result </param>
+    /// <param name="pSize"> the number of Pose2D </param>
+    /// <param name="pMaxThreads"> the maximum number of threads </param>
+    /// \ingroup Types
+    ALMATH_API void pose2dDiff(
+      const Pose2D* pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads = 1u);
+
 
   } // end namespace math
 } // end namespace AL
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/alpose2d.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TYPES_ALPOSE2D_H_
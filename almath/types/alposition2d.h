@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALPOSITION2D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALPOSITION2D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -100,6 +102,21 @@ namespace AL {
       /// </param>
       Position2D(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Position2D from an std::array [x, y].
+      /// </summary>
+      /// <param name="pFloats"> the array of 2 floats </param>
+      explicit Position2D(const std::array<float, 2>& pFloats);
+
+      /// <summary>
+      /// Create a Position2D from pSize floats [x, y].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 2 </param>
+      Position2D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Build a Position2D from polar coordinates.
       /// </summary>
@@ -293,6 +310,39 @@ namespace AL {
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
 
+      /// <summary>
+      /// Return the Position2D as an std::array of float [x, y].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 2> toArray(void) const;
+
+      /// <summary>
+      /// Write [x, y] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 2 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = x;
+        *pIt++ = y;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [x, y] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        x = *pIt++;
+        y = *pIt++;
+        return pIt;
+      }
+
       /// <summary>
       /// Return the angular direction of a Position2D.
       ///
@@ -406,4 +456,9 @@ namespace AL {
 
   } // end namespace math
 } // end namespace al
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/alposition2d.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TYPES_ALPOSITION2D_H_
@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALPOSITION3D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALPOSITION3D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -113,6 +115,21 @@ namespace AL {
       /// </param>
       Position3D (const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Position3D from an std::array [x, y, z].
+      /// </summary>
+      /// <param name="pFloats"> the array of 3 floats </param>
+      explicit Position3D(const std::array<float, 3>& pFloats);
+
+      /// <summary>
+      /// Create a Position3D from pSize floats [x, y, z].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 3 </param>
+      Position3D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator + for Position3D.
       /// </summary>
@@ -291,6 +308,41 @@ namespace AL {
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
 
+      /// <summary>
+      /// Return the Position3D as an std::array of float [x, y, z].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 3> toArray(void) const;
+
+      /// <summary>
+      /// Write [x, y, z] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 3 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = x;
+        *pIt++ = y;
+        *pIt++ = z;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [x, y, z] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        x = *pIt++;
+        y = *pIt++;
+        z = *pIt++;
+        return pIt;
+      }
+
       /// <summary>
       /// Checks if the norm of the Position3D is near to 1.0
       /// </summary>
@@ -440,4 +492,9 @@ namespace AL {
 
   } // end namespace math
 } // end namespace al
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/alposition3d.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TYPES_ALPOSITION3D_H_
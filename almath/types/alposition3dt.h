@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALPOSITION3DT_H_
+#define _LIBALMATH_ALMATH_TYPES_ALPOSITION3DT_H_
+
+#include <almath/types/alposition3d.h>
+#include <cmath>
+#include <stdexcept>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A Position3D with a templated scalar type.
+    ///
+    /// Position3DT<float> has the layout of Position3D. Position3Dd is the
+    /// double precision version.
+    /// </summary>
+    /// \ingroup Types
+    template <typename S>
+    struct Position3DT {
+      typedef S Scalar;
+
+      /// <summary> </summary>
+      S x;
+      /// <summary> </summary>
+      S y;
+      /// <summary> </summary>
+      S z;
+
+      /// <summary>
+      /// Create a Position3DT initialized with 0.
+      /// </summary>
+      Position3DT() : x(S(0)), y(S(0)), z(S(0)) {}
+
+      /// <summary>
+      /// Create a Position3DT with the same value for each coordinate.
+      /// </summary>
+      /// <param name="pInit"> the value for all coordinates </param>
+      explicit Position3DT(S pInit) : x(pInit), y(pInit), z(pInit) {}
+
+      /// <summary>
+      /// Create a Position3DT with explicit values.
+      /// </summary>
+      Position3DT(S pX, S pY, S pZ) : x(pX), y(pY), z(pZ) {}
+
+      /// <summary>
+      /// Convert a Position3DT of another scalar type.
+      /// </summary>
+      template <typename U>
+      explicit Position3DT(const Position3DT<U>& pPos)
+        : x(static_cast<S>(pPos.x)),
+          y(static_cast<S>(pPos.y)),
+          z(static_cast<S>(pPos.z)) {}
+
+      /// <summary>
+      /// Convert a Position3D.
+      /// </summary>
+      explicit Position3DT(const Position3D& pPos)
+        : x(static_cast<S>(pPos.x)),
+          y(static_cast<S>(pPos.y)),
+          z(static_cast<S>(pPos.z)) {}
+
+      /// <summary>
+      /// Convert to a Position3D.
+      /// </summary>
+      Position3D toPosition3D() const
+      {
+        return Position3D(static_cast<float>(x),
+                          static_cast<float>(y),
+                          static_cast<float>(z));
+      }
+
+      Position3DT operator+ (const Position3DT& pPos2) const
+      {
+        return Position3DT(x + pPos2.x, y + pPos2.y, z + pPos2.z);
+      }
+
+      Position3DT operator- (const Position3DT& pPos2) const
+      {
+        return Position3DT(x - pPos2.x, y - pPos2.y, z - pPos2.z);
+      }
+
+      Position3DT operator- () const
+      {
+        return Position3DT(-x, -y, -z);
+      }
+
+      Position3DT& operator+= (const Position3DT& pPos2)
+      {
+        x += pPos2.x;
+        y += pPos2.y;
+        z += pPos2.z;
+        return *this;
+      }
+
+      Position3DT& operator-= (const Position3DT& pPos2)
+      {
+        x -= pPos2.x;
+        y -= pPos2.y;
+        z -= pPos2.z;
+        return *this;
+      }
+
+      Position3DT operator* (S pVal) const
+      {
+        return Position3DT(x*pVal, y*pVal, z*pVal);
+      }
+
+      Position3DT& operator*= (S pVal)
+      {
+        x *= pVal;
+        y *= pVal;
+        z *= pVal;
+        return *this;
+      }
+
+      Position3DT operator/ (S pVal) const
+      {
+        if (pVal == S(0))
+        {
+          throw std::runtime_error(
+            "ALPosition3D: operator/ Division by zero.");
+        }
+        return *this * (S(1)/pVal);
+      }
+
+      bool operator== (const Position3DT& pPos2) const
+      {
+        return (x == pPos2.x &&
+                y == pPos2.y &&
+                z == pPos2.z);
+      }
+
+      bool operator!= (const Position3DT& pPos2) const
+      {
+        return !(*this==pPos2);
+      }
+
+      /// <summary>
+      /// Check if the actual Position3DT is near the one
+      /// given in argument.
+      /// </summary>
+      bool isNear(
+        const Position3DT& pPos2,
+        const S&           pEpsilon=S(0.0001)) const
+      {
+        return (std::abs(x - pPos2.x) <= pEpsilon &&
+                std::abs(y - pPos2.y) <= pEpsilon &&
+                std::abs(z - pPos2.z) <= pEpsilon);
+      }
+
+      S norm() const
+      {
+        return std::sqrt(x*x + y*y + z*z);
+      }
+
+      S distance(const Position3DT& pPos2) const
+      {
+        return (*this - pPos2).norm();
+      }
+
+      S dotProduct(const Position3DT& pPos2) const
+      {
+        return x*pPos2.x + y*pPos2.y + z*pPos2.z;
+      }
+
+      Position3DT crossProduct(const Position3DT& pPos2) const
+      {
+        return Position3DT(y*pPos2.z - z*pPos2.y,
+                           z*pPos2.x - x*pPos2.z,
+                           x*pPos2.y - y*pPos2.x);
+      }
+    };
+
+    template <typename S>
+    Position3DT<S> operator* (S pVal, const Position3DT<S>& pPos)
+    {
+      return pPos*pVal;
+    }
+
+    template <typename S>
+    S norm(const Position3DT<S>& pPos)
+    {
+      return pPos.norm();
+    }
+
+    template <typename S>
+    S distance(const Position3DT<S>& pPos1, const Position3DT<S>& pPos2)
+    {
+      return pPos1.distance(pPos2);
+    }
+
+    template <typename S>
+    S dotProduct(const Position3DT<S>& pPos1, const Position3DT<S>& pPos2)
+    {
+      return pPos1.dotProduct(pPos2);
+    }
+
+    template <typename S>
+    Position3DT<S> crossProduct(const Position3DT<S>& pPos1,
+                                const Position3DT<S>& pPos2)
+    {
+      return pPos1.crossProduct(pPos2);
+    }
+
+    /// \ingroup Types
+    typedef Position3DT<double> Position3Dd;
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALPOSITION3DT_H_
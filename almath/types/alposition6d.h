@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALPOSITION6D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALPOSITION6D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -149,6 +151,21 @@ namespace AL {
       /// </param>
       Position6D(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Position6D from an std::array [x, y, z, wx, wy, wz].
+      /// </summary>
+      /// <param name="pFloats"> the array of 6 floats </param>
+      explicit Position6D(const std::array<float, 6>& pFloats);
+
+      /// <summary>
+      /// Create a Position6D from pSize floats [x, y, z, wx, wy, wz].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 6 </param>
+      Position6D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator + for Position6D.
       /// </summary>
@@ -313,6 +330,49 @@ namespace AL {
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
 
+      /// <summary>
+      /// Return the Position6D as an std::array of float [x, y, z, wx, wy, wz].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 6> toArray(void) const;
+
+      /// <summary>
+      /// Write [x, y, z, wx, wy, wz] to an output iterator,
+      /// a float* for instance.
+      /// It is assumed the destination has room for 6 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = x;
+        *pIt++ = y;
+        *pIt++ = z;
+        *pIt++ = wx;
+        *pIt++ = wy;
+        *pIt++ = wz;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [x, y, z, wx, wy, wz] from an input iterator,
+      /// a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        x = *pIt++;
+        y = *pIt++;
+        z = *pIt++;
+        wx = *pIt++;
+        wy = *pIt++;
+        wz = *pIt++;
+        return pIt;
+      }
+
     }; // end struct
 
 
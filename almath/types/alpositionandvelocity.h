@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALPOSITIONANDVELOCITY_H_
 #define _LIBALMATH_ALMATH_TYPES_ALPOSITIONANDVELOCITY_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -48,6 +50,20 @@ namespace AL {
           const float pq = 0.0f,
           const float pdq = 0.0f);
 
+      /// <summary>
+      /// Create a PositionAndVelocity from an std::array [q, dq].
+      /// </summary>
+      /// <param name="pFloats"> the array of 2 floats </param>
+      explicit PositionAndVelocity(const std::array<float, 2>& pFloats);
+
+      /// <summary>
+      /// Create a PositionAndVelocity from pSize floats [q, dq].
+      /// A wrong size throws a std::runtime_error.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 2 </param>
+      PositionAndVelocity(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Check if the actual PositionAndVelocity is near the one
       /// give in argument.
@@ -68,6 +84,39 @@ namespace AL {
       /// </summary>
       void toVector(std::vector<float>& pReturnVector) const;
       std::vector<float> toVector(void) const;
+
+      /// <summary>
+      /// Return the PositionAndVelocity as an std::array of float [q, dq].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 2> toArray(void) const;
+
+      /// <summary>
+      /// Write [q, dq] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 2 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = q;
+        *pIt++ = dq;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [q, dq] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        q = *pIt++;
+        dq = *pIt++;
+        return pIt;
+      }
     };
 
   }
@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALQUATERNION_H_
 #define _LIBALMATH_ALMATH_TYPES_ALQUATERNION_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -103,6 +105,21 @@ namespace AL {
       /// </param>
       Quaternion(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Quaternion from an std::array [w, x, y, z].
+      /// </summary>
+      /// <param name="pFloats"> the array of 4 floats </param>
+      explicit Quaternion(const std::array<float, 4>& pFloats);
+
+      /// <summary>
+      /// Create a Quaternion from pSize floats [w, x, y, z].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 4 </param>
+      Quaternion(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator *= for Quaternion.
       /// </summary>
@@ -224,6 +241,43 @@ namespace AL {
       /// </summary>
       void toVector(std::vector<float>& pReturnVector) const;
       std::vector<float> toVector(void) const;
+
+      /// <summary>
+      /// Return the Quaternion as an std::array of float [w, x, y, z].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 4> toArray(void) const;
+
+      /// <summary>
+      /// Write [w, x, y, z] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 4 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = w;
+        *pIt++ = x;
+        *pIt++ = y;
+        *pIt++ = z;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [w, x, y, z] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        w = *pIt++;
+        x = *pIt++;
+        y = *pIt++;
+        z = *pIt++;
+        return pIt;
+      }
     };
 
     /// <summary>
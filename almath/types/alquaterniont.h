@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALQUATERNIONT_H_
+#define _LIBALMATH_ALMATH_TYPES_ALQUATERNIONT_H_
+
+#include <almath/types/alquaternion.h>
+#include <cmath>
+#include <stdexcept>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A Quaternion with a templated scalar type.
+    ///
+    /// QuaternionT<float> has the layout of Quaternion. Quaterniond is the
+    /// double precision version.
+    /// </summary>
+    /// \ingroup Types
+    template <typename S>
+    struct QuaternionT {
+      typedef S Scalar;
+
+      /// <summary> </summary>
+      S w;
+      /// <summary> </summary>
+      S x;
+      /// <summary> </summary>
+      S y;
+      /// <summary> </summary>
+      S z;
+
+      /// <summary>
+      /// Create a QuaternionT initialized to identity (1, 0, 0, 0).
+      /// </summary>
+      QuaternionT() : w(S(1)), x(S(0)), y(S(0)), z(S(0)) {}
+
+      /// <summary>
+      /// Create a QuaternionT with explicit values.
+      /// </summary>
+      QuaternionT(S pW, S pX, S pY, S pZ) : w(pW), x(pX), y(pY), z(pZ) {}
+
+      /// <summary>
+      /// Convert a QuaternionT of another scalar type.
+      /// </summary>
+      template <typename U>
+      explicit QuaternionT(const QuaternionT<U>& pQua)
+        : w(static_cast<S>(pQua.w)),
+          x(static_cast<S>(pQua.x)),
+          y(static_cast<S>(pQua.y)),
+          z(static_cast<S>(pQua.z)) {}
+
+      /// <summary>
+      /// Convert a Quaternion.
+      /// </summary>
+      explicit QuaternionT(const Quaternion& pQua)
+        : w(static_cast<S>(pQua.w)),
+          x(static_cast<S>(pQua.x)),
+          y(static_cast<S>(pQua.y)),
+          z(static_cast<S>(pQua.z)) {}
+
+      /// <summary>
+      /// Convert to a Quaternion.
+      /// </summary>
+      Quaternion toQuaternion() const
+      {
+        return Quaternion(static_cast<float>(w),
+                          static_cast<float>(x),
+                          static_cast<float>(y),
+                          static_cast<float>(z));
+      }
+
+      QuaternionT operator* (const QuaternionT& pQua2) const
+      {
+        return QuaternionT(
+              w*pQua2.w - x*pQua2.x - y*pQua2.y - z*pQua2.z,
+              w*pQua2.x + pQua2.w*x + y*pQua2.z - z*pQua2.y,
+              w*pQua2.y + pQua2.w*y + z*pQua2.x - x*pQua2.z,
+              w*pQua2.z + pQua2.w*z + x*pQua2.y - y*pQua2.x);
+      }
+
+      QuaternionT& operator*= (const QuaternionT& pQua2)
+      {
+        *this = *this * pQua2;
+        return *this;
+      }
+
+      QuaternionT operator* (S pVal) const
+      {
+        return QuaternionT(w*pVal, x*pVal, y*pVal, z*pVal);
+      }
+
+      QuaternionT operator/ (S pVal) const
+      {
+        if (pVal == S(0))
+        {
+          throw std::runtime_error(
+            "ALQuaternion: operator/ Division by zero.");
+        }
+        return *this * (S(1)/pVal);
+      }
+
+      bool operator== (const QuaternionT& pQua2) const
+      {
+        return (w == pQua2.w &&
+                x == pQua2.x &&
+                y == pQua2.y &&
+                z == pQua2.z);
+      }
+
+      bool operator!= (const QuaternionT& pQua2) const
+      {
+        return !(*this==pQua2);
+      }
+
+      /// <summary>
+      /// Check if the actual QuaternionT is near the one
+      /// given in argument. q and -q are not near.
+      /// </summary>
+      bool isNear(
+        const QuaternionT& pQua2,
+        const S&           pEpsilon=S(0.0001)) const
+      {
+        return (std::abs(w - pQua2.w) <= pEpsilon &&
+                std::abs(x - pQua2.x) <= pEpsilon &&
+                std::abs(y - pQua2.y) <= pEpsilon &&
+                std::abs(z - pQua2.z) <= pEpsilon);
+      }
+
+      S norm() const
+      {
+        return std::sqrt(w*w + x*x + y*y + z*z);
+      }
+
+      QuaternionT normalize() const
+      {
+        const S lNorm = norm();
+        if (lNorm == S(0))
+        {
+          throw std::runtime_error(
+            "ALQuaternion: normalize Division by zero.");
+        }
+        return *this/lNorm;
+      }
+
+      /// <summary>
+      /// Return the inverse of a unit QuaternionT (its conjugate).
+      /// </summary>
+      QuaternionT inverse() const
+      {
+        return QuaternionT(w, -x, -y, -z);
+      }
+
+      /// <summary>
+      /// Create a QuaternionT from an angle and a rotation axis.
+      /// </summary>
+      static QuaternionT fromAngleAndAxisRotation(
+        S pAngle, S pAxisX, S pAxisY, S pAxisZ)
+      {
+        const S lSin = std::sin(S(0.5)*pAngle);
+        return QuaternionT(std::cos(S(0.5)*pAngle), pAxisX*lSin,
+                           pAxisY*lSin, pAxisZ*lSin).normalize();
+      }
+    };
+
+    template <typename S>
+    S norm(const QuaternionT<S>& pQua)
+    {
+      return pQua.norm();
+    }
+
+    template <typename S>
+    QuaternionT<S> normalize(const QuaternionT<S>& pQua)
+    {
+      return pQua.normalize();
+    }
+
+    template <typename S>
+    QuaternionT<S> quaternionInverse(const QuaternionT<S>& pQua)
+    {
+      return pQua.inverse();
+    }
+
+    /// \ingroup Types
+    typedef QuaternionT<double> Quaterniond;
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALQUATERNIONT_H_
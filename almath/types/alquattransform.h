@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALQUATTRANSFORM_H_
+#define _LIBALMATH_ALMATH_TYPES_ALQUATTRANSFORM_H_
+
+#include <almath/api.h>
+#include <almath/types/aldisplacement.h>
+#include <almath/types/alposition3d.h>
+#include <almath/types/alposition6d.h>
+#include <almath/types/alquaternion.h>
+#include <almath/types/altransform.h>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A rigid transform stored as a unit Quaternion and a translation.
+    ///
+    /// With 7 floats instead of 12, a QuatTransform is cheaper to store and
+    /// to load than a Transform, its composition costs 34 multiplications
+    /// instead of 36, and the rotation drift of long composition chains is
+    /// removed with a single quaternion normalization (see
+    /// normalizeQuatTransform) instead of a Gram-Schmidt of the matrix.
+    ///
+    /// The transform of a point p is rotation * p + translation.
+    /// </summary>
+    /// \ingroup Types
+    struct ALMATH_API QuatTransform
+    {
+      /// <summary> the rotation part, a unit Quaternion </summary>
+      Quaternion rotation;
+      /// <summary> the translation part </summary>
+      Position3D translation;
+
+      /// <summary>
+      /// Create the identity QuatTransform.
+      /// </summary>
+      QuatTransform();
+
+      /// <summary>
+      /// Create a QuatTransform from its rotation and translation.
+      /// </summary>
+      /// <param name="pRotation"> the rotation, a unit Quaternion </param>
+      /// <param name="pTranslation"> the translation </param>
+      QuatTransform(
+        const Quaternion& pRotation,
+        const Position3D& pTranslation = Position3D());
+
+      /// <summary>
+      /// Overloading of operator *= for QuatTransform: the composition
+      /// this * pQT2.
+      /// </summary>
+      /// <param name="pQT2"> the second QuatTransform </param>
+      QuatTransform& operator*= (const QuatTransform& pQT2);
+
+      /// <summary>
+      /// Overloading of operator * for QuatTransform: the composition
+      /// this * pQT2.
+      /// </summary>
+      /// <param name="pQT2"> the second QuatTransform </param>
+      QuatTransform operator* (const QuatTransform& pQT2) const;
+
+      /// <summary>
+      /// Apply the QuatTransform to a point:
+      /// rotation * pPos + translation.
+      /// </summary>
+      /// <param name="pPos"> the point </param>
+      Position3D operator* (const Position3D& pPos) const;
+
+      /// <summary>
+      /// Check if the actual QuatTransform is near the one given in
+      /// argument. The Quaternion q and -q are the same rotation.
+      /// </summary>
+      /// <param name="pQT2"> the second QuatTransform </param>
+      /// <param name="pEpsilon"> an optional epsilon distance </param>
+      /// <returns>
+      /// true if the difference of each float of the two QuatTransform is
+      /// less than pEpsilon
+      /// </returns>
+      bool isNear(
+        const QuatTransform& pQT2,
+        const float&         pEpsilon=0.0001f) const;
+
+      /// <summary>
+      /// Return the inverse of the QuatTransform, assuming the rotation is
+      /// a unit Quaternion.
+      /// </summary>
+      QuatTransform inverse() const;
+
+      /// <summary>
+      /// Normalize the rotation part, to remove the drift accumulated by
+      /// compositions.
+      /// </summary>
+      void normalizeQuatTransform(void);
+    };
+
+    /// <summary>
+    /// Rotate a point by the rotation part of a QuatTransform.
+    ///
+    /// Uses \f$ t = 2 v \times p \f$,
+    /// \f$ p' = p + w t + v \times t \f$, where (w, v) is the Quaternion:
+    /// 18 multiplications.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <param name="pPos"> the point </param>
+    /// <returns>
+    /// the rotated point, without translation
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Position3D quatTransformRotate(
+      const QuatTransform& pQT,
+      const Position3D&    pPos);
+
+    /// <summary>
+    /// Compute the inverse of a QuatTransform, assuming the rotation is a
+    /// unit Quaternion.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <param name="pQTOut"> the inverse </param>
+    /// \ingroup Types
+    ALMATH_API void quatTransformInverse(
+      const QuatTransform& pQT,
+      QuatTransform&       pQTOut);
+
+    /// <summary>
+    /// Return the inverse of a QuatTransform, assuming the rotation is a
+    /// unit Quaternion.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <returns>
+    /// the inverse
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API QuatTransform quatTransformInverse(const QuatTransform& pQT);
+
+    /// <summary>
+    /// Normalize the rotation part of a QuatTransform.
+    /// Throw a std::runtime_error if the Quaternion is null.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform to normalize </param>
+    /// \ingroup Types
+    ALMATH_API void normalizeQuatTransform(QuatTransform& pQT);
+
+    /// <summary>
+    /// Create a QuatTransform from a Transform.
+    /// </summary>
+    /// <param name="pT"> the Transform, with an orthonormal rotation </param>
+    /// <returns>
+    /// the QuatTransform
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API QuatTransform quatTransformFromTransform(const Transform& pT);
+
+    /// <summary>
+    /// Create a Transform from a QuatTransform.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <returns>
+    /// the Transform
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Transform transformFromQuatTransform(const QuatTransform& pQT);
+
+    /// <summary>
+    /// Create a QuatTransform from a Position6D, with the convention of
+    /// transformFromPosition6D: the rotation is Rz(wz)*Ry(wy)*Rx(wx).
+    /// The Quaternion is computed directly from the half angles.
+    /// </summary>
+    /// <param name="pPos"> the Position6D </param>
+    /// <returns>
+    /// the QuatTransform
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API QuatTransform quatTransformFromPosition6D(
+      const Position6D& pPos);
+
+    /// <summary>
+    /// Create a Position6D from a QuatTransform, with the convention of
+    /// position6DFromTransform.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <returns>
+    /// the Position6D
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Position6D position6DFromQuatTransform(
+      const QuatTransform& pQT);
+
+    /// <summary>
+    /// Create a QuatTransform from a Displacement. Both hold the same
+    /// data: the conversion is exact.
+    /// </summary>
+    /// <param name="pDisp"> the Displacement </param>
+    /// <returns>
+    /// the QuatTransform
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API QuatTransform quatTransformFromDisplacement(
+      const Displacement& pDisp);
+
+    /// <summary>
+    /// Create a Displacement from a QuatTransform. Both hold the same
+    /// data: the conversion is exact.
+    /// </summary>
+    /// <param name="pQT"> the QuatTransform </param>
+    /// <returns>
+    /// the Displacement
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Displacement displacementFromQuatTransform(
+      const QuatTransform& pQT);
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALQUATTRANSFORM_H_
@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALROTATION_H_
 #define _LIBALMATH_ALMATH_TYPES_ALROTATION_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -126,6 +128,23 @@ namespace AL {
       /// </param>
       Rotation (const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Rotation from an std::array
+      /// [r1_c1, r1_c2, r1_c3, r2_c1, ..., r3_c3].
+      /// </summary>
+      /// <param name="pFloats"> the array of 9 floats </param>
+      explicit Rotation(const std::array<float, 9>& pFloats);
+
+      /// <summary>
+      /// Create a Rotation from pSize floats
+      /// laid out as for the std::vector constructor.
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 9, 12 or 16 </param>
+      Rotation(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator *= for Rotation.
       /// </summary>
@@ -337,6 +356,56 @@ namespace AL {
       void toVector(std::vector<float>& pReturnValue) const;
       std::vector<float> toVector(void) const;
 
+      /// <summary>
+      /// Return the Rotation as an std::array of float
+      /// [r1_c1, r1_c2, r1_c3, r2_c1, ..., r3_c3].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 9> toArray(void) const;
+
+      /// <summary>
+      /// Write [r1_c1, r1_c2, r1_c3, r2_c1, ..., r3_c3] to an output iterator,
+      /// a float* for instance.
+      /// It is assumed the destination has room for 9 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = r1_c1;
+        *pIt++ = r1_c2;
+        *pIt++ = r1_c3;
+        *pIt++ = r2_c1;
+        *pIt++ = r2_c2;
+        *pIt++ = r2_c3;
+        *pIt++ = r3_c1;
+        *pIt++ = r3_c2;
+        *pIt++ = r3_c3;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [r1_c1, r1_c2, r1_c3, r2_c1, ..., r3_c3] from an input iterator,
+      /// a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        r1_c1 = *pIt++;
+        r1_c2 = *pIt++;
+        r1_c3 = *pIt++;
+        r2_c1 = *pIt++;
+        r2_c2 = *pIt++;
+        r2_c3 = *pIt++;
+        r3_c1 = *pIt++;
+        r3_c2 = *pIt++;
+        r3_c3 = *pIt++;
+        return pIt;
+      }
+
     }; // end struct
 
     /// <summary>
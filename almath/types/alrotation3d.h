@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALROTATION3D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALROTATION3D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -111,6 +113,21 @@ namespace AL {
       /// </param>
       Rotation3D (const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Rotation3D from an std::array [wx, wy, wz].
+      /// </summary>
+      /// <param name="pFloats"> the array of 3 floats </param>
+      explicit Rotation3D(const std::array<float, 3>& pFloats);
+
+      /// <summary>
+      /// Create a Rotation3D from pSize floats [wx, wy, wz].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 3 </param>
+      Rotation3D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator + for Rotation3D.
       /// </summary>
@@ -215,6 +232,41 @@ namespace AL {
       /// </summary>
       void toVector(std::vector<float>& pReturnVector) const;
       std::vector<float> toVector(void) const;
+
+      /// <summary>
+      /// Return the Rotation3D as an std::array of float [wx, wy, wz].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 3> toArray(void) const;
+
+      /// <summary>
+      /// Write [wx, wy, wz] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 3 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = wx;
+        *pIt++ = wy;
+        *pIt++ = wz;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [wx, wy, wz] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        wx = *pIt++;
+        wy = *pIt++;
+        wz = *pIt++;
+        return pIt;
+      }
     };
 
     /// <summary>
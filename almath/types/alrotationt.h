@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALROTATIONT_H_
+#define _LIBALMATH_ALMATH_TYPES_ALROTATIONT_H_
+
+#include <almath/types/alrotation.h>
+#include <almath/types/alposition3dt.h>
+#include <almath/types/alquaterniont.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A Rotation with a templated scalar type.
+    ///
+    /// RotationT<float> has the layout of Rotation. Rotationd is the
+    /// double precision version.
+    /// </summary>
+    /// \ingroup Types
+    template <typename S>
+    struct RotationT {
+      typedef S Scalar;
+
+      /** \cond PRIVATE */
+      S r1_c1, r1_c2, r1_c3;
+      S r2_c1, r2_c2, r2_c3;
+      S r3_c1, r3_c2, r3_c3;
+      /** \endcond */
+
+      /// <summary>
+      /// Create a RotationT initialized to identity.
+      /// </summary>
+      RotationT()
+        : r1_c1(S(1)), r1_c2(S(0)), r1_c3(S(0)),
+          r2_c1(S(0)), r2_c2(S(1)), r2_c3(S(0)),
+          r3_c1(S(0)), r3_c2(S(0)), r3_c3(S(1)) {}
+
+      /// <summary>
+      /// Convert a RotationT of another scalar type.
+      /// </summary>
+      template <typename U>
+      explicit RotationT(const RotationT<U>& pRot)
+      {
+        xCopy(pRot);
+      }
+
+      /// <summary>
+      /// Convert a Rotation.
+      /// </summary>
+      explicit RotationT(const Rotation& pRot)
+      {
+        xCopy(pRot);
+      }
+
+      /// <summary>
+      /// Convert to a Rotation.
+      /// </summary>
+      Rotation toRotation() const
+      {
+        Rotation lRot;
+        lRot.r1_c1 = static_cast<float>(r1_c1);
+        lRot.r1_c2 = static_cast<float>(r1_c2);
+        lRot.r1_c3 = static_cast<float>(r1_c3);
+        lRot.r2_c1 = static_cast<float>(r2_c1);
+        lRot.r2_c2 = static_cast<float>(r2_c2);
+        lRot.r2_c3 = static_cast<float>(r2_c3);
+        lRot.r3_c1 = static_cast<float>(r3_c1);
+        lRot.r3_c2 = static_cast<float>(r3_c2);
+        lRot.r3_c3 = static_cast<float>(r3_c3);
+        return lRot;
+      }
+
+      RotationT operator* (const RotationT& pRot2) const
+      {
+        RotationT lRot;
+        lRot.r1_c1 = r1_c1*pRot2.r1_c1 + r1_c2*pRot2.r2_c1 + r1_c3*pRot2.r3_c1;
+        lRot.r1_c2 = r1_c1*pRot2.r1_c2 + r1_c2*pRot2.r2_c2 + r1_c3*pRot2.r3_c2;
+        lRot.r1_c3 = r1_c1*pRot2.r1_c3 + r1_c2*pRot2.r2_c3 + r1_c3*pRot2.r3_c3;
+        lRot.r2_c1 = r2_c1*pRot2.r1_c1 + r2_c2*pRot2.r2_c1 + r2_c3*pRot2.r3_c1;
+        lRot.r2_c2 = r2_c1*pRot2.r1_c2 + r2_c2*pRot2.r2_c2 + r2_c3*pRot2.r3_c2;
+        lRot.r2_c3 = r2_c1*pRot2.r1_c3 + r2_c2*pRot2.r2_c3 + r2_c3*pRot2.r3_c3;
+        lRot.r3_c1 = r3_c1*pRot2.r1_c1 + r3_c2*pRot2.r2_c1 + r3_c3*pRot2.r3_c1;
+        lRot.r3_c2 = r3_c1*pRot2.r1_c2 + r3_c2*pRot2.r2_c2 + r3_c3*pRot2.r3_c2;
+        lRot.r3_c3 = r3_c1*pRot2.r1_c3 + r3_c2*pRot2.r2_c3 + r3_c3*pRot2.r3_c3;
+        return lRot;
+      }
+
+      RotationT& operator*= (const RotationT& pRot2)
+      {
+        *this = *this * pRot2;
+        return *this;
+      }
+
+      /// <summary>
+      /// Apply the RotationT to a Position3DT.
+      /// </summary>
+      Position3DT<S> operator* (const Position3DT<S>& pPos) const
+      {
+        return Position3DT<S>(r1_c1*pPos.x + r1_c2*pPos.y + r1_c3*pPos.z,
+                              r2_c1*pPos.x + r2_c2*pPos.y + r2_c3*pPos.z,
+                              r3_c1*pPos.x + r3_c2*pPos.y + r3_c3*pPos.z);
+      }
+
+      bool operator== (const RotationT& pRot2) const
+      {
+        return isNear(pRot2, S(0));
+      }
+
+      bool operator!= (const RotationT& pRot2) const
+      {
+        return !(*this==pRot2);
+      }
+
+      /// <summary>
+      /// Check if the actual RotationT is near the one
+      /// given in argument.
+      /// </summary>
+      bool isNear(
+        const RotationT& pRot2,
+        const S&         pEpsilon=S(0.0001)) const
+      {
+        return (std::abs(r1_c1 - pRot2.r1_c1) <= pEpsilon &&
+                std::abs(r1_c2 - pRot2.r1_c2) <= pEpsilon &&
+                std::abs(r1_c3 - pRot2.r1_c3) <= pEpsilon &&
+                std::abs(r2_c1 - pRot2.r2_c1) <= pEpsilon &&
+                std::abs(r2_c2 - pRot2.r2_c2) <= pEpsilon &&
+                std::abs(r2_c3 - pRot2.r2_c3) <= pEpsilon &&
+                std::abs(r3_c1 - pRot2.r3_c1) <= pEpsilon &&
+                std::abs(r3_c2 - pRot2.r3_c2) <= pEpsilon &&
+                std::abs(r3_c3 - pRot2.r3_c3) <= pEpsilon);
+      }
+
+      RotationT transpose() const
+      {
+        RotationT lRot;
+        lRot.r1_c1 = r1_c1; lRot.r1_c2 = r2_c1; lRot.r1_c3 = r3_c1;
+        lRot.r2_c1 = r1_c2; lRot.r2_c2 = r2_c2; lRot.r2_c3 = r3_c2;
+        lRot.r3_c1 = r1_c3; lRot.r3_c2 = r2_c3; lRot.r3_c3 = r3_c3;
+        return lRot;
+      }
+
+      S determinant() const
+      {
+        return r1_c1*(r2_c2*r3_c3 - r2_c3*r3_c2) -
+            r1_c2*(r2_c1*r3_c3 - r2_c3*r3_c1) +
+            r1_c3*(r2_c1*r3_c2 - r2_c2*r3_c1);
+      }
+
+      /// <summary>
+      /// Create a RotationT from a unit QuaternionT.
+      /// </summary>
+      static RotationT fromQuaternion(const QuaternionT<S>& pQua)
+      {
+        const S t2 =  pQua.w*pQua.x;
+        const S t3 =  pQua.w*pQua.y;
+        const S t4 =  pQua.w*pQua.z;
+        const S t5 = -pQua.x*pQua.x;
+        const S t6 =  pQua.x*pQua.y;
+        const S t7 =  pQua.x*pQua.z;
+        const S t8 = -pQua.y*pQua.y;
+        const S t9 =  pQua.y*pQua.z;
+        const S t10= -pQua.z*pQua.z;
+        RotationT lRot;
+        lRot.r1_c1 = S(2)*(t8 + t10) + S(1);
+        lRot.r1_c2 = S(2)*(t6 - t4);
+        lRot.r1_c3 = S(2)*(t7 + t3);
+        lRot.r2_c1 = S(2)*(t6 + t4);
+        lRot.r2_c2 = S(2)*(t5 + t10) + S(1);
+        lRot.r2_c3 = S(2)*(t9 - t2);
+        lRot.r3_c1 = S(2)*(t7 - t3);
+        lRot.r3_c2 = S(2)*(t9 + t2);
+        lRot.r3_c3 = S(2)*(t5 + t8) + S(1);
+        return lRot;
+      }
+
+      static RotationT fromRotX(S pRotX)
+      {
+        RotationT lRot;
+        lRot.r2_c2 = std::cos(pRotX);
+        lRot.r2_c3 = -std::sin(pRotX);
+        lRot.r3_c2 = -lRot.r2_c3;
+        lRot.r3_c3 = lRot.r2_c2;
+        return lRot;
+      }
+
+      static RotationT fromRotY(S pRotY)
+      {
+        RotationT lRot;
+        lRot.r1_c1 = std::cos(pRotY);
+        lRot.r1_c3 = std::sin(pRotY);
+        lRot.r3_c1 = -lRot.r1_c3;
+        lRot.r3_c3 = lRot.r1_c1;
+        return lRot;
+      }
+
+      static RotationT fromRotZ(S pRotZ)
+      {
+        RotationT lRot;
+        lRot.r1_c1 = std::cos(pRotZ);
+        lRot.r1_c2 = -std::sin(pRotZ);
+        lRot.r2_c1 = -lRot.r1_c2;
+        lRot.r2_c2 = lRot.r1_c1;
+        return lRot;
+      }
+
+    private:
+      template <typename Other>
+      void xCopy(const Other& pRot)
+      {
+        r1_c1 = static_cast<S>(pRot.r1_c1);
+        r1_c2 = static_cast<S>(pRot.r1_c2);
+        r1_c3 = static_cast<S>(pRot.r1_c3);
+        r2_c1 = static_cast<S>(pRot.r2_c1);
+        r2_c2 = static_cast<S>(pRot.r2_c2);
+        r2_c3 = static_cast<S>(pRot.r2_c3);
+        r3_c1 = static_cast<S>(pRot.r3_c1);
+        r3_c2 = static_cast<S>(pRot.r3_c2);
+        r3_c3 = static_cast<S>(pRot.r3_c3);
+      }
+    };
+
+    template <typename S>
+    RotationT<S> transpose(const RotationT<S>& pRot)
+    {
+      return pRot.transpose();
+    }
+
+    template <typename S>
+    S determinant(const RotationT<S>& pRot)
+    {
+      return pRot.determinant();
+    }
+
+    /// \ingroup Types
+    typedef RotationT<double> Rotationd;
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALROTATIONT_H_
@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALTRANSFORM_H_
 #define _LIBALMATH_ALMATH_TYPES_ALTRANSFORM_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -71,6 +73,24 @@ namespace AL {
        */
       explicit Transform(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Transform from an std::array of 12 or 16 floats, laid out
+      /// as for the std::vector constructor.
+      /// </summary>
+      /// <param name="pFloats"> the array of floats </param>
+      explicit Transform(const std::array<float, 12>& pFloats);
+      explicit Transform(const std::array<float, 16>& pFloats);
+
+      /// <summary>
+      /// Create a Transform from pSize floats
+      /// laid out as for the std::vector constructor.
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 12 or 16 </param>
+      Transform(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Create a Transform initialized with explicit value for translation
       /// part. Rotation part is set to identity.
@@ -201,6 +221,15 @@ namespace AL {
       /// </returns>
       Transform inverse() const;
 
+      /// <summary>
+      /// Compute the inverse of the actual Transform, which must be a rigid
+      /// motion. See transformInverseRigid.
+      /// </summary>
+      /// <returns>
+      /// the Transform inverse
+      /// </returns>
+      Transform inverseRigid() const;
+
       /// <summary>
       /// Create a Transform initialized with explicit rotation around x axis.
       ///
@@ -371,6 +400,82 @@ namespace AL {
       /// It is assumed the vector has enough space.
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
+
+      /// <summary>
+      /// Return the Transform as an std::array of float
+      /// [r1_c1, r1_c2, r1_c3, r1_c4, ..., r3_c4, 0, 0, 0, 1].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 16> toArray(void) const;
+
+      /// <summary>
+      /// Write [r1_c1, r1_c2, r1_c3, r1_c4, ..., r3_c4, 0, 0, 0, 1] to an
+      /// output iterator, a float* for instance.
+      /// It is assumed the destination has room for 16 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = r1_c1;
+        *pIt++ = r1_c2;
+        *pIt++ = r1_c3;
+        *pIt++ = r1_c4;
+        *pIt++ = r2_c1;
+        *pIt++ = r2_c2;
+        *pIt++ = r2_c3;
+        *pIt++ = r2_c4;
+        *pIt++ = r3_c1;
+        *pIt++ = r3_c2;
+        *pIt++ = r3_c3;
+        *pIt++ = r3_c4;
+        *pIt++ = 0.0f;
+        *pIt++ = 0.0f;
+        *pIt++ = 0.0f;
+        *pIt++ = 1.0f;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [r1_c1, r1_c2, r1_c3, r1_c4, ..., r3_c4] from an input iterator,
+      /// a const float* for instance.
+      /// The rotation part is not normalized: the floats written by writeTo
+      /// can be read back.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        r1_c1 = *pIt++;
+        r1_c2 = *pIt++;
+        r1_c3 = *pIt++;
+        r1_c4 = *pIt++;
+        r2_c1 = *pIt++;
+        r2_c2 = *pIt++;
+        r2_c3 = *pIt++;
+        r2_c4 = *pIt++;
+        r3_c1 = *pIt++;
+        r3_c2 = *pIt++;
+        r3_c3 = *pIt++;
+        r3_c4 = *pIt++;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Create a Transform from [r1_c1, r1_c2, r1_c3, r1_c4, ..., r3_c4],
+      /// without any check. Contrary to the constructors from floats, the
+      /// rotation part is neither checked nor normalized, and nothing is
+      /// reported (see alerrorpolicy.h): for hot paths with trusted data.
+      /// </summary>
+      /// <param name="pFloats"> pointer to the 12 floats </param>
+      static Transform fromFloatsUnchecked(const float* pFloats)
+      {
+        Transform lT;
+        lT.readFrom(pFloats);
+        return lT;
+      }
     }; // end struct
 
     /// <summary>
@@ -405,7 +510,7 @@ namespace AL {
     ALMATH_API void normalizeTransform(Transform& pT);
 
     /// <summary>
-    /// DEPRECATED: Use toVector function.
+    /// DEPRECATED: Use toVector or toArray function.
     /// Copy the Transform in a vector of float:
     ///
     /** \f$ \begin{array}{cccc}
@@ -425,7 +530,7 @@ namespace AL {
       std::vector<float>& pTOut);
 
     /// <summary>
-    /// DEPRECATED: Use toVector function.
+    /// DEPRECATED: Use toVector or toArray function.
     /// Return the Transform in a vector of float:
     ///
     /**
@@ -523,6 +628,127 @@ namespace AL {
     /// \ingroup Types
     ALMATH_API Transform transformInverse(const Transform& pT);
 
+    /// <summary>
+    /// Return the inverse of a rigid motion (R, r): (R^t, -R^t*r).
+    ///
+    /// This is what transformInverse computes; the Rigid functions state
+    /// that pT is a rigid motion, and check it in the builds of the library
+    /// without NDEBUG: see setRigidTransformCheck.
+    /// </summary>
+    /// <param name="pT"> the given rigid Transform </param>
+    /// <param name="pTOut"> the inverse of the given Transform </param>
+    /// \ingroup Types
+    ALMATH_API void transformInverseRigid(
+      const Transform& pT,
+      Transform&       pTOut);
+
+    /// <summary>
+    /// Return the inverse of a rigid motion (R, r): (R^t, -R^t*r).
+    /// See transformInverseRigid(const Transform&, Transform&).
+    /// </summary>
+    /// <param name="pT"> the given rigid Transform </param>
+    /// <returns>
+    /// the Transform inverse
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Transform transformInverseRigid(const Transform& pT);
+
+    /// <summary>
+    /// Inverse an array of rigid motions.
+    ///
+    /// pTOut[i] = pT[i]^-1
+    ///
+    /// pTOut may be equal to pT. The kernels are looked up once for the
+    /// whole array.
+    /// </summary>
+    /// <param name="pT"> the given rigid Transforms </param>
+    /// <param name="pTOut"> the inverses, pSize Transforms </param>
+    /// <param name="pSize"> the number of Transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformInverseRigid(
+      const Transform* pT,
+      Transform*       pTOut,
+      std::size_t      pSize);
+
+    /// <summary>
+    /// Compose the inverse of a rigid motion with a Transform, without
+    /// computing the inverse:
+    ///
+    /// pTOut = pT1^-1 * pT2 = (R1^t*R2, R1^t*(r2 - r1))
+    ///
+    /// This is the change of frame of pT2 from the frame of pT1 to its
+    /// parent frame. It gives the result of transformDiff, up to rounding.
+    /// pTOut may be the same object as pT1 or pT2.
+    /// </summary>
+    /// <param name="pT1"> the rigid Transform to inverse </param>
+    /// <param name="pT2"> the right hand side Transform </param>
+    /// <param name="pTOut"> the composed Transform </param>
+    /// \ingroup Types
+    ALMATH_API void transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform& pT2,
+      Transform&       pTOut);
+
+    /// <summary>
+    /// Compose the inverse of a rigid motion with a Transform.
+    /// See transformInverseRigidMultiply(const Transform&, const Transform&,
+    /// Transform&).
+    /// </summary>
+    /// <param name="pT1"> the rigid Transform to inverse </param>
+    /// <param name="pT2"> the right hand side Transform </param>
+    /// <returns>
+    /// pT1^-1 * pT2
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API Transform transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform& pT2);
+
+    /// <summary>
+    /// Compose the inverse of a rigid motion with each Transform of an
+    /// array.
+    ///
+    /// pTOut[i] = pT1^-1 * pT2[i]
+    ///
+    /// pTOut may be equal to pT2.
+    /// </summary>
+    /// <param name="pT1"> the rigid Transform to inverse </param>
+    /// <param name="pT2"> the right hand side Transforms </param>
+    /// <param name="pTOut"> the composed Transforms, pSize Transforms </param>
+    /// <param name="pSize"> the number of Transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform* pT2,
+      Transform*       pTOut,
+      std::size_t      pSize);
+
+    /// <summary>
+    /// The check of the Rigid functions, called with the Transform which
+    /// must be a rigid motion and the name of the calling function.
+    /// </summary>
+    /// \ingroup Types
+    typedef void (*RigidTransformCheck)(const Transform& pT,
+                                        const char*      pFunction);
+
+    /// <summary>
+    /// Replace the check of the Rigid functions (transformInverseRigid,
+    /// transformInverseRigidMultiply, Transform::inverseRigid).
+    ///
+    /// The check only runs in the builds of the library without NDEBUG.
+    /// The default check throws a std::runtime_error when
+    /// Transform::isTransform(0.0001f) is false. A null pCheck disables the
+    /// check.
+    /// This function is not thread safe with the functions it affects.
+    /// </summary>
+    /// <param name="pCheck"> the new check </param>
+    /// <returns>
+    /// the previous check
+    /// </returns>
+    /// \ingroup Types
+    ALMATH_API RigidTransformCheck setRigidTransformCheck(
+      RigidTransformCheck pCheck);
+
 
     /// <summary>
     /// Create a Transform initialize with explicit rotation around x axis:
@@ -735,4 +961,9 @@ namespace AL {
 
   } // end namespace Math
 } // end namespace AL
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/altransform.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TYPES_ALTRANSFORM_H_
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALTRANSFORMBATCH_H_
+#define _LIBALMATH_ALMATH_TYPES_ALTRANSFORMBATCH_H_
+
+#include <cstddef>
+#include <vector>
+#include <almath/api.h>
+#include <almath/types/altransform.h>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A batch of homogenous transformation matrices stored as a
+    /// structure of arrays.
+    ///
+    /// Each of the 12 coefficients r1_c1 ... r3_c4 of the batch is stored in
+    /// its own contiguous array, so that the batched kernels
+    /// (transformMultiply, transformInverse and transformPreMultiply)
+    /// process several transforms with each vector instruction.
+    ///
+    /// The arrays are padded to a multiple of TransformBatch::LANES
+    /// elements. The kernels also process the padding elements, which are
+    /// never returned to the user.
+    /// </summary>
+    /// \ingroup Types
+    class ALMATH_API TransformBatch {
+    public:
+      /// <summary>
+      /// The number of transforms processed together by the batched kernels.
+      /// </summary>
+      static const std::size_t LANES = 8u;
+
+      /// <summary>
+      /// The number of stored coefficients of a transform.
+      /// </summary>
+      static const std::size_t COEFFICIENTS = 12u;
+
+      /// <summary>
+      /// Index of each coefficient array, in row major order.
+      /// </summary>
+      enum Coefficient {
+        R1_C1 = 0, R1_C2, R1_C3, R1_C4,
+        R2_C1, R2_C2, R2_C3, R2_C4,
+        R3_C1, R3_C2, R3_C3, R3_C4
+      };
+
+      /// <summary>
+      /// Create an empty TransformBatch.
+      /// </summary>
+      TransformBatch();
+
+      /// <summary>
+      /// Create a TransformBatch of pSize identity transforms.
+      /// </summary>
+      /// <param name="pSize"> the number of transforms </param>
+      explicit TransformBatch(std::size_t pSize);
+
+      /// <summary>
+      /// Create a TransformBatch from an std::vector of Transform.
+      /// </summary>
+      /// <param name="pTransforms"> the transforms to copy </param>
+      explicit TransformBatch(const std::vector<Transform>& pTransforms);
+
+      /// <summary>
+      /// Return the number of transforms in the batch.
+      /// </summary>
+      inline std::size_t size() const
+      {
+        return fSize;
+      }
+
+      /// <summary>
+      /// Return true if the batch holds no transform.
+      /// </summary>
+      inline bool empty() const
+      {
+        return fSize == 0u;
+      }
+
+      /// <summary>
+      /// Resize the batch. New transforms are set to identity.
+      /// Memory is only reallocated when the padded size grows.
+      /// </summary>
+      /// <param name="pSize"> the new number of transforms </param>
+      void resize(std::size_t pSize);
+
+      /// <summary>
+      /// Return the contiguous array of one coefficient.
+      /// The array holds size() meaningful values.
+      /// </summary>
+      /// <param name="pCoeff"> the coefficient </param>
+      inline float* data(Coefficient pCoeff)
+      {
+        return fData.empty() ? 0 : &fData[pCoeff * fStride];
+      }
+
+      /// <summary>
+      /// Return the contiguous array of one coefficient.
+      /// The array holds size() meaningful values.
+      /// </summary>
+      /// <param name="pCoeff"> the coefficient </param>
+      inline const float* data(Coefficient pCoeff) const
+      {
+        return fData.empty() ? 0 : &fData[pCoeff * fStride];
+      }
+
+      /// <summary>
+      /// Return the distance, in floats, between two coefficient arrays.
+      /// It is a multiple of LANES.
+      /// </summary>
+      inline std::size_t stride() const
+      {
+        return fStride;
+      }
+
+      /// <summary>
+      /// Get a copy of the transform at the given index.
+      /// </summary>
+      /// <param name="pIndex"> the index of the transform </param>
+      /// <returns>
+      /// the Transform
+      /// </returns>
+      Transform get(std::size_t pIndex) const;
+
+      /// <summary>
+      /// Set the transform at the given index.
+      /// </summary>
+      /// <param name="pIndex"> the index of the transform </param>
+      /// <param name="pT"> the new Transform </param>
+      void set(std::size_t pIndex, const Transform& pT);
+
+      /// <summary>
+      /// Replace the content of the batch by a range of transforms.
+      /// No memory is allocated if the batch is already large enough.
+      /// </summary>
+      /// <param name="pTransforms"> pointer to the first Transform </param>
+      /// <param name="pSize"> the number of transforms </param>
+      void assign(const Transform* pTransforms, std::size_t pSize);
+
+      /// <summary>
+      /// Replace the content of the batch by an std::vector of transforms.
+      /// No memory is allocated if the batch is already large enough.
+      /// </summary>
+      /// <param name="pTransforms"> the transforms to copy </param>
+      void assign(const std::vector<Transform>& pTransforms);
+
+      /// <summary>
+      /// Copy the batch into a range of transforms.
+      /// </summary>
+      /// <param name="pTransforms">
+      /// pointer to the first of size() Transform to write
+      /// </param>
+      void copyTo(Transform* pTransforms) const;
+
+      /// <summary>
+      /// Copy the batch into an std::vector of Transform.
+      /// The vector is resized, its capacity is reused.
+      /// </summary>
+      /// <param name="pTransforms"> the output vector </param>
+      void toVector(std::vector<Transform>& pTransforms) const;
+
+      /// <summary>
+      /// Return the batch as an std::vector of Transform.
+      /// </summary>
+      std::vector<Transform> toVector(void) const;
+
+    private:
+      std::size_t fSize;
+      std::size_t fStride;
+      std::vector<float> fData;
+
+      void xSetIdentity(std::size_t pBegin, std::size_t pEnd);
+    };
+
+    /// <summary>
+    /// Compose two batches of transforms, element by element.
+    ///
+    /// pTOut[i] = pT1[i] * pT2[i]
+    ///
+    /// pTOut may be the same object as pT1 or pT2.
+    /// Throw if pT1 and pT2 do not have the same size.
+    /// </summary>
+    /// <param name="pT1"> the left hand side transforms </param>
+    /// <param name="pT2"> the right hand side transforms </param>
+    /// <param name="pTOut"> the composed transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformMultiply(
+      const TransformBatch& pT1,
+      const TransformBatch& pT2,
+      TransformBatch&       pTOut);
+
+    /// <summary>
+    /// Compose a transform with each transform of a batch.
+    ///
+    /// pTOut[i] = pT1 * pT2[i]
+    ///
+    /// pTOut may be the same object as pT2.
+    /// </summary>
+    /// <param name="pT1"> the left hand side transform </param>
+    /// <param name="pT2"> the right hand side transforms </param>
+    /// <param name="pTOut"> the composed transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformMultiply(
+      const Transform&      pT1,
+      const TransformBatch& pT2,
+      TransformBatch&       pTOut);
+
+    /// <summary>
+    /// Compose each transform of a batch with a transform.
+    ///
+    /// pTOut[i] = pT1[i] * pT2
+    ///
+    /// pTOut may be the same object as pT1.
+    /// </summary>
+    /// <param name="pT1"> the left hand side transforms </param>
+    /// <param name="pT2"> the right hand side transform </param>
+    /// <param name="pTOut"> the composed transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformMultiply(
+      const TransformBatch& pT1,
+      const Transform&      pT2,
+      TransformBatch&       pTOut);
+
+    /// <summary>
+    /// Pre-multiply a batch of transforms, element by element.
+    ///
+    /// pTOut[i] = pT[i] * pTOut[i]
+    ///
+    /// Throw if pT and pTOut do not have the same size.
+    /// </summary>
+    /// <param name="pT"> the left hand side transforms </param>
+    /// <param name="pTOut"> the right hand side and result transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformPreMultiply(
+      const TransformBatch& pT,
+      TransformBatch&       pTOut);
+
+    /// <summary>
+    /// Pre-multiply each transform of a batch by the same transform.
+    ///
+    /// pTOut[i] = pT * pTOut[i]
+    /// </summary>
+    /// <param name="pT"> the left hand side transform </param>
+    /// <param name="pTOut"> the right hand side and result transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformPreMultiply(
+      const Transform& pT,
+      TransformBatch&  pTOut);
+
+    /// <summary>
+    /// Inverse each transform of a batch.
+    ///
+    /// As for transformInverse(const Transform&, Transform&), the rotation
+    /// part is assumed to be orthonormal: it is transposed.
+    ///
+    /// pTOut may be the same object as pT.
+    /// </summary>
+    /// <param name="pT"> the transforms to inverse </param>
+    /// <param name="pTOut"> the inverted transforms </param>
+    /// \ingroup Types
+    ALMATH_API void transformInverse(
+      const TransformBatch& pT,
+      TransformBatch&       pTOut);
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALTRANSFORMBATCH_H_
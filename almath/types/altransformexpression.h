@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALTRANSFORMEXPRESSION_H_
+#define _LIBALMATH_ALMATH_TYPES_ALTRANSFORMEXPRESSION_H_
+
+#include <almath/types/altransform.h>
+#include <almath/types/alrotation.h>
+#include <almath/types/alposition3d.h>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// Lazily evaluated products of Transform and Rotation.
+    ///
+    /// Transform::operator* returns a new Transform at each step of a
+    /// chain such as T0 * T1 * T2 * p. Starting the chain with lazy
+    /// builds an expression instead, evaluated when it is used:
+    ///
+    /// \code
+    /// const Position3D lEnd = lazy(T0) * T1 * T2 * p;
+    /// const Transform lT = lazy(T0) * R1 * T2;
+    /// \endcode
+    ///
+    /// - applied to a Position3D, the chain is applied to the point from
+    ///   right to left: only matrix-vector products are computed;
+    /// - converted to a Transform, the chain is multiplied from left to
+    ///   right in place into the result, with no intermediate Transform.
+    ///   The products by a Transform go through the SIMD kernels of
+    ///   Transform::operator*=.
+    ///
+    /// An expression converts implicitly to a Transform, so that it can
+    /// be given to any function which takes a Transform.
+    ///
+    /// An expression keeps references to its operands: evaluate it in the
+    /// statement which builds it, or while its operands live.
+    /// The results are those of the eager products, up to the rounding.
+    /// </summary>
+    /// \ingroup Types
+    template <class E>
+    struct TransformExpression {
+      /// <summary>
+      /// Evaluate the expression.
+      /// </summary>
+      Transform eval() const
+      {
+        return static_cast<const E&>(*this).evaluate();
+      }
+
+      operator Transform() const
+      {
+        return eval();
+      }
+    };
+
+    /// <summary>
+    /// A Transform operand of a TransformExpression. See lazy.
+    /// </summary>
+    /// \ingroup Types
+    struct TransformTerm: public TransformExpression<TransformTerm> {
+      explicit TransformTerm(const Transform& pT): fT(pT) {}
+
+      /** \cond PRIVATE */
+      Transform evaluate() const
+      {
+        return fT;
+      }
+
+      // through the kernels of Transform::operator*=, in place
+      void multiplyTo(Transform& pOut) const
+      {
+        pOut *= fT;
+      }
+
+      void applyTo(Position3D& pPos) const
+      {
+        const float x = pPos.x;
+        const float y = pPos.y;
+        const float z = pPos.z;
+        pPos.x = fT.r1_c1*x + fT.r1_c2*y + fT.r1_c3*z + fT.r1_c4;
+        pPos.y = fT.r2_c1*x + fT.r2_c2*y + fT.r2_c3*z + fT.r2_c4;
+        pPos.z = fT.r3_c1*x + fT.r3_c2*y + fT.r3_c3*z + fT.r3_c4;
+      }
+
+      const Transform& fT;
+      /** \endcond */
+    };
+
+    /// <summary>
+    /// A Rotation operand of a TransformExpression. See lazy.
+    /// </summary>
+    /// \ingroup Types
+    struct RotationTerm: public TransformExpression<RotationTerm> {
+      explicit RotationTerm(const Rotation& pR): fR(pR) {}
+
+      /** \cond PRIVATE */
+      Transform evaluate() const
+      {
+        Transform lT;
+        lT.r1_c1 = fR.r1_c1; lT.r1_c2 = fR.r1_c2; lT.r1_c3 = fR.r1_c3;
+        lT.r2_c1 = fR.r2_c1; lT.r2_c2 = fR.r2_c2; lT.r2_c3 = fR.r2_c3;
+        lT.r3_c1 = fR.r3_c1; lT.r3_c2 = fR.r3_c2; lT.r3_c3 = fR.r3_c3;
+        return lT;
+      }
+
+      void multiplyTo(Transform& pOut) const
+      {
+        xMultiplyRow(pOut.r1_c1, pOut.r1_c2, pOut.r1_c3);
+        xMultiplyRow(pOut.r2_c1, pOut.r2_c2, pOut.r2_c3);
+        xMultiplyRow(pOut.r3_c1, pOut.r3_c2, pOut.r3_c3);
+      }
+
+      void applyTo(Position3D& pPos) const
+      {
+        const float x = pPos.x;
+        const float y = pPos.y;
+        const float z = pPos.z;
+        pPos.x = fR.r1_c1*x + fR.r1_c2*y + fR.r1_c3*z;
+        pPos.y = fR.r2_c1*x + fR.r2_c2*y + fR.r2_c3*z;
+        pPos.z = fR.r3_c1*x + fR.r3_c2*y + fR.r3_c3*z;
+      }
+
+      // one row of the product by fR: each row only depends on itself
+      void xMultiplyRow(float& pC1, float& pC2, float& pC3) const
+      {
+        const float a = pC1;
+        const float b = pC2;
+        const float c = pC3;
+        pC1 = a*fR.r1_c1 + b*fR.r2_c1 + c*fR.r3_c1;
+        pC2 = a*fR.r1_c2 + b*fR.r2_c2 + c*fR.r3_c2;
+        pC3 = a*fR.r1_c3 + b*fR.r2_c3 + c*fR.r3_c3;
+      }
+
+      const Rotation& fR;
+      /** \endcond */
+    };
+
+    /// <summary>
+    /// The product of two TransformExpression. See lazy.
+    /// </summary>
+    /// \ingroup Types
+    template <class L, class R>
+    struct TransformProduct:
+      public TransformExpression<TransformProduct<L, R> > {
+      TransformProduct(const L& pLeft, const R& pRight)
+        : fLeft(pLeft), fRight(pRight) {}
+
+      /** \cond PRIVATE */
+      Transform evaluate() const
+      {
+        return xEvaluate(fLeft, fRight);
+      }
+
+      void multiplyTo(Transform& pOut) const
+      {
+        fLeft.multiplyTo(pOut);
+        fRight.multiplyTo(pOut);
+      }
+
+      void applyTo(Position3D& pPos) const
+      {
+        fRight.applyTo(pPos);
+        fLeft.applyTo(pPos);
+      }
+
+      L fLeft;
+      R fRight;
+
+    private:
+      template <class L2, class R2>
+      static Transform xEvaluate(const L2& pLeft, const R2& pRight)
+      {
+        Transform lT = pLeft.evaluate();
+        pRight.multiplyTo(lT);
+        return lT;
+      }
+
+      // The first product is not computed in place: multiplying a fresh
+      // copy of a Transform in place stalls the loads of the kernel on the
+      // stores of the copy.
+      static Transform xEvaluate(const TransformTerm& pLeft,
+                                 const TransformTerm& pRight)
+      {
+        return pLeft.fT * pRight.fT;
+      }
+      /** \endcond */
+    };
+
+    /// <summary>
+    /// Start a lazily evaluated chain of products.
+    /// See TransformExpression.
+    /// </summary>
+    /// <param name="pT"> the first Transform of the chain </param>
+    /// \ingroup Types
+    inline TransformTerm lazy(const Transform& pT)
+    {
+      return TransformTerm(pT);
+    }
+
+    /// <summary>
+    /// Start a lazily evaluated chain of products.
+    /// See TransformExpression.
+    /// </summary>
+    /// <param name="pR"> the first Rotation of the chain </param>
+    /// \ingroup Types
+    inline RotationTerm lazy(const Rotation& pR)
+    {
+      return RotationTerm(pR);
+    }
+
+    template <class L, class R>
+    TransformProduct<L, R> operator*(
+      const TransformExpression<L>& pLeft,
+      const TransformExpression<R>& pRight)
+    {
+      return TransformProduct<L, R>(static_cast<const L&>(pLeft),
+                                    static_cast<const R&>(pRight));
+    }
+
+    template <class L>
+    TransformProduct<L, TransformTerm> operator*(
+      const TransformExpression<L>& pLeft,
+      const Transform&              pRight)
+    {
+      return TransformProduct<L, TransformTerm>(
+            static_cast<const L&>(pLeft), TransformTerm(pRight));
+    }
+
+    template <class L>
+    TransformProduct<L, RotationTerm> operator*(
+      const TransformExpression<L>& pLeft,
+      const Rotation&               pRight)
+    {
+      return TransformProduct<L, RotationTerm>(
+            static_cast<const L&>(pLeft), RotationTerm(pRight));
+    }
+
+    template <class R>
+    TransformProduct<TransformTerm, R> operator*(
+      const Transform&              pLeft,
+      const TransformExpression<R>& pRight)
+    {
+      return TransformProduct<TransformTerm, R>(
+            TransformTerm(pLeft), static_cast<const R&>(pRight));
+    }
+
+    template <class R>
+    TransformProduct<RotationTerm, R> operator*(
+      const Rotation&               pLeft,
+      const TransformExpression<R>& pRight)
+    {
+      return TransformProduct<RotationTerm, R>(
+            RotationTerm(pLeft), static_cast<const R&>(pRight));
+    }
+
+    /// <summary>
+    /// Apply a chain to a Position3D, from right to left.
+    /// </summary>
+    /// <param name="pExpression"> the chain </param>
+    /// <param name="pPos"> the point </param>
+    /// <returns>
+    /// the point, as the eager product would give it
+    /// </returns>
+    /// \ingroup Types
+    template <class E>
+    Position3D operator*(
+      const TransformExpression<E>& pExpression,
+      const Position3D&             pPos)
+    {
+      Position3D lPos = pPos;
+      static_cast<const E&>(pExpression).applyTo(lPos);
+      return lPos;
+    }
+
+  } // namespace Math
+} // namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALTRANSFORMEXPRESSION_H_
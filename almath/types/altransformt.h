@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALTRANSFORMT_H_
+#define _LIBALMATH_ALMATH_TYPES_ALTRANSFORMT_H_
+
+#include <almath/types/altransform.h>
+#include <almath/types/alposition3dt.h>
+#include <almath/types/alrotationt.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A Transform with a templated scalar type.
+    ///
+    /// TransformT<float> has the layout of Transform. Transformd is the
+    /// double precision version.
+    ///
+    /// The float types (Transform, Rotation, ...) are unchanged: they keep
+    /// their ABI and their SIMD kernels. The templated types are header
+    /// only, and convert explicitly from and to the float types.
+    /// The helpers which work at any precision are in
+    /// almath/tools/altransformhelperst.h.
+    /// </summary>
+    /// \ingroup Types
+    template <typename S>
+    struct TransformT {
+      typedef S Scalar;
+
+      /** \cond PRIVATE */
+      S r1_c1, r1_c2, r1_c3, r1_c4;
+      S r2_c1, r2_c2, r2_c3, r2_c4;
+      S r3_c1, r3_c2, r3_c3, r3_c4;
+      /** \endcond */
+
+      /// <summary>
+      /// Create a TransformT initialized to identity.
+      /// </summary>
+      TransformT()
+        : r1_c1(S(1)), r1_c2(S(0)), r1_c3(S(0)), r1_c4(S(0)),
+          r2_c1(S(0)), r2_c2(S(1)), r2_c3(S(0)), r2_c4(S(0)),
+          r3_c1(S(0)), r3_c2(S(0)), r3_c3(S(1)), r3_c4(S(0)) {}
+
+      /// <summary>
+      /// Create a TransformT initialized with explicit value for translation
+      /// part. Rotation part is set to identity.
+      /// </summary>
+      TransformT(S pPosX, S pPosY, S pPosZ)
+        : r1_c1(S(1)), r1_c2(S(0)), r1_c3(S(0)), r1_c4(pPosX),
+          r2_c1(S(0)), r2_c2(S(1)), r2_c3(S(0)), r2_c4(pPosY),
+          r3_c1(S(0)), r3_c2(S(0)), r3_c3(S(1)), r3_c4(pPosZ) {}
+
+      /// <summary>
+      /// Create a TransformT from a rotation and a translation.
+      /// </summary>
+      TransformT(const RotationT<S>& pRot, const Position3DT<S>& pPos)
+        : r1_c1(pRot.r1_c1), r1_c2(pRot.r1_c2), r1_c3(pRot.r1_c3),
+          r1_c4(pPos.x),
+          r2_c1(pRot.r2_c1), r2_c2(pRot.r2_c2), r2_c3(pRot.r2_c3),
+          r2_c4(pPos.y),
+          r3_c1(pRot.r3_c1), r3_c2(pRot.r3_c2), r3_c3(pRot.r3_c3),
+          r3_c4(pPos.z) {}
+
+      /// <summary>
+      /// Convert a TransformT of another scalar type.
+      /// </summary>
+      template <typename U>
+      explicit TransformT(const TransformT<U>& pT)
+      {
+        xCopy(pT);
+      }
+
+      /// <summary>
+      /// Convert a Transform.
+      /// </summary>
+      explicit TransformT(const Transform& pT)
+      {
+        xCopy(pT);
+      }
+
+      /// <summary>
+      /// Convert to a Transform.
+      /// </summary>
+      Transform toTransform() const
+      {
+        Transform lT;
+        lT.r1_c1 = static_cast<float>(r1_c1);
+        lT.r1_c2 = static_cast<float>(r1_c2);
+        lT.r1_c3 = static_cast<float>(r1_c3);
+        lT.r1_c4 = static_cast<float>(r1_c4);
+        lT.r2_c1 = static_cast<float>(r2_c1);
+        lT.r2_c2 = static_cast<float>(r2_c2);
+        lT.r2_c3 = static_cast<float>(r2_c3);
+        lT.r2_c4 = static_cast<float>(r2_c4);
+        lT.r3_c1 = static_cast<float>(r3_c1);
+        lT.r3_c2 = static_cast<float>(r3_c2);
+        lT.r3_c3 = static_cast<float>(r3_c3);
+        lT.r3_c4 = static_cast<float>(r3_c4);
+        return lT;
+      }
+
+      TransformT operator* (const TransformT& pT2) const
+      {
+        TransformT lT;
+        lT.r1_c1 = r1_c1*pT2.r1_c1 + r1_c2*pT2.r2_c1 + r1_c3*pT2.r3_c1;
+        lT.r1_c2 = r1_c1*pT2.r1_c2 + r1_c2*pT2.r2_c2 + r1_c3*pT2.r3_c2;
+        lT.r1_c3 = r1_c1*pT2.r1_c3 + r1_c2*pT2.r2_c3 + r1_c3*pT2.r3_c3;
+        lT.r1_c4 = r1_c1*pT2.r1_c4 + r1_c2*pT2.r2_c4 + r1_c3*pT2.r3_c4 + r1_c4;
+        lT.r2_c1 = r2_c1*pT2.r1_c1 + r2_c2*pT2.r2_c1 + r2_c3*pT2.r3_c1;
+        lT.r2_c2 = r2_c1*pT2.r1_c2 + r2_c2*pT2.r2_c2 + r2_c3*pT2.r3_c2;
+        lT.r2_c3 = r2_c1*pT2.r1_c3 + r2_c2*pT2.r2_c3 + r2_c3*pT2.r3_c3;
+        lT.r2_c4 = r2_c1*pT2.r1_c4 + r2_c2*pT2.r2_c4 + r2_c3*pT2.r3_c4 + r2_c4;
+        lT.r3_c1 = r3_c1*pT2.r1_c1 + r3_c2*pT2.r2_c1 + r3_c3*pT2.r3_c1;
+        lT.r3_c2 = r3_c1*pT2.r1_c2 + r3_c2*pT2.r2_c2 + r3_c3*pT2.r3_c2;
+        lT.r3_c3 = r3_c1*pT2.r1_c3 + r3_c2*pT2.r2_c3 + r3_c3*pT2.r3_c3;
+        lT.r3_c4 = r3_c1*pT2.r1_c4 + r3_c2*pT2.r2_c4 + r3_c3*pT2.r3_c4 + r3_c4;
+        return lT;
+      }
+
+      TransformT& operator*= (const TransformT& pT2)
+      {
+        *this = *this * pT2;
+        return *this;
+      }
+
+      /// <summary>
+      /// Apply the TransformT to a Position3DT.
+      /// </summary>
+      Position3DT<S> operator* (const Position3DT<S>& pPos) const
+      {
+        return Position3DT<S>(
+              r1_c1*pPos.x + r1_c2*pPos.y + r1_c3*pPos.z + r1_c4,
+              r2_c1*pPos.x + r2_c2*pPos.y + r2_c3*pPos.z + r2_c4,
+              r3_c1*pPos.x + r3_c2*pPos.y + r3_c3*pPos.z + r3_c4);
+      }
+
+      bool operator== (const TransformT& pT2) const
+      {
+        return isNear(pT2, S(0));
+      }
+
+      bool operator!= (const TransformT& pT2) const
+      {
+        return !(*this==pT2);
+      }
+
+      /// <summary>
+      /// Check if the actual TransformT is near the one
+      /// given in argument.
+      /// </summary>
+      bool isNear(
+        const TransformT& pT2,
+        const S&          pEpsilon=S(0.0001)) const
+      {
+        return (rotation().isNear(pT2.rotation(), pEpsilon) &&
+                std::abs(r1_c4 - pT2.r1_c4) <= pEpsilon &&
+                std::abs(r2_c4 - pT2.r2_c4) <= pEpsilon &&
+                std::abs(r3_c4 - pT2.r3_c4) <= pEpsilon);
+      }
+
+      /// <summary>
+      /// Return the inverse of a rigid TransformT: (R^t, -R^t*r).
+      /// </summary>
+      TransformT inverse() const
+      {
+        const RotationT<S> lRt = rotation().transpose();
+        return TransformT(lRt, -(lRt*translation()));
+      }
+
+      S determinant() const
+      {
+        return rotation().determinant();
+      }
+
+      RotationT<S> rotation() const
+      {
+        RotationT<S> lRot;
+        lRot.r1_c1 = r1_c1; lRot.r1_c2 = r1_c2; lRot.r1_c3 = r1_c3;
+        lRot.r2_c1 = r2_c1; lRot.r2_c2 = r2_c2; lRot.r2_c3 = r2_c3;
+        lRot.r3_c1 = r3_c1; lRot.r3_c2 = r3_c2; lRot.r3_c3 = r3_c3;
+        return lRot;
+      }
+
+      Position3DT<S> translation() const
+      {
+        return Position3DT<S>(r1_c4, r2_c4, r3_c4);
+      }
+
+      static TransformT fromRotX(S pRotX)
+      {
+        return TransformT(RotationT<S>::fromRotX(pRotX), Position3DT<S>());
+      }
+
+      static TransformT fromRotY(S pRotY)
+      {
+        return TransformT(RotationT<S>::fromRotY(pRotY), Position3DT<S>());
+      }
+
+      static TransformT fromRotZ(S pRotZ)
+      {
+        return TransformT(RotationT<S>::fromRotZ(pRotZ), Position3DT<S>());
+      }
+
+      static TransformT fromPosition(S pX, S pY, S pZ)
+      {
+        return TransformT(pX, pY, pZ);
+      }
+
+    private:
+      template <typename Other>
+      void xCopy(const Other& pT)
+      {
+        r1_c1 = static_cast<S>(pT.r1_c1);
+        r1_c2 = static_cast<S>(pT.r1_c2);
+        r1_c3 = static_cast<S>(pT.r1_c3);
+        r1_c4 = static_cast<S>(pT.r1_c4);
+        r2_c1 = static_cast<S>(pT.r2_c1);
+        r2_c2 = static_cast<S>(pT.r2_c2);
+        r2_c3 = static_cast<S>(pT.r2_c3);
+        r2_c4 = static_cast<S>(pT.r2_c4);
+        r3_c1 = static_cast<S>(pT.r3_c1);
+        r3_c2 = static_cast<S>(pT.r3_c2);
+        r3_c3 = static_cast<S>(pT.r3_c3);
+        r3_c4 = static_cast<S>(pT.r3_c4);
+      }
+    };
+
+    template <typename S>
+    TransformT<S> transformInverse(const TransformT<S>& pT)
+    {
+      return pT.inverse();
+    }
+
+    template <typename S>
+    S determinant(const TransformT<S>& pT)
+    {
+      return pT.determinant();
+    }
+
+    /// \ingroup Types
+    typedef TransformT<double> Transformd;
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALTRANSFORMT_H_
@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALVELOCITY3D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALVELOCITY3D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -113,6 +115,21 @@ namespace AL {
       /// </param>
       Velocity3D(const std::vector<float>& pFloats);
 
+      /// <summary>
+      /// Create a Velocity3D from an std::array [xd, yd, zd].
+      /// </summary>
+      /// <param name="pFloats"> the array of 3 floats </param>
+      explicit Velocity3D(const std::array<float, 3>& pFloats);
+
+      /// <summary>
+      /// Create a Velocity3D from pSize floats [xd, yd, zd].
+      /// Unlike the std::vector constructor, a wrong size throws a
+      /// std::runtime_error instead of printing a warning.
+      /// </summary>
+      /// <param name="pFloats"> the first float </param>
+      /// <param name="pSize"> the number of floats: 3 </param>
+      Velocity3D(const float* pFloats, std::size_t pSize);
+
       /// <summary>
       /// Overloading of operator + for Velocity3D.
       /// </summary>
@@ -247,6 +264,41 @@ namespace AL {
       /// It is assumed the vector has enough space.
       /// </summary>
       void writeToVector(std::vector<float>::iterator& pIt) const;
+
+      /// <summary>
+      /// Return the Velocity3D as an std::array of float [xd, yd, zd].
+      /// Unlike toVector, nothing is allocated.
+      /// </summary>
+      std::array<float, 3> toArray(void) const;
+
+      /// <summary>
+      /// Write [xd, yd, zd] to an output iterator, a float* for instance.
+      /// It is assumed the destination has room for 3 floats.
+      /// </summary>
+      /// <param name="pIt"> the first output </param>
+      /// <returns> the iterator past the last written float </returns>
+      template <class OutputIterator>
+      OutputIterator writeTo(OutputIterator pIt) const
+      {
+        *pIt++ = xd;
+        *pIt++ = yd;
+        *pIt++ = zd;
+        return pIt;
+      }
+
+      /// <summary>
+      /// Read [xd, yd, zd] from an input iterator, a const float* for instance.
+      /// </summary>
+      /// <param name="pIt"> the first input </param>
+      /// <returns> the iterator past the last read float </returns>
+      template <class InputIterator>
+      InputIterator readFrom(InputIterator pIt)
+      {
+        xd = *pIt++;
+        yd = *pIt++;
+        zd = *pIt++;
+        return pIt;
+      }
     };
 
     ALMATH_API Velocity3D operator* (
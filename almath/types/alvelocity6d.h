@@ -9,6 +9,8 @@
 #ifndef _LIBALMATH_ALMATH_TYPES_ALVELOCITY6D_H_
 #define _LIBALMATH_ALMATH_TYPES_ALVELOCITY6D_H_
 
+#include <array>
+#include <cstddef>
 #include <vector>
 #include <almath/api.h>
 
@@ -151,6 +153,21 @@ struct ALMATH_API Velocity6D {
   /// </param>
   Velocity6D(const std::vector<float>& pFloats);
 
+  /// <summary>
+  /// Create a Velocity6D from an std::array [xd, yd, zd, wxd, wyd, wzd].
+  /// </summary>
+  /// <param name="pFloats"> the array of 6 floats </param>
+  explicit Velocity6D(const std::array<float, 6>& pFloats);
+
+  /// <summary>
+  /// Create a Velocity6D from pSize floats [xd, yd, zd, wxd, wyd, wzd].
+  /// Unlike the std::vector constructor, a wrong size throws a
+  /// std::runtime_error instead of printing a warning.
+  /// </summary>
+  /// <param name="pFloats"> the first float </param>
+  /// <param name="pSize"> the number of floats: 6 </param>
+  Velocity6D(const float* pFloats, std::size_t pSize);
+
   /// <summary>
   /// Overloading of operator + for Velocity6D.
   /// </summary>
@@ -287,6 +304,50 @@ struct ALMATH_API Velocity6D {
   /// It is assumed the vector has enough space.
   /// </summary>
   void writeToVector(std::vector<float>::iterator& pIt) const;
+
+  /// <summary>
+  /// Return the Velocity6D as an std::array of float
+  /// [xd, yd, zd, wxd, wyd, wzd].
+  /// Unlike toVector, nothing is allocated.
+  /// </summary>
+  std::array<float, 6> toArray(void) const;
+
+  /// <summary>
+  /// Write [xd, yd, zd, wxd, wyd, wzd] to an output iterator,
+  /// a float* for instance.
+  /// It is assumed the destination has room for 6 floats.
+  /// </summary>
+  /// <param name="pIt"> the first output </param>
+  /// <returns> the iterator past the last written float </returns>
+  template <class OutputIterator>
+  OutputIterator writeTo(OutputIterator pIt) const
+  {
+    *pIt++ = xd;
+    *pIt++ = yd;
+    *pIt++ = zd;
+    *pIt++ = wxd;
+    *pIt++ = wyd;
+    *pIt++ = wzd;
+    return pIt;
+  }
+
+  /// <summary>
+  /// Read [xd, yd, zd, wxd, wyd, wzd] from an input iterator,
+  /// a const float* for instance.
+  /// </summary>
+  /// <param name="pIt"> the first input </param>
+  /// <returns> the iterator past the last read float </returns>
+  template <class InputIterator>
+  InputIterator readFrom(InputIterator pIt)
+  {
+    xd = *pIt++;
+    yd = *pIt++;
+    zd = *pIt++;
+    wxd = *pIt++;
+    wyd = *pIt++;
+    wzd = *pIt++;
+    return pIt;
+  }
 }; // end struct
 
 /// <summary>
@@ -324,4 +385,9 @@ ALMATH_API Velocity6D normalize(const Velocity6D& pVel);
 
 } // end namespace Math
 } // end namespace AL
+
+#include <almath/inline/alinline.h>
+#ifdef ALMATH_INLINE_HEADERS
+# include <almath/inline/alvelocity6d.h>
+#endif
 #endif  // _LIBALMATH_ALMATH_TYPES_ALVELOCITY6D_H_
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#pragma once
+#ifndef _LIBALMATH_ALMATH_TYPES_ALVELOCITY6DT_H_
+#define _LIBALMATH_ALMATH_TYPES_ALVELOCITY6DT_H_
+
+#include <almath/types/alvelocity6d.h>
+#include <cmath>
+#include <stdexcept>
+
+namespace AL {
+  namespace Math {
+
+    /// <summary>
+    /// A Velocity6D with a templated scalar type.
+    ///
+    /// Velocity6DT<float> has the layout of Velocity6D. Velocity6Dd is the
+    /// double precision version.
+    /// </summary>
+    /// \ingroup Types
+    template <typename S>
+    struct Velocity6DT {
+      typedef S Scalar;
+
+      /// <summary> </summary>
+      S xd;
+      /// <summary> </summary>
+      S yd;
+      /// <summary> </summary>
+      S zd;
+      /// <summary> </summary>
+      S wxd;
+      /// <summary> </summary>
+      S wyd;
+      /// <summary> </summary>
+      S wzd;
+
+      /// <summary>
+      /// Create a Velocity6DT initialized with 0.
+      /// </summary>
+      Velocity6DT()
+        : xd(S(0)), yd(S(0)), zd(S(0)), wxd(S(0)), wyd(S(0)), wzd(S(0)) {}
+
+      /// <summary>
+      /// Create a Velocity6DT with the same value for each coordinate.
+      /// </summary>
+      explicit Velocity6DT(S pInit)
+        : xd(pInit), yd(pInit), zd(pInit),
+          wxd(pInit), wyd(pInit), wzd(pInit) {}
+
+      /// <summary>
+      /// Create a Velocity6DT with explicit values.
+      /// </summary>
+      Velocity6DT(S pXd, S pYd, S pZd, S pWxd, S pWyd, S pWzd)
+        : xd(pXd), yd(pYd), zd(pZd), wxd(pWxd), wyd(pWyd), wzd(pWzd) {}
+
+      /// <summary>
+      /// Convert a Velocity6DT of another scalar type.
+      /// </summary>
+      template <typename U>
+      explicit Velocity6DT(const Velocity6DT<U>& pVel)
+        : xd(static_cast<S>(pVel.xd)),
+          yd(static_cast<S>(pVel.yd)),
+          zd(static_cast<S>(pVel.zd)),
+          wxd(static_cast<S>(pVel.wxd)),
+          wyd(static_cast<S>(pVel.wyd)),
+          wzd(static_cast<S>(pVel.wzd)) {}
+
+      /// <summary>
+      /// Convert a Velocity6D.
+      /// </summary>
+      explicit Velocity6DT(const Velocity6D& pVel)
+        : xd(static_cast<S>(pVel.xd)),
+          yd(static_cast<S>(pVel.yd)),
+          zd(static_cast<S>(pVel.zd)),
+          wxd(static_cast<S>(pVel.wxd)),
+          wyd(static_cast<S>(pVel.wyd)),
+          wzd(static_cast<S>(pVel.wzd)) {}
+
+      /// <summary>
+      /// Convert to a Velocity6D.
+      /// </summary>
+      Velocity6D toVelocity6D() const
+      {
+        return Velocity6D(static_cast<float>(xd),
+                          static_cast<float>(yd),
+                          static_cast<float>(zd),
+                          static_cast<float>(wxd),
+                          static_cast<float>(wyd),
+                          static_cast<float>(wzd));
+      }
+
+      Velocity6DT operator+ (const Velocity6DT& pVel2) const
+      {
+        return Velocity6DT(xd + pVel2.xd, yd + pVel2.yd, zd + pVel2.zd,
+                           wxd + pVel2.wxd, wyd + pVel2.wyd, wzd + pVel2.wzd);
+      }
+
+      Velocity6DT operator- (const Velocity6DT& pVel2) const
+      {
+        return Velocity6DT(xd - pVel2.xd, yd - pVel2.yd, zd - pVel2.zd,
+                           wxd - pVel2.wxd, wyd - pVel2.wyd, wzd - pVel2.wzd);
+      }
+
+      Velocity6DT operator- () const
+      {
+        return Velocity6DT(-xd, -yd, -zd, -wxd, -wyd, -wzd);
+      }
+
+      Velocity6DT operator* (S pVal) const
+      {
+        return Velocity6DT(xd*pVal, yd*pVal, zd*pVal,
+                           wxd*pVal, wyd*pVal, wzd*pVal);
+      }
+
+      Velocity6DT& operator*= (S pVal)
+      {
+        *this = *this * pVal;
+        return *this;
+      }
+
+      Velocity6DT operator/ (S pVal) const
+      {
+        if (pVal == S(0))
+        {
+          throw std::runtime_error(
+                "ALVelocity6D: operator/ Division by zero.");
+        }
+        return (*this) * (S(1)/pVal);
+      }
+
+      bool operator== (const Velocity6DT& pVel2) const
+      {
+        return (xd == pVel2.xd &&
+                yd == pVel2.yd &&
+                zd == pVel2.zd &&
+                wxd == pVel2.wxd &&
+                wyd == pVel2.wyd &&
+                wzd == pVel2.wzd);
+      }
+
+      bool operator!= (const Velocity6DT& pVel2) const
+      {
+        return !(*this==pVel2);
+      }
+
+      /// <summary>
+      /// Check if the actual Velocity6DT is near the one
+      /// given in argument.
+      /// </summary>
+      bool isNear(
+        const Velocity6DT& pVel2,
+        const S&           pEpsilon=S(0.0001)) const
+      {
+        return (std::abs(xd  - pVel2.xd)  <= pEpsilon &&
+                std::abs(yd  - pVel2.yd)  <= pEpsilon &&
+                std::abs(zd  - pVel2.zd)  <= pEpsilon &&
+                std::abs(wxd - pVel2.wxd) <= pEpsilon &&
+                std::abs(wyd - pVel2.wyd) <= pEpsilon &&
+                std::abs(wzd - pVel2.wzd) <= pEpsilon);
+      }
+
+      S norm() const
+      {
+        return std::sqrt(xd*xd + yd*yd + zd*zd +
+                         wxd*wxd + wyd*wyd + wzd*wzd);
+      }
+    };
+
+    template <typename S>
+    Velocity6DT<S> operator* (S pVal, const Velocity6DT<S>& pVel)
+    {
+      return pVel*pVal;
+    }
+
+    template <typename S>
+    S norm(const Velocity6DT<S>& pVel)
+    {
+      return pVel.norm();
+    }
+
+    /// \ingroup Types
+    typedef Velocity6DT<double> Velocity6Dd;
+
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_ALMATH_TYPES_ALVELOCITY6DT_H_
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/avoidfootcollision.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// Clamp candidate steps so that the swing foot does not collide with the
+// support foot, with the foot boxes of avoidfootcollision_test.cpp.
+// Argument: the number of candidate steps.
+
+namespace
+{
+  std::vector<AL::Math::Position2D> makeFoot(float pInner, float pOuter)
+  {
+    std::vector<AL::Math::Position2D> lBox;
+    lBox.push_back(AL::Math::Position2D(0.080f, pInner));
+    lBox.push_back(AL::Math::Position2D(0.080f, pOuter));
+    lBox.push_back(AL::Math::Position2D(-0.047f, pOuter));
+    lBox.push_back(AL::Math::Position2D(-0.047f, pInner));
+    return lBox;
+  }
+
+  void BM_AvoidFootCollision(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Position2D> lLFoot = makeFoot(0.050f, -0.038f);
+    const std::vector<AL::Math::Position2D> lRFoot = makeFoot(0.038f, -0.050f);
+    // steps of the left foot, some of them colliding with the right foot
+    std::vector<AL::Math::Pose2D> lMoves(lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      const float f = 0.37f * static_cast<float>(i);
+      lMoves[i] = AL::Math::Pose2D(0.04f*std::cos(f),
+                                   0.1f + 0.03f*std::sin(2.0f*f),
+                                   0.7f*std::sin(0.3f*f));
+    }
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::Pose2D lMove = lMoves[i];
+        benchmark::DoNotOptimize(
+              AL::Math::avoidFootCollision(lLFoot, lRFoot, false, lMove));
+        benchmark::DoNotOptimize(lMove);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_AvoidFootCollision)->Arg(1000);
+}
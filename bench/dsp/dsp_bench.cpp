@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/dsp/digitalfilter.h>
+#include <almath/dsp/pidcontroller.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// One control tick per sample: a digital filter on a sensor and a PID on
+// a joint.
+// Argument: the order of the filter, the number of samples of the PID.
+
+namespace
+{
+  std::vector<float> makeSignal(std::size_t pSize)
+  {
+    std::vector<float> lSignal(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.01f * static_cast<float>(i);
+      lSignal[i] = std::sin(f) + 0.1f*std::sin(37.0f*f);
+    }
+    return lSignal;
+  }
+
+  void BM_DigitalFilter_ProcessFilter(benchmark::State& state)
+  {
+    const std::size_t lOrder = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lSignal = makeSignal(4096u);
+    // a moving average on the inputs, a light feedback on the outputs
+    const std::vector<float> lWeightsIn(lOrder + 1u,
+                                        1.0f / static_cast<float>(lOrder + 1u));
+    const std::vector<float> lWeightsOut(lOrder, 0.01f);
+    AL::Math::DSP::DigitalFilter lFilter;
+    lFilter.configureFilter(lWeightsIn, lWeightsOut, 1.0f);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSignal.size(); ++i)
+      {
+        benchmark::DoNotOptimize(lFilter.processFilter(lSignal[i]));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * 4096);
+  }
+  BENCHMARK(BM_DigitalFilter_ProcessFilter)->Arg(2)->Arg(16);
+
+  void BM_PIDController_ComputeFeedback(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lCommand = makeSignal(lSize);
+    const std::vector<float> lSensor = makeSignal(lSize + 3u);
+    AL::Math::DSP::PIDController lPid(2.0f, 0.1f, 0.5f, 0.001f, 0.0f, 0.01f);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        benchmark::DoNotOptimize(
+              lPid.computeFeedback(lCommand[i], lSensor[i + 3u]));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_PIDController_ComputeFeedback)->Arg(4096);
+}
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/scenegraph/almatheigen.h>
+#include <almath/tools/almath.h>
+#include <almath/tools/altransformhelpers.h>
+
+#include <Eigen/Geometry>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// The core operations computed by AL::Math and by Eigen through the
+// almatheigen.h mappings (Eigen::Map on the ALMath storage, no copy), side
+// by side: BM_ALMath<Op> and BM_Eigen<Op>.
+//
+// Besides the throughput, each benchmark reports in counters:
+//  - max_error: the largest deviation of its results from the Eigen path
+//    computed in double,
+//  - max_deviation: the largest deviation between the AL::Math and the
+//    Eigen results, both in float.
+// The values are the same for every run and can be diffed between releases
+// in the JSON output, see almath_bench_json.
+
+namespace
+{
+  const std::size_t kSize = 4096u;
+
+  // inputs shared by all the operations
+  struct Inputs
+  {
+    Inputs()
+      : t1(kSize)
+      , t2(kSize)
+      , p(kSize)
+      , q1(kSize)
+      , q2(kSize)
+      , angle(kSize)
+      , axis(kSize)
+    {
+      for (std::size_t i = 0u; i < kSize; ++i)
+      {
+        const float f = 0.37f * static_cast<float>(i);
+        t1[i] = AL::Math::Transform::fromPosition(
+              std::cos(f), 0.5f*std::sin(f), 0.2f,
+              std::sin(f), 1.4f*std::cos(0.7f*f), 3.0f*std::sin(0.3f*f));
+        t2[i] = AL::Math::Transform::fromPosition(
+              -0.1f, std::sin(2.0f*f), 0.3f*std::cos(f),
+              0.5f*std::cos(f), std::sin(1.3f*f), 2.0f*std::cos(0.2f*f));
+        p[i] = AL::Math::Position3D(std::sin(f), std::cos(0.5f*f), 0.4f);
+        q1[i] = AL::Math::quaternionFromTransform(t1[i]);
+        q2[i] = AL::Math::quaternionFromTransform(t2[i]);
+        // up to pi, axes of all directions
+        angle[i] = 3.1f*std::abs(std::sin(0.11f*f));
+        axis[i] = AL::Math::normalize(AL::Math::Position3D(
+                                        std::cos(f), std::sin(f),
+                                        std::sin(2.3f*f)));
+      }
+    }
+
+    std::vector<AL::Math::Transform> t1;
+    std::vector<AL::Math::Transform> t2;
+    std::vector<AL::Math::Position3D> p;
+    std::vector<AL::Math::Quaternion> q1;
+    std::vector<AL::Math::Quaternion> q2;
+    std::vector<float> angle;
+    std::vector<AL::Math::Position3D> axis;
+  };
+
+  const Inputs& inputs()
+  {
+    static const Inputs lInputs;
+    return lInputs;
+  }
+
+  // An operation provides:
+  //  - kOut, the number of scalars of a result,
+  //  - almath(i, out) and eigen<T>(i, out), which compute the result of the
+  //    input i in out,
+  //  - kSignFree, true if a result and its opposite are equivalent.
+
+  struct TransformMultiply
+  {
+    static const std::size_t kOut = 12u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      *reinterpret_cast<AL::Math::Transform*>(out) =
+          inputs().t1[i] * inputs().t2[i];
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      typedef Eigen::Matrix<T, 3, 4, Eigen::RowMajor> M;
+      const auto a = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t1[i].r1_c1).template cast<T>();
+      const auto b = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t2[i].r1_c1).template cast<T>();
+      Eigen::Map<M> o(out);
+      o.template leftCols<3>().noalias() =
+          a.template leftCols<3>() * b.template leftCols<3>();
+      o.col(3).noalias() = a.template leftCols<3>() * b.col(3) + a.col(3);
+    }
+  };
+
+  struct TransformInverse
+  {
+    static const std::size_t kOut = 12u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      AL::Math::transformInverse(inputs().t1[i],
+                                 *reinterpret_cast<AL::Math::Transform*>(out));
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      typedef Eigen::Matrix<T, 3, 4, Eigen::RowMajor> M;
+      const auto a = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t1[i].r1_c1).template cast<T>();
+      Eigen::Map<M> o(out);
+      o.template leftCols<3>() = a.template leftCols<3>().transpose();
+      o.col(3).noalias() = -(a.template leftCols<3>().transpose() * a.col(3));
+    }
+  };
+
+  struct TransformPosition3D
+  {
+    static const std::size_t kOut = 3u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      *reinterpret_cast<AL::Math::Position3D*>(out) =
+          inputs().t1[i] * inputs().p[i];
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      const auto a = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t1[i].r1_c1).template cast<T>();
+      const auto p = Eigen::Map<const Eigen::Vector3f>(
+            &inputs().p[i].x).template cast<T>();
+      Eigen::Map<Eigen::Matrix<T, 3, 1> > o(out);
+      o.noalias() = a.template leftCols<3>() * p + a.col(3);
+    }
+  };
+
+  struct QuaternionMultiply
+  {
+    static const std::size_t kOut = 4u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      *reinterpret_cast<AL::Math::Quaternion*>(out) =
+          inputs().q1[i] * inputs().q2[i];
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      const AL::Math::Quaternion& a = inputs().q1[i];
+      const AL::Math::Quaternion& b = inputs().q2[i];
+      const Eigen::Quaternion<T> r =
+          Eigen::Quaternion<T>(T(a.w), T(a.x), T(a.y), T(a.z)) *
+          Eigen::Quaternion<T>(T(b.w), T(b.x), T(b.y), T(b.z));
+      out[0] = r.w();
+      out[1] = r.x();
+      out[2] = r.y();
+      out[3] = r.z();
+    }
+  };
+
+  struct QuaternionFromTransform
+  {
+    static const std::size_t kOut = 4u;
+    static const bool kSignFree = true;
+    static void almath(std::size_t i, float* out)
+    {
+      *reinterpret_cast<AL::Math::Quaternion*>(out) =
+          AL::Math::quaternionFromTransform(inputs().t1[i]);
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      const Eigen::Matrix<T, 3, 3> r = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t1[i].r1_c1).template leftCols<3>().template cast<T>();
+      const Eigen::Quaternion<T> q(r);
+      out[0] = q.w();
+      out[1] = q.x();
+      out[2] = q.y();
+      out[3] = q.z();
+    }
+  };
+
+  struct TransformFromQuaternion
+  {
+    static const std::size_t kOut = 12u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      *reinterpret_cast<AL::Math::Transform*>(out) =
+          AL::Math::transformFromQuaternion(inputs().q1[i]);
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      typedef Eigen::Matrix<T, 3, 4, Eigen::RowMajor> M;
+      const AL::Math::Quaternion& q = inputs().q1[i];
+      Eigen::Map<M> o(out);
+      o.template leftCols<3>() =
+          Eigen::Quaternion<T>(T(q.w), T(q.x), T(q.y), T(q.z))
+          .toRotationMatrix();
+      o.col(3).setZero();
+    }
+  };
+
+  // the rotation part of transformLogarithm, against Eigen::AngleAxis
+  struct RotationLogarithm
+  {
+    static const std::size_t kOut = 3u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      const AL::Math::Velocity6D v =
+          AL::Math::transformLogarithm(inputs().t1[i]);
+      out[0] = v.wxd;
+      out[1] = v.wyd;
+      out[2] = v.wzd;
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      const Eigen::Matrix<T, 3, 3> r = Eigen::Map<const AL::Math::Matrix34frm>(
+            &inputs().t1[i].r1_c1).template leftCols<3>().template cast<T>();
+      const Eigen::AngleAxis<T> lAngleAxis(r);
+      Eigen::Map<Eigen::Matrix<T, 3, 1> > o(out);
+      o = lAngleAxis.angle() * lAngleAxis.axis();
+    }
+  };
+
+  struct RotationFromAngleDirection
+  {
+    static const std::size_t kOut = 9u;
+    static const bool kSignFree = false;
+    static void almath(std::size_t i, float* out)
+    {
+      const AL::Math::Position3D& a = inputs().axis[i];
+      *reinterpret_cast<AL::Math::Rotation*>(out) =
+          AL::Math::rotationFromAngleDirection(inputs().angle[i], a.x, a.y,
+                                               a.z);
+    }
+    template <typename T>
+    static void eigen(std::size_t i, T* out)
+    {
+      const Eigen::Matrix<T, 3, 1> a = Eigen::Map<const Eigen::Vector3f>(
+            &inputs().axis[i].x).template cast<T>();
+      Eigen::Map<Eigen::Matrix<T, 3, 3, Eigen::RowMajor> > o(out);
+      o = Eigen::AngleAxis<T>(T(inputs().angle[i]), a).toRotationMatrix();
+    }
+  };
+
+  template <class Op, typename T>
+  std::vector<T> eigenResults()
+  {
+    std::vector<T> lOut(Op::kOut*kSize);
+    for (std::size_t i = 0u; i < kSize; ++i)
+    {
+      Op::template eigen<T>(i, &lOut[Op::kOut*i]);
+    }
+    return lOut;
+  }
+
+  template <class Op>
+  std::vector<float> almathResults()
+  {
+    std::vector<float> lOut(Op::kOut*kSize);
+    for (std::size_t i = 0u; i < kSize; ++i)
+    {
+      Op::almath(i, &lOut[Op::kOut*i]);
+    }
+    return lOut;
+  }
+
+  // largest difference between the results pA and pB
+  template <class Op, typename A, typename B>
+  double maxDeviation(const std::vector<A>& pA, const std::vector<B>& pB)
+  {
+    double lMax = 0.0;
+    for (std::size_t i = 0u; i < kSize; ++i)
+    {
+      const std::size_t lFirst = Op::kOut*i;
+      double lSame = 0.0;
+      double lOpposite = 0.0;
+      for (std::size_t k = lFirst; k < lFirst + Op::kOut; ++k)
+      {
+        const double a = pA[k];
+        const double b = pB[k];
+        lSame = std::max(lSame, std::abs(a - b));
+        lOpposite = std::max(lOpposite, std::abs(a + b));
+      }
+      lMax = std::max(lMax, Op::kSignFree ? std::min(lSame, lOpposite) : lSame);
+    }
+    return lMax;
+  }
+
+  template <class Op>
+  void setCounters(benchmark::State& state, const std::vector<float>& pOut)
+  {
+    const std::vector<double> lReference = eigenResults<Op, double>();
+    state.counters["max_error"] = maxDeviation<Op>(pOut, lReference);
+    state.counters["max_deviation"] = maxDeviation<Op>(
+          almathResults<Op>(), eigenResults<Op, float>());
+    state.SetItemsProcessed(state.iterations() * kSize);
+  }
+
+  template <class Op>
+  void BM_ALMath(benchmark::State& state)
+  {
+    std::vector<float> lOut(Op::kOut*kSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kSize; ++i)
+      {
+        Op::almath(i, &lOut[Op::kOut*i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    setCounters<Op>(state, lOut);
+  }
+
+  template <class Op>
+  void BM_Eigen(benchmark::State& state)
+  {
+    std::vector<float> lOut(Op::kOut*kSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kSize; ++i)
+      {
+        Op::template eigen<float>(i, &lOut[Op::kOut*i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    setCounters<Op>(state, lOut);
+  }
+
+#define ALMATH_EIGEN_BENCHMARK(Op)           \
+  BENCHMARK_TEMPLATE(BM_ALMath, Op);         \
+  BENCHMARK_TEMPLATE(BM_Eigen, Op)
+
+  ALMATH_EIGEN_BENCHMARK(TransformMultiply);
+  ALMATH_EIGEN_BENCHMARK(TransformInverse);
+  ALMATH_EIGEN_BENCHMARK(TransformPosition3D);
+  ALMATH_EIGEN_BENCHMARK(QuaternionMultiply);
+  ALMATH_EIGEN_BENCHMARK(QuaternionFromTransform);
+  ALMATH_EIGEN_BENCHMARK(TransformFromQuaternion);
+  ALMATH_EIGEN_BENCHMARK(RotationLogarithm);
+  ALMATH_EIGEN_BENCHMARK(RotationFromAngleDirection);
+
+#undef ALMATH_EIGEN_BENCHMARK
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/scenegraph/inversekinematics.h>
+#include <almath/scenegraph/kinematicmodel.h>
+#include <almath/scenegraph/kinematicstate.h>
+
+#include <benchmark/benchmark.h>
+#include <boost/property_tree/xml_parser.hpp>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Forward kinematics of a serial chain of revolute joints about x, y and
+// z: KinematicModel against the products of Transform, joint by joint.
+// Argument: the number of joints.
+//
+// Incremental forward kinematics of a tree of 5 chains of 6 joints, such
+// as a humanoid, when one joint of one chain changes at each tick:
+// KinematicState against a full computation.
+//
+// The Jacobian of the last link of the chain, in the mixed frame, from the
+// poses of a forward kinematics.
+//
+// Batched forward kinematics of the 5 x 6 joint tree for 4096
+// configurations: the single forward kinematics in a loop, against the
+// batched one; argument: the number of threads.
+//
+// Inverse kinematics of the last link of a 6 joint chain for 1000 reachable
+// targets, from guesses 0.2 rad away; argument: the number of threads.
+
+namespace
+{
+  const char* const kAxes[3] = {"1 0 0", "0 1 0", "0 0 1"};
+
+  std::string makeUrdf(int pJoints)
+  {
+    std::ostringstream lXml;
+    lXml << "<robot name=\"chain\">\n  <link name=\"l0\"/>\n";
+    for (int i = 1; i <= pJoints; ++i)
+    {
+      lXml << "  <link name=\"l" << i << "\"/>\n"
+           << "  <joint name=\"j" << i << "\" type=\"revolute\">\n"
+           << "    <parent link=\"l" << i - 1 << "\"/>\n"
+           << "    <child link=\"l" << i << "\"/>\n"
+           << "    <origin xyz=\"0 0.02 0.1\" rpy=\"0.1 0 0.3\"/>\n"
+           << "    <axis xyz=\"" << kAxes[i % 3] << "\"/>\n"
+           << "  </joint>\n";
+    }
+    lXml << "</robot>\n";
+    return lXml.str();
+  }
+
+  // pChains chains of pJoints joints, from the root link
+  std::string makeTreeUrdf(int pChains, int pJoints)
+  {
+    std::ostringstream lXml;
+    lXml << "<robot name=\"tree\">\n  <link name=\"root\"/>\n";
+    for (int c = 0; c < pChains; ++c)
+    {
+      for (int i = 0; i < pJoints; ++i)
+      {
+        lXml << "  <link name=\"l" << c << "_" << i << "\"/>\n"
+             << "  <joint name=\"j" << c << "_" << i
+             << "\" type=\"revolute\">\n"
+             << "    <parent link=\"";
+        if (i == 0)
+        {
+          lXml << "root";
+        }
+        else
+        {
+          lXml << "l" << c << "_" << i - 1;
+        }
+        lXml << "\"/>\n"
+             << "    <child link=\"l" << c << "_" << i << "\"/>\n"
+             << "    <origin xyz=\"0 0.02 0.1\" rpy=\"0.1 0 0.3\"/>\n"
+             << "    <axis xyz=\"" << kAxes[i % 3] << "\"/>\n"
+             << "  </joint>\n";
+      }
+    }
+    lXml << "</robot>\n";
+    return lXml.str();
+  }
+
+  AL::Math::KinematicModel makeModel(const std::string& pUrdf)
+  {
+    std::istringstream lStream(pUrdf);
+    AL::urdf::ptree lDocument;
+    boost::property_tree::xml_parser::read_xml(lStream, lDocument);
+    AL::urdf::RobotTree lTree(lDocument.get_child("robot"));
+    return AL::Math::KinematicModel(lTree);
+  }
+
+  std::vector<float> makeConfiguration(std::size_t pSize)
+  {
+    std::vector<float> lQ(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      lQ[i] = 0.1f * static_cast<float>(i % 11u) - 0.5f;
+    }
+    return lQ;
+  }
+
+  void BM_ForwardKinematics_Eager(benchmark::State& state)
+  {
+    const int lJoints = static_cast<int>(state.range(0));
+    const AL::Math::Transform lOrigin =
+        AL::Math::Transform::fromPosition(0.0f, 0.02f, 0.1f,
+                                          0.1f, 0.0f, 0.3f);
+    const std::vector<float> lQ = makeConfiguration(lJoints);
+    std::vector<AL::Math::Transform> lPoses(lJoints + 1);
+    for (auto _ : state)
+    {
+      for (int i = 1; i <= lJoints; ++i)
+      {
+        const float lAngle = lQ[i - 1];
+        const AL::Math::Transform lMotion =
+            (i % 3 == 0) ? AL::Math::Transform::fromRotX(lAngle) :
+            (i % 3 == 1) ? AL::Math::Transform::fromRotY(lAngle) :
+                           AL::Math::Transform::fromRotZ(lAngle);
+        lPoses[i] = lPoses[i - 1] * lOrigin * lMotion;
+      }
+      benchmark::DoNotOptimize(lPoses.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ForwardKinematics_Eager)->Arg(6)->Arg(30);
+
+  void BM_ForwardKinematics_Model(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel =
+        makeModel(makeUrdf(static_cast<int>(state.range(0))));
+    const std::vector<float> lQ = makeConfiguration(lModel.variableCount());
+    std::vector<AL::Math::Transform> lPoses(lModel.linkCount());
+    for (auto _ : state)
+    {
+      lModel.forwardKinematics(lQ.data(), lPoses.data());
+      benchmark::DoNotOptimize(lPoses.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ForwardKinematics_Model)->Arg(6)->Arg(30);
+
+  void BM_Jacobian(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel =
+        makeModel(makeUrdf(static_cast<int>(state.range(0))));
+    const std::vector<float> lQ = makeConfiguration(lModel.variableCount());
+    std::vector<AL::Math::Transform> lPoses(lModel.linkCount());
+    lModel.forwardKinematics(lQ.data(), lPoses.data());
+    std::vector<float> lJacobian(6u * lModel.variableCount());
+    for (auto _ : state)
+    {
+      lModel.jacobian(lPoses.data(), lModel.linkCount() - 1u,
+                      AL::Math::KinematicModel::JACOBIAN_MIXED,
+                      lJacobian.data());
+      benchmark::DoNotOptimize(lJacobian.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Jacobian)->Arg(6)->Arg(30);
+
+  void BM_ForwardKinematicsTree_Full(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel = makeModel(makeTreeUrdf(5, 6));
+    std::vector<float> lQ = makeConfiguration(lModel.variableCount());
+    std::vector<AL::Math::Transform> lPoses(lModel.linkCount());
+    std::size_t lTick = 0u;
+    for (auto _ : state)
+    {
+      lQ[(7u * lTick++) % lQ.size()] += 0.01f;
+      lModel.forwardKinematics(lQ.data(), lPoses.data());
+      benchmark::DoNotOptimize(lPoses.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  BENCHMARK(BM_ForwardKinematicsTree_Full);
+
+  void BM_ForwardKinematicsTree_Incremental(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel = makeModel(makeTreeUrdf(5, 6));
+    AL::Math::KinematicState lState(lModel);
+    lState.setVariables(makeConfiguration(lModel.variableCount()));
+    std::size_t lTick = 0u;
+    for (auto _ : state)
+    {
+      const std::size_t lVariable = (7u * lTick++) % lModel.variableCount();
+      lState.setVariable(lVariable, lState.variable(lVariable) + 0.01f);
+      benchmark::DoNotOptimize(lState.poses().data());
+      benchmark::ClobberMemory();
+    }
+  }
+  BENCHMARK(BM_ForwardKinematicsTree_Incremental);
+
+  void BM_ForwardKinematicsBatch_Loop(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel = makeModel(makeTreeUrdf(5, 6));
+    const std::size_t lCount = 4096u;
+    const std::vector<float> lQ =
+        makeConfiguration(lCount * lModel.variableCount());
+    std::vector<AL::Math::Transform> lPoses(lCount * lModel.linkCount());
+    for (auto _ : state)
+    {
+      for (std::size_t k = 0u; k < lCount; ++k)
+      {
+        lModel.forwardKinematics(lQ.data() + k * lModel.variableCount(),
+                                 lPoses.data() + k * lModel.linkCount());
+      }
+      benchmark::DoNotOptimize(lPoses.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * lCount);
+  }
+  BENCHMARK(BM_ForwardKinematicsBatch_Loop);
+
+  void BM_ForwardKinematicsBatch(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel = makeModel(makeTreeUrdf(5, 6));
+    const std::size_t lCount = 4096u;
+    const std::vector<float> lQ =
+        makeConfiguration(lCount * lModel.variableCount());
+    std::vector<AL::Math::TransformBatch> lPoses;
+    for (auto _ : state)
+    {
+      lModel.forwardKinematics(lQ.data(), lCount, lPoses,
+                               static_cast<unsigned int>(state.range(0)));
+      benchmark::DoNotOptimize(lPoses.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * lCount);
+  }
+  BENCHMARK(BM_ForwardKinematicsBatch)->Arg(1)->Arg(4)->UseRealTime();
+
+  void BM_InverseKinematics(benchmark::State& state)
+  {
+    const AL::Math::KinematicModel lModel = makeModel(makeUrdf(6));
+    const std::size_t lVariables = lModel.variableCount();
+    const std::size_t lLink = lModel.linkCount() - 1u;
+    const std::size_t lCount = 1000u;
+    std::vector<AL::Math::Transform> lTargets(lCount);
+    std::vector<float> lGuesses(lCount * lVariables);
+    std::vector<AL::Math::Transform> lPoses;
+    for (std::size_t k = 0u; k < lCount; ++k)
+    {
+      std::vector<float> lQ(lVariables);
+      for (std::size_t v = 0u; v < lVariables; ++v)
+      {
+        lQ[v] = std::sin(0.7f * k + 1.3f * v);
+        lGuesses[k * lVariables + v] = lQ[v] + ((k + v) % 2 ? 0.2f : -0.2f);
+      }
+      lModel.forwardKinematics(lQ, lPoses);
+      lTargets[k] = lPoses[lLink];
+    }
+    const AL::Math::InverseKinematics lSolver(lModel);
+    std::vector<float> lQ(lGuesses.size());
+    std::vector<AL::Math::InverseKinematics::Result> lResults(lCount);
+    for (auto _ : state)
+    {
+      lQ = lGuesses;
+      lSolver.solve(lTargets.data(), lCount, lLink, lQ.data(),
+                    lResults.data(),
+                    static_cast<unsigned int>(state.range(0)));
+      benchmark::DoNotOptimize(lQ.data());
+      benchmark::ClobberMemory();
+    }
+    std::size_t lConverged = 0u;
+    for (std::size_t k = 0u; k < lCount; ++k)
+    {
+      lConverged += lResults[k].converged ? 1u : 0u;
+    }
+    state.counters["converged"] =
+        static_cast<double>(lConverged) / static_cast<double>(lCount);
+    state.SetItemsProcessed(state.iterations() * lCount);
+  }
+  BENCHMARK(BM_InverseKinematics)->Arg(1)->Arg(4)->UseRealTime();
+}
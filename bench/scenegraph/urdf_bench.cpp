@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/scenegraph/urdf.h>
+
+#include <benchmark/benchmark.h>
+#include <boost/property_tree/xml_parser.hpp>
+#include <sstream>
+#include <string>
+
+// Load a robot description: parse the URDF xml, index it with a RobotTree
+// and read the origin of each joint.
+// Argument: the number of links of the kinematic chain.
+
+namespace
+{
+  std::string makeUrdf(int pLinks)
+  {
+    std::ostringstream lXml;
+    lXml << "<robot name=\"chain\">\n";
+    for (int i = 0; i < pLinks; ++i)
+    {
+      lXml << "  <link name=\"l" << i << "\">\n"
+           << "    <inertial>\n"
+           << "      <origin xyz=\"0.01 0 0.05\" rpy=\"0 0 0\"/>\n"
+           << "      <mass value=\"0.5\"/>\n"
+           << "      <inertia ixx=\"0.001\" ixy=\"0\" ixz=\"0\" iyy=\"0.001\""
+           << " iyz=\"0\" izz=\"0.002\"/>\n"
+           << "    </inertial>\n"
+           << "  </link>\n";
+      if (i > 0)
+      {
+        lXml << "  <joint name=\"j" << i << "\" type=\"revolute\">\n"
+             << "    <parent link=\"l" << i - 1 << "\"/>\n"
+             << "    <child link=\"l" << i << "\"/>\n"
+             << "    <origin xyz=\"0 0.02 0.1\" rpy=\"0.1 0 1.5707963\"/>\n"
+             << "    <axis xyz=\"0 0 1\"/>\n"
+             << "    <limit lower=\"-2\" upper=\"2\" effort=\"1\""
+             << " velocity=\"5\"/>\n"
+             << "  </joint>\n";
+      }
+    }
+    lXml << "</robot>\n";
+    return lXml.str();
+  }
+
+  void BM_UrdfParse(benchmark::State& state)
+  {
+    const std::string lXml = makeUrdf(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+      std::istringstream lStream(lXml);
+      AL::urdf::ptree lDocument;
+      boost::property_tree::xml_parser::read_xml(lStream, lDocument);
+      AL::urdf::ptree& lRobot = lDocument.get_child("robot");
+      AL::urdf::RobotTree lTree(lRobot);
+      double lSum = 0.0;
+      for (const auto& lChild : lRobot)
+      {
+        if (lChild.first == "joint")
+        {
+          lSum += AL::urdf::Joint(lChild.second).origin().xyz()[2];
+        }
+      }
+      benchmark::DoNotOptimize(lSum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_UrdfParse)->Arg(30)->Arg(300);
+}
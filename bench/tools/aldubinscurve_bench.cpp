@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/aldubinscurve.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// Plan Dubins paths to a set of targets around the robot.
+// Argument: the number of targets.
+
+namespace
+{
+  void BM_GetDubinsSolutions(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    std::vector<AL::Math::Pose2D> lTargets(lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      // at least 4 radii away, as getDubinsSolutions requires
+      const float f = 0.37f * static_cast<float>(i);
+      const float lDistance = 0.7f + 0.2f*std::sin(2.0f*f);
+      lTargets[i] = AL::Math::Pose2D(lDistance*std::cos(f),
+                                     lDistance*std::sin(f),
+                                     std::sin(0.3f*f));
+    }
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        benchmark::DoNotOptimize(
+              AL::Math::getDubinsSolutions(lTargets[i], 0.1f));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_GetDubinsSolutions)->Arg(1000);
+}
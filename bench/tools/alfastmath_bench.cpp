@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alfastmath.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// std trigonometry against the polynomials of alfastmath.h, one value at a
+// time and over arrays (vectorized kernels).
+// Argument: the number of values.
+
+namespace
+{
+  std::vector<float> makeValues(std::size_t pSize, float pScale)
+  {
+    std::vector<float> lValues(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      lValues[i] = pScale * std::sin(0.37f * static_cast<float>(i));
+    }
+    return lValues;
+  }
+
+  void BM_SinCos_Std(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lAngles = makeValues(lSize, 10.0f);
+    std::vector<float> lSin(lSize);
+    std::vector<float> lCos(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lSin[i] = std::sin(lAngles[i]);
+        lCos[i] = std::cos(lAngles[i]);
+      }
+      benchmark::DoNotOptimize(lSin.data());
+      benchmark::DoNotOptimize(lCos.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_SinCos_Std)->Arg(4096);
+
+  void BM_SinCos_Fast(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lAngles = makeValues(lSize, 10.0f);
+    std::vector<float> lSin(lSize);
+    std::vector<float> lCos(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::fastSinCos(lAngles[i], lSin[i], lCos[i]);
+      }
+      benchmark::DoNotOptimize(lSin.data());
+      benchmark::DoNotOptimize(lCos.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_SinCos_Fast)->Arg(4096);
+
+  void BM_SinCos_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lAngles = makeValues(lSize, 10.0f);
+    std::vector<float> lSin(lSize);
+    std::vector<float> lCos(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::fastSinCos(lAngles.data(), lSin.data(), lCos.data(), lSize);
+      benchmark::DoNotOptimize(lSin.data());
+      benchmark::DoNotOptimize(lCos.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_SinCos_Array)->Arg(4096);
+
+  void BM_Atan2_Std(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lY = makeValues(lSize, 2.0f);
+    const std::vector<float> lX = makeValues(lSize + 7u, -3.0f);
+    std::vector<float> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = std::atan2(lY[i], lX[i + 7u]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Atan2_Std)->Arg(4096);
+
+  void BM_Atan2_Fast(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lY = makeValues(lSize, 2.0f);
+    const std::vector<float> lX = makeValues(lSize + 7u, -3.0f);
+    std::vector<float> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::fastAtan2(lY[i], lX[i + 7u]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Atan2_Fast)->Arg(4096);
+
+  void BM_Atan2_Approx(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lY = makeValues(lSize, 2.0f);
+    const std::vector<float> lX = makeValues(lSize + 7u, -3.0f);
+    std::vector<float> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::approxAtan2(lY[i], lX[i + 7u]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Atan2_Approx)->Arg(4096);
+
+  void BM_Atan2_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<float> lY = makeValues(lSize, 2.0f);
+    const std::vector<float> lX = makeValues(lSize + 7u, -3.0f);
+    std::vector<float> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::fastAtan2(lY.data(), lX.data() + 7u, lOut.data(), lSize);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Atan2_Array)->Arg(4096);
+}
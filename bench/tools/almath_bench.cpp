@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/almath.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// Clamp command vectors inside joint limits: one value at a time against
+// the array clipData.
+// Argument: the number of joints.
+
+namespace
+{
+  struct Limits
+  {
+    explicit Limits(std::size_t pSize)
+      : min(pSize)
+      , max(pSize)
+      , data(pSize)
+    {
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        const float f = static_cast<float>(i);
+        min[i] = -1.0f - 0.01f*f;
+        max[i] = 1.0f + 0.02f*f;
+        data[i] = 2.0f*std::sin(1.3f*f);
+      }
+    }
+
+    std::vector<float> min;
+    std::vector<float> max;
+    std::vector<float> data;
+  };
+
+  void BM_ClipData_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const Limits lLimits(lSize);
+    std::vector<float> lData(lSize);
+    for (auto _ : state)
+    {
+      lData = lLimits.data;
+      std::size_t lCount = 0u;
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        if (AL::Math::clipData(lLimits.min[i], lLimits.max[i], lData[i]))
+        {
+          ++lCount;
+        }
+      }
+      benchmark::DoNotOptimize(lCount);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ClipData_Scalar)->Arg(26)->Arg(1024);
+
+  void BM_ClipData_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const Limits lLimits(lSize);
+    std::vector<float> lData(lSize);
+    for (auto _ : state)
+    {
+      lData = lLimits.data;
+      std::size_t lCount = AL::Math::clipData(lLimits.min.data(),
+                                              lLimits.max.data(),
+                                              lData.data(), lSize);
+      benchmark::DoNotOptimize(lCount);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ClipData_Array)->Arg(26)->Arg(1024);
+}
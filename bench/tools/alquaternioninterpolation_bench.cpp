@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alquaternioninterpolation.h>
+#include <almath/tools/altransformhelpers.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// Resample an orientation trajectory: 100 keys, 100 samples per segment.
+namespace
+{
+  const std::size_t kKeyCount = 100u;
+  const std::size_t kSamplesPerSegment = 100u;
+  const float kDt = 1.0f / static_cast<float>(kSamplesPerSegment);
+
+  std::vector<AL::Math::Quaternion> makeKeys()
+  {
+    std::vector<AL::Math::Quaternion> lKeys(kKeyCount);
+    for (std::size_t i = 0u; i < kKeyCount; ++i)
+    {
+      const float f = static_cast<float>(i);
+      const float lX = std::sin(0.3f*f);
+      const float lY = std::cos(0.7f*f);
+      const float lZ = 0.5f;
+      const float lNorm = std::sqrt(lX*lX + lY*lY + lZ*lZ);
+      lKeys[i] = AL::Math::quaternionFromAngleAndAxisRotation(
+            0.2f*f, lX/lNorm, lY/lNorm, lZ/lNorm);
+    }
+    return lKeys;
+  }
+
+  void setItems(benchmark::State& state)
+  {
+    state.SetItemsProcessed(state.iterations() *
+                            (kKeyCount - 1u) * kSamplesPerSegment);
+  }
+
+  // the reference: relative motion as a Transform, scaled in the tangent
+  // space and converted back to a Quaternion
+  void BM_QuaternionResample_ThroughRotation(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::Transform> lStarts(kKeyCount - 1u);
+    std::vector<AL::Math::Velocity6D> lLogs(kKeyCount - 1u);
+    for (std::size_t s = 0u; s + 1u < kKeyCount; ++s)
+    {
+      lStarts[s] = AL::Math::transformFromQuaternion(lKeys[s]);
+      lLogs[s] = AL::Math::transformLogarithm(
+            AL::Math::transformInverse(lStarts[s]) *
+            AL::Math::transformFromQuaternion(lKeys[s+1u]));
+    }
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s + 1u < kKeyCount; ++s)
+      {
+        for (std::size_t i = 0u; i < kSamplesPerSegment; ++i)
+        {
+          lOut[i] = AL::Math::quaternionFromTransform(
+                lStarts[s] * AL::Math::velocityExponential(
+                  lLogs[s] * (kDt*static_cast<float>(i))));
+        }
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_ThroughRotation);
+
+  void BM_QuaternionResample_Nlerp(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s + 1u < kKeyCount; ++s)
+      {
+        for (std::size_t i = 0u; i < kSamplesPerSegment; ++i)
+        {
+          lOut[i] = AL::Math::quaternionNlerp(lKeys[s], lKeys[s+1u],
+                                              kDt*static_cast<float>(i));
+        }
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_Nlerp);
+
+  void BM_QuaternionResample_Slerp(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s + 1u < kKeyCount; ++s)
+      {
+        for (std::size_t i = 0u; i < kSamplesPerSegment; ++i)
+        {
+          lOut[i] = AL::Math::quaternionSlerp(lKeys[s], lKeys[s+1u],
+                                              kDt*static_cast<float>(i));
+        }
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_Slerp);
+
+  void BM_QuaternionResample_SlerpSegment(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::QuaternionSlerpSegment> lSegments(kKeyCount - 1u);
+    AL::Math::quaternionSlerpSegments(lKeys.data(), kKeyCount,
+                                      lSegments.data());
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s < lSegments.size(); ++s)
+      {
+        for (std::size_t i = 0u; i < kSamplesPerSegment; ++i)
+        {
+          lOut[i] = lSegments[s].interpolate(kDt*static_cast<float>(i));
+        }
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_SlerpSegment);
+
+  void BM_QuaternionResample_SlerpUniform(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::QuaternionSlerpSegment> lSegments(kKeyCount - 1u);
+    AL::Math::quaternionSlerpSegments(lKeys.data(), kKeyCount,
+                                      lSegments.data());
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s < lSegments.size(); ++s)
+      {
+        AL::Math::quaternionSlerpUniform(lSegments[s], 0.0f, kDt,
+                                         kSamplesPerSegment, lOut.data());
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_SlerpUniform);
+
+  void BM_QuaternionResample_SquadSegment(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::QuaternionSquadSegment> lSegments(kKeyCount - 1u);
+    AL::Math::quaternionSquadSegments(lKeys.data(), kKeyCount,
+                                      lSegments.data());
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s < lSegments.size(); ++s)
+      {
+        for (std::size_t i = 0u; i < kSamplesPerSegment; ++i)
+        {
+          lOut[i] = lSegments[s].interpolate(kDt*static_cast<float>(i));
+        }
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_SquadSegment);
+
+  void BM_QuaternionResample_SquadUniform(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Quaternion> lKeys = makeKeys();
+    std::vector<AL::Math::QuaternionSquadSegment> lSegments(kKeyCount - 1u);
+    AL::Math::quaternionSquadSegments(lKeys.data(), kKeyCount,
+                                      lSegments.data());
+    std::vector<AL::Math::Quaternion> lOut(kSamplesPerSegment);
+    for (auto _ : state)
+    {
+      for (std::size_t s = 0u; s < lSegments.size(); ++s)
+      {
+        AL::Math::quaternionSquadUniform(lSegments[s], 0.0f, kDt,
+                                         kSamplesPerSegment, lOut.data());
+        benchmark::DoNotOptimize(lOut.data());
+      }
+    }
+    setItems(state);
+  }
+  BENCHMARK(BM_QuaternionResample_SquadUniform);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alsimd.h>
+#include <almath/tools/almath.h>
+#include <almath/types/altransform.h>
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Each benchmark takes the SimdLevel as argument. Levels which are not
+// supported by the host are reported as skipped.
+
+namespace
+{
+  const std::size_t SIZE = 256u;
+
+  std::vector<AL::Math::Transform> makeTransforms()
+  {
+    std::vector<AL::Math::Transform> lTransforms(SIZE);
+    for (std::size_t i = 0u; i < SIZE; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i);
+      lTransforms[i] = AL::Math::Transform::fromPosition(
+            f, -f, 0.5f, 0.3f + f, -0.2f, 0.1f - f);
+    }
+    return lTransforms;
+  }
+
+  std::vector<AL::Math::Rotation> makeRotations()
+  {
+    std::vector<AL::Math::Rotation> lRotations(SIZE);
+    for (std::size_t i = 0u; i < SIZE; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i);
+      lRotations[i] = AL::Math::Rotation::from3DRotation(0.3f + f, -0.2f, f);
+    }
+    return lRotations;
+  }
+
+  // select the level of the benchmark, return false if unsupported
+  bool setLevel(benchmark::State& state)
+  {
+    const AL::Math::SimdLevel lLevel =
+        static_cast<AL::Math::SimdLevel>(state.range(0));
+    if (AL::Math::setSimdLevel(lLevel) != lLevel)
+    {
+      state.SkipWithError("SIMD level not supported");
+      return false;
+    }
+    return true;
+  }
+
+  void BM_SimdTransformMultiply(benchmark::State& state)
+  {
+    if (!setLevel(state))
+      return;
+    std::vector<AL::Math::Transform> lChains = makeTransforms();
+    const std::vector<AL::Math::Transform> lJoints = makeTransforms();
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < SIZE; ++i)
+      {
+        lChains[i] = lChains[i] * lJoints[i];
+      }
+      benchmark::DoNotOptimize(lChains.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+  }
+  BENCHMARK(BM_SimdTransformMultiply)->DenseRange(0, 2);
+
+  void BM_SimdTransformPreMultiply(benchmark::State& state)
+  {
+    if (!setLevel(state))
+      return;
+    std::vector<AL::Math::Transform> lChains = makeTransforms();
+    const std::vector<AL::Math::Transform> lJoints = makeTransforms();
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < SIZE; ++i)
+      {
+        AL::Math::transformPreMultiply(lJoints[i], lChains[i]);
+      }
+      benchmark::DoNotOptimize(lChains.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+  }
+  BENCHMARK(BM_SimdTransformPreMultiply)->DenseRange(0, 2);
+
+  void BM_SimdTransformInverse(benchmark::State& state)
+  {
+    if (!setLevel(state))
+      return;
+    const std::vector<AL::Math::Transform> lIn = makeTransforms();
+    std::vector<AL::Math::Transform> lOut(SIZE);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < SIZE; ++i)
+      {
+        lOut[i] = lIn[i].inverse();
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+  }
+  BENCHMARK(BM_SimdTransformInverse)->DenseRange(0, 2);
+
+  void BM_SimdRotationMultiply(benchmark::State& state)
+  {
+    if (!setLevel(state))
+      return;
+    std::vector<AL::Math::Rotation> lChains = makeRotations();
+    const std::vector<AL::Math::Rotation> lJoints = makeRotations();
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < SIZE; ++i)
+      {
+        lChains[i] = lChains[i] * lJoints[i];
+      }
+      benchmark::DoNotOptimize(lChains.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+  }
+  BENCHMARK(BM_SimdRotationMultiply)->DenseRange(0, 2);
+
+  void BM_SimdRotationApply(benchmark::State& state)
+  {
+    if (!setLevel(state))
+      return;
+    const std::vector<AL::Math::Rotation> lRotations = makeRotations();
+    std::vector<AL::Math::Position3D> lPositions(SIZE,
+                                                 AL::Math::Position3D(1.0f, 2.0f, 3.0f));
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < SIZE; ++i)
+      {
+        lPositions[i] = lRotations[i] * lPositions[i];
+      }
+      benchmark::DoNotOptimize(lPositions.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+  }
+  BENCHMARK(BM_SimdRotationApply)->DenseRange(0, 2);
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/altransformhelpers.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  std::vector<AL::Math::Position3D> makeCloud(std::size_t pSize)
+  {
+    std::vector<AL::Math::Position3D> lCloud(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i % 1000u);
+      lCloud[i] = AL::Math::Position3D(f, 1.0f - f, 0.5f + f);
+    }
+    return lCloud;
+  }
+
+  const AL::Math::Transform kTransform =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+
+  // one point at a time, with the single Position3D overload
+  void BM_ChangeReferencePosition3D_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Position3D> lIn = makeCloud(lSize);
+    std::vector<AL::Math::Position3D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::changeReferencePosition3D(kTransform, lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ChangeReferencePosition3D_Scalar)
+  ->RangeMultiplier(10)->Range(1000, 1000000);
+
+  // the array overload, range(1) is the maximum number of threads
+  void BM_ChangeReferencePosition3D_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const unsigned int lThreads = static_cast<unsigned int>(state.range(1));
+    const std::vector<AL::Math::Position3D> lIn = makeCloud(lSize);
+    std::vector<AL::Math::Position3D> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::changeReferencePosition3D(kTransform, lIn.data(), lOut.data(),
+                                          lSize, lThreads);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ChangeReferencePosition3D_Array)
+  ->UseRealTime()
+  ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1, 0}});
+
+  void BM_ChangeReferenceVelocity6D(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    std::vector<AL::Math::Velocity6D> lIn(lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i % 1000u);
+      lIn[i] = AL::Math::Velocity6D(f, -f, 0.5f, 0.1f, f, 0.2f - f);
+    }
+    std::vector<AL::Math::Velocity6D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::changeReferenceVelocity6D(kTransform, lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_ChangeReferenceVelocity6D)->Arg(10000);
+
+  std::vector<AL::Math::Transform> makeRotations(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lRotations(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.37f * static_cast<float>(i);
+      lRotations[i] = AL::Math::Transform::fromPosition(
+            0.0f, 0.0f, 0.0f,
+            std::sin(f), 1.5f*std::cos(f), 3.0f*std::sin(0.3f*f));
+    }
+    return lRotations;
+  }
+
+  void BM_QuaternionFromTransform(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Transform> lIn = makeRotations(lSize);
+    std::vector<AL::Math::Quaternion> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::quaternionFromTransform(lIn[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_QuaternionFromTransform)->Arg(10000);
+
+  void BM_TransformFromQuaternion(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Transform> lRotations = makeRotations(lSize);
+    std::vector<AL::Math::Quaternion> lIn(lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      lIn[i] = AL::Math::quaternionFromTransform(lRotations[i]);
+    }
+    std::vector<AL::Math::Transform> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::transformFromQuaternion(lIn[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformFromQuaternion)->Arg(10000);
+
+  std::vector<AL::Math::Velocity6D> makeTwists(std::size_t pSize)
+  {
+    std::vector<AL::Math::Velocity6D> lTwists(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.37f * static_cast<float>(i);
+      lTwists[i] = AL::Math::Velocity6D(std::sin(f), 0.5f, std::cos(f),
+                                        std::sin(2.0f*f), 0.8f*std::cos(3.0f*f),
+                                        0.3f*std::sin(5.0f*f));
+    }
+    return lTwists;
+  }
+
+  void BM_VelocityExponential_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lIn = makeTwists(lSize);
+    std::vector<AL::Math::Transform> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::velocityExponentialInPlace(lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_VelocityExponential_Scalar)->Arg(10000);
+
+  void BM_VelocityExponential_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lIn = makeTwists(lSize);
+    std::vector<AL::Math::Transform> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::velocityExponential(lIn.data(), lOut.data(), lSize);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_VelocityExponential_Array)->Arg(10000);
+
+  void BM_TransformLogarithm_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lTwists = makeTwists(lSize);
+    std::vector<AL::Math::Transform> lIn(lSize);
+    AL::Math::velocityExponential(lTwists.data(), lIn.data(), lSize);
+    std::vector<AL::Math::Velocity6D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::transformLogarithmInPlace(lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformLogarithm_Scalar)->Arg(10000);
+
+  void BM_TransformLogarithm_Array(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lTwists = makeTwists(lSize);
+    std::vector<AL::Math::Transform> lIn(lSize);
+    AL::Math::velocityExponential(lTwists.data(), lIn.data(), lSize);
+    std::vector<AL::Math::Velocity6D> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::transformLogarithm(lIn.data(), lOut.data(), lSize);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformLogarithm_Array)->Arg(10000);
+
+  void BM_VelocityExponentialLeftJacobian(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lIn = makeTwists(lSize);
+    std::vector<float> lOut(36u*lSize);
+    for (auto _ : state)
+    {
+      AL::Math::velocityExponentialLeftJacobian(lIn.data(), lOut.data(),
+                                                lSize);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_VelocityExponentialLeftJacobian)->Arg(10000);
+
+  // Argument: the number of samples, and the maximum number of threads.
+  void BM_TransformRobustMean(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Velocity6D> lTwists = makeTwists(lSize);
+    std::vector<AL::Math::Transform> lIn(lSize);
+    AL::Math::velocityExponential(lTwists.data(), lIn.data(), lSize);
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(AL::Math::transformRobustMean(
+            lIn.data(), lSize, 0.1f, 1.0f, 20u, 0.0f, NULL,
+            static_cast<unsigned int>(state.range(1))));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformRobustMean)->Args({10000, 1})->Args({10000, 0});
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/alpose2d.h>
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+// Evaluate candidate trajectories: the relative motion between two arrays
+// of poses, and the poses of an array of steps seen from the robot.
+// Arguments: the number of poses and, for the batched versions, the
+// maximum number of threads.
+
+namespace
+{
+  std::vector<AL::Math::Pose2D> makePoses(std::size_t pSize, float pPhase)
+  {
+    std::vector<AL::Math::Pose2D> lPoses(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i) + pPhase;
+      lPoses[i] = AL::Math::Pose2D(std::cos(f), std::sin(2.0f*f), 3.0f*f);
+    }
+    return lPoses;
+  }
+
+  void BM_Pose2dDiff_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Pose2D> lPos1 = makePoses(lSize, 0.0f);
+    const std::vector<AL::Math::Pose2D> lPos2 = makePoses(lSize, 0.5f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::pose2dDiff(lPos1[i], lPos2[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2dDiff_Scalar)->Arg(256)->Arg(65536)->Arg(1 << 20);
+
+  void BM_Pose2dDiff_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const unsigned int lThreads = static_cast<unsigned int>(state.range(1));
+    const std::vector<AL::Math::Pose2D> lPos1 = makePoses(lSize, 0.0f);
+    const std::vector<AL::Math::Pose2D> lPos2 = makePoses(lSize, 0.5f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::pose2dDiff(lPos1.data(), lPos2.data(), lOut.data(), lSize,
+                           lThreads);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2dDiff_Batch)
+  ->Args({256, 1})->Args({65536, 1})->Args({1 << 20, 1})
+  ->Args({65536, 0})->Args({1 << 20, 0})->UseRealTime();
+
+  void BM_Pose2DMultiply_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Pose2D> lSteps = makePoses(lSize, 0.0f);
+    const AL::Math::Pose2D lRobot(0.3f, -1.2f, 2.5f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = lSteps[i] * lRobot;
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2DMultiply_Scalar)->Arg(256)->Arg(65536)->Arg(1 << 20);
+
+  void BM_Pose2DMultiply_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const unsigned int lThreads = static_cast<unsigned int>(state.range(1));
+    const std::vector<AL::Math::Pose2D> lSteps = makePoses(lSize, 0.0f);
+    const AL::Math::Pose2D lRobot(0.3f, -1.2f, 2.5f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::pose2DMultiply(lSteps.data(), lRobot, lOut.data(), lSize,
+                               lThreads);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2DMultiply_Batch)
+  ->Args({256, 1})->Args({65536, 1})->Args({1 << 20, 1})
+  ->Args({65536, 0})->Args({1 << 20, 0})->UseRealTime();
+
+  void BM_Pose2DInverse_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Pose2D> lIn = makePoses(lSize, 0.0f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lOut[i] = AL::Math::pose2DInverse(lIn[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2DInverse_Scalar)->Arg(65536);
+
+  void BM_Pose2DInverse_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Pose2D> lIn = makePoses(lSize, 0.0f);
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::pose2DInverse(lIn.data(), lOut.data(), lSize);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_Pose2DInverse_Batch)->Arg(65536);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/alquattransform.h>
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Forward kinematics of a deep chain: the global pose of each link is the
+// composition of the local poses of its ancestors. range(0) is the number
+// of links, the rotation part is renormalized every range(1) links.
+namespace
+{
+  std::vector<AL::Math::Transform> makeLocals(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lLocals(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i % 1000u);
+      lLocals[i] = AL::Math::Transform::fromPosition(
+            0.1f, f, 0.05f, 0.2f + f, -0.1f, 0.3f - f);
+    }
+    return lLocals;
+  }
+
+  void BM_Chain_Transform(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::size_t lPeriod = static_cast<std::size_t>(state.range(1));
+    const std::vector<AL::Math::Transform> lLocals = makeLocals(lSize);
+    std::vector<AL::Math::Transform> lGlobals(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::Transform lT;
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lT *= lLocals[i];
+        if (i % lPeriod == lPeriod - 1u)
+        {
+          lT.normalizeTransform();
+        }
+        lGlobals[i] = lT;
+      }
+      benchmark::DoNotOptimize(lGlobals.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            2 * sizeof(AL::Math::Transform));
+  }
+  BENCHMARK(BM_Chain_Transform)
+  ->Args({1000, 1})->Args({1000, 16})->Args({100000, 16});
+
+  void BM_Chain_QuatTransform(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::size_t lPeriod = static_cast<std::size_t>(state.range(1));
+    const std::vector<AL::Math::Transform> lTransforms = makeLocals(lSize);
+    std::vector<AL::Math::QuatTransform> lLocals(lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      lLocals[i] = AL::Math::quatTransformFromTransform(lTransforms[i]);
+    }
+    std::vector<AL::Math::QuatTransform> lGlobals(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::QuatTransform lQT;
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lQT *= lLocals[i];
+        if (i % lPeriod == lPeriod - 1u)
+        {
+          lQT.normalizeQuatTransform();
+        }
+        lGlobals[i] = lQT;
+      }
+      benchmark::DoNotOptimize(lGlobals.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            2 * sizeof(AL::Math::QuatTransform));
+  }
+  BENCHMARK(BM_Chain_QuatTransform)
+  ->Args({1000, 1})->Args({1000, 16})->Args({100000, 16});
+}
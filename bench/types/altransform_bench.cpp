@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/altransform.h>
+#include <almath/types/altransformexpression.h>
+#include <almath/tools/altransformhelpers.h>
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace
+{
+  std::vector<AL::Math::Transform> makeFrames(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lFrames(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.01f * static_cast<float>(i % 100u);
+      lFrames[i] = AL::Math::Transform::fromPosition(f, 0.2f, -f,
+                                                     f, 0.3f - f, 1.1f);
+    }
+    return lFrames;
+  }
+
+  const std::size_t kFrames = 1000u;
+
+  // change of frame of many transforms: inverse, then compose
+  void BM_FrameChange_InverseMultiply(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = lIn[0].inverse() * lIn[i];
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_FrameChange_InverseMultiply);
+
+  void BM_FrameChange_TransformDiff(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = AL::Math::transformDiff(lIn[0], lIn[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_FrameChange_TransformDiff);
+
+  void BM_FrameChange_InverseRigidMultiply(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        AL::Math::transformInverseRigidMultiply(lIn[0], lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_FrameChange_InverseRigidMultiply);
+
+  void BM_FrameChange_InverseRigidMultiplyArray(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      AL::Math::transformInverseRigidMultiply(lIn[0], lIn.data(),
+                                              lOut.data(), kFrames);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_FrameChange_InverseRigidMultiplyArray);
+
+  void BM_Inverse_Loop(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        AL::Math::transformInverse(lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_Inverse_Loop);
+
+  void BM_InverseRigid_Array(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      AL::Math::transformInverseRigid(lIn.data(), lOut.data(), kFrames);
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_InverseRigid_Array);
+
+  // a chain of four frames, as in forward kinematics: eager products
+  // against the expressions of altransformexpression.h
+  void BM_Chain_Eager(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames + 3u);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = lIn[i] * lIn[i + 1u] * lIn[i + 2u] * lIn[i + 3u];
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_Chain_Eager);
+
+  void BM_Chain_Lazy(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames + 3u);
+    std::vector<AL::Math::Transform> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = AL::Math::lazy(lIn[i]) * lIn[i + 1u] * lIn[i + 2u] *
+            lIn[i + 3u];
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_Chain_Lazy);
+
+  void BM_ChainPoint_Eager(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames + 3u);
+    const AL::Math::Position3D lTool(0.0f, 0.0f, 0.05f);
+    std::vector<AL::Math::Position3D> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = lIn[i] * lIn[i + 1u] * lIn[i + 2u] * lIn[i + 3u] * lTool;
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_ChainPoint_Eager);
+
+  void BM_ChainPoint_Lazy(benchmark::State& state)
+  {
+    const std::vector<AL::Math::Transform> lIn = makeFrames(kFrames + 3u);
+    const AL::Math::Position3D lTool(0.0f, 0.0f, 0.05f);
+    std::vector<AL::Math::Position3D> lOut(kFrames);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < kFrames; ++i)
+      {
+        lOut[i] = AL::Math::lazy(lIn[i]) * lIn[i + 1u] * lIn[i + 2u] *
+            lIn[i + 3u] * lTool;
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+  }
+  BENCHMARK(BM_ChainPoint_Lazy);
+}
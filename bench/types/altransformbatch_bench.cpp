@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/altransformbatch.h>
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace
+{
+  std::vector<AL::Math::Transform> makeTransforms(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lTransforms(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.001f * static_cast<float>(i);
+      lTransforms[i] = AL::Math::Transform::fromPosition(
+            f, -f, 0.5f, 0.3f + f, -0.2f, 0.1f - f);
+    }
+    return lTransforms;
+  }
+
+  // compose chains stored as std::vector<Transform>, one transform at a time
+  void BM_TransformMultiply_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    std::vector<AL::Math::Transform> lChains = makeTransforms(lSize);
+    const std::vector<AL::Math::Transform> lJoints = makeTransforms(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        lChains[i] *= lJoints[i];
+      }
+      benchmark::DoNotOptimize(lChains.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformMultiply_Scalar)->RangeMultiplier(8)->Range(64, 32768);
+
+  void BM_TransformMultiply_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    AL::Math::TransformBatch lChains(makeTransforms(lSize));
+    const AL::Math::TransformBatch lJoints(makeTransforms(lSize));
+    for (auto _ : state)
+    {
+      AL::Math::transformMultiply(lChains, lJoints, lChains);
+      benchmark::DoNotOptimize(lChains.data(AL::Math::TransformBatch::R1_C1));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformMultiply_Batch)->RangeMultiplier(8)->Range(64, 32768);
+
+  void BM_TransformPreMultiply_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    std::vector<AL::Math::Transform> lChains = makeTransforms(lSize);
+    const std::vector<AL::Math::Transform> lJoints = makeTransforms(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::transformPreMultiply(lJoints[i], lChains[i]);
+      }
+      benchmark::DoNotOptimize(lChains.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformPreMultiply_Scalar)->RangeMultiplier(8)->Range(64, 32768);
+
+  void BM_TransformPreMultiply_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    AL::Math::TransformBatch lChains(makeTransforms(lSize));
+    const AL::Math::TransformBatch lJoints(makeTransforms(lSize));
+    for (auto _ : state)
+    {
+      AL::Math::transformPreMultiply(lJoints, lChains);
+      benchmark::DoNotOptimize(lChains.data(AL::Math::TransformBatch::R1_C1));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformPreMultiply_Batch)->RangeMultiplier(8)->Range(64, 32768);
+
+  void BM_TransformInverse_Scalar(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Transform> lIn = makeTransforms(lSize);
+    std::vector<AL::Math::Transform> lOut(lSize);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0u; i < lSize; ++i)
+      {
+        AL::Math::transformInverse(lIn[i], lOut[i]);
+      }
+      benchmark::DoNotOptimize(lOut.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformInverse_Scalar)->RangeMultiplier(8)->Range(64, 32768);
+
+  void BM_TransformInverse_Batch(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const AL::Math::TransformBatch lIn(makeTransforms(lSize));
+    AL::Math::TransformBatch lOut(lSize);
+    for (auto _ : state)
+    {
+      AL::Math::transformInverse(lIn, lOut);
+      benchmark::DoNotOptimize(lOut.data(AL::Math::TransformBatch::R1_C1));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(BM_TransformInverse_Batch)->RangeMultiplier(8)->Range(64, 32768);
+}
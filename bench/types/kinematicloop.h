@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// A typical kinematic loop, compiled in almath_bench and, in header-inline
+// mode (see almath/inline/alinline.h), in almath_inline_bench.
+
+#pragma once
+#ifndef _LIBALMATH_BENCH_TYPES_KINEMATICLOOP_H_
+#define _LIBALMATH_BENCH_TYPES_KINEMATICLOOP_H_
+
+#include <almath/tools/altransformhelpers.h>
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace
+{
+  // the frames of a serial chain of pSize revolute joints
+  std::vector<AL::Math::Transform> makeChain(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lChain(pSize);
+    AL::Math::Transform lT;
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.1f * static_cast<float>(i % 7u);
+      lT *= AL::Math::Transform::fromPosition(0.05f, 0.0f, 0.1f,
+                                              f, 0.3f - f, 0.2f);
+      lChain[i] = lT;
+    }
+    return lChain;
+  }
+
+  // The columns of the Jacobian of the end point of the chain:
+  // (z_i x (p - o_i), z_i) for each joint of origin o_i and axis z_i.
+  // Returns the sum of the norms of the columns and the reach of the chain.
+  float kinematicLoop(
+    const std::vector<AL::Math::Transform>& pChain,
+    std::vector<AL::Math::Velocity6D>&      pColumns)
+  {
+    const AL::Math::Position3D lTool(0.0f, 0.0f, 0.05f);
+    const AL::Math::Position3D lEnd = pChain.back() * lTool;
+    float lSum = 0.0f;
+    for (std::size_t i = 0u; i < pChain.size(); ++i)
+    {
+      const AL::Math::Position3D lOrigin =
+          pChain[i] * AL::Math::Position3D();
+      const AL::Math::Position3D lAxis =
+          pChain[i] * AL::Math::Position3D(0.0f, 0.0f, 1.0f) - lOrigin;
+      const AL::Math::Position3D lLinear =
+          AL::Math::crossProduct(lAxis, lEnd - lOrigin);
+      pColumns[i] = AL::Math::Velocity6D(lLinear.x, lLinear.y, lLinear.z,
+                                         lAxis.x, lAxis.y, lAxis.z);
+      lSum += pColumns[i].norm();
+      lSum += lOrigin.distance(lEnd) * lAxis.dotProduct(lLinear);
+    }
+    return lSum + AL::Math::norm(lEnd);
+  }
+
+  void kinematicLoopBench(benchmark::State& state)
+  {
+    const std::size_t lSize = static_cast<std::size_t>(state.range(0));
+    const std::vector<AL::Math::Transform> lChain = makeChain(lSize);
+    std::vector<AL::Math::Velocity6D> lColumns(lSize);
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(kinematicLoop(lChain, lColumns));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+#endif  // _LIBALMATH_BENCH_TYPES_KINEMATICLOOP_H_
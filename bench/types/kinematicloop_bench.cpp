@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// The operators are called through the library, unless almath is configured
+// with ALMATH_INLINE_OPERATORS: compare with almath_inline_bench.
+#include "kinematicloop.h"
+
+namespace
+{
+  void BM_KinematicLoop_OutOfLine(benchmark::State& state)
+  {
+    kinematicLoopBench(state);
+  }
+  BENCHMARK(BM_KinematicLoop_OutOfLine)->Arg(6)->Arg(25)->Arg(1000);
+}
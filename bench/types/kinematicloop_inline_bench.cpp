@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// The operators are inlined from almath/inline: the almath_inline_bench
+// target defines ALMATH_INLINE_OPERATORS for all its translation units.
+#include "kinematicloop.h"
+
+#ifndef ALMATH_INLINE_HEADERS
+# error "almath_inline_bench must be built with ALMATH_INLINE_OPERATORS"
+#endif
+
+namespace
+{
+  void BM_KinematicLoop_Inline(benchmark::State& state)
+  {
+    kinematicLoopBench(state);
+  }
+  BENCHMARK(BM_KinematicLoop_Inline)->Arg(6)->Arg(25)->Arg(1000);
+}
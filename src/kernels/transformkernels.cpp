@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include "transformkernels.h"
+#include <almath/tools/alfastmath.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      namespace {
+        void xTransformMultiply(const float* pT1, const float* pT2,
+                                float* pOut)
+        {
+          float t[12];
+          for (int r = 0; r < 12; r += 4)
+          {
+            t[r] = (pT1[r] * pT2[0]) + (pT1[r+1] * pT2[4]) +
+                (pT1[r+2] * pT2[8]);
+            t[r+1] = (pT1[r] * pT2[1]) + (pT1[r+1] * pT2[5]) +
+                (pT1[r+2] * pT2[9]);
+            t[r+2] = (pT1[r] * pT2[2]) + (pT1[r+1] * pT2[6]) +
+                (pT1[r+2] * pT2[10]);
+            t[r+3] = (pT1[r] * pT2[3]) + (pT1[r+1] * pT2[7]) +
+                (pT1[r+2] * pT2[11]) + pT1[r+3];
+          }
+          std::memcpy(pOut, t, sizeof(t));
+        }
+
+        void xTransformInverse(const float* pT, float* pOut)
+        {
+          float t[12];
+          // rotation Ri = R'
+          t[0] = pT[0];
+          t[1] = pT[4];
+          t[2] = pT[8];
+          t[4] = pT[1];
+          t[5] = pT[5];
+          t[6] = pT[9];
+          t[8] = pT[2];
+          t[9] = pT[6];
+          t[10] = pT[10];
+
+          // translation ri = -R'*r
+          t[3] = -(pT[0]*pT[3] + pT[4]*pT[7] + pT[8]*pT[11]);
+          t[7] = -(pT[1]*pT[3] + pT[5]*pT[7] + pT[9]*pT[11]);
+          t[11] = -(pT[2]*pT[3] + pT[6]*pT[7] + pT[10]*pT[11]);
+          std::memcpy(pOut, t, sizeof(t));
+        }
+
+        void xRotationMultiply(const float* pR1, const float* pR2,
+                               float* pOut)
+        {
+          float r[9];
+          for (int i = 0; i < 9; i += 3)
+          {
+            r[i] = (pR1[i] * pR2[0]) + (pR1[i+1] * pR2[3]) +
+                (pR1[i+2] * pR2[6]);
+            r[i+1] = (pR1[i] * pR2[1]) + (pR1[i+1] * pR2[4]) +
+                (pR1[i+2] * pR2[7]);
+            r[i+2] = (pR1[i] * pR2[2]) + (pR1[i+1] * pR2[5]) +
+                (pR1[i+2] * pR2[8]);
+          }
+          std::memcpy(pOut, r, sizeof(r));
+        }
+
+        void xRotationApply(const float* pR, const float* pP, float* pOut)
+        {
+          const float x = pR[0]*pP[0] + pR[1]*pP[1] + pR[2]*pP[2];
+          const float y = pR[3]*pP[0] + pR[4]*pP[1] + pR[5]*pP[2];
+          const float z = pR[6]*pP[0] + pR[7]*pP[1] + pR[8]*pP[2];
+          pOut[0] = x;
+          pOut[1] = y;
+          pOut[2] = z;
+        }
+
+        void xRotatePositions(const float* pR, const float* pIn,
+                              float* pOut, std::size_t pSize)
+        {
+          for (std::size_t i = 0u; i < 3u*pSize; i += 3u)
+          {
+            xRotationApply(pR, pIn + i, pOut + i);
+          }
+        }
+
+        void xSinCos(const float* pAngles, float* pSin, float* pCos,
+                     std::size_t pSize)
+        {
+          for (std::size_t i = 0u; i < pSize; ++i)
+          {
+            fastSinCos(pAngles[i], pSin[i], pCos[i]);
+          }
+        }
+
+        void xAtan2(const float* pY, const float* pX, float* pOut,
+                    std::size_t pSize)
+        {
+          for (std::size_t i = 0u; i < pSize; ++i)
+          {
+            pOut[i] = fastAtan2(pY[i], pX[i]);
+          }
+        }
+
+        std::size_t xClip(const float* pMin, const float* pMax,
+                          float* pData, std::size_t pSize)
+        {
+          std::size_t lCount = 0u;
+          for (std::size_t i = 0u; i < pSize; ++i)
+          {
+            lCount += clipValue(pMin[i], pMax[i], pData[i]);
+          }
+          return lCount;
+        }
+
+        std::size_t xClipUniform(float pMin, float pMax, float* pData,
+                                 std::size_t pSize)
+        {
+          std::size_t lCount = 0u;
+          for (std::size_t i = 0u; i < pSize; ++i)
+          {
+            lCount += clipValue(pMin, pMax, pData[i]);
+          }
+          return lCount;
+        }
+
+        SimdLevel xSupportedLevel()
+        {
+#ifdef ALMATH_KERNELS_X86
+          __builtin_cpu_init();
+          if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+          {
+            return SIMD_AVX2;
+          }
+          if (__builtin_cpu_supports("sse2"))
+          {
+            return SIMD_SSE2;
+          }
+#endif
+          return SIMD_GENERIC;
+        }
+
+        const TransformKernels* xKernels(SimdLevel pLevel)
+        {
+#ifdef ALMATH_KERNELS_X86
+          if (pLevel == SIMD_AVX2)
+          {
+            return &kAvx2TransformKernels;
+          }
+          if (pLevel == SIMD_SSE2)
+          {
+            return &kSse2TransformKernels;
+          }
+#endif
+          return &kGenericTransformKernels;
+        }
+
+        // the level requested by the ALMATH_SIMD environment variable,
+        // SIMD_AVX2 (that is no restriction) if it is not set or unknown.
+        SimdLevel xRequestedLevel()
+        {
+          const char* lEnv = std::getenv("ALMATH_SIMD");
+          if (lEnv == 0)
+          {
+            return SIMD_AVX2;
+          }
+          if (std::strcmp(lEnv, "generic") == 0)
+          {
+            return SIMD_GENERIC;
+          }
+          if (std::strcmp(lEnv, "sse2") == 0)
+          {
+            return SIMD_SSE2;
+          }
+          return SIMD_AVX2;
+        }
+
+        SimdLevel gLevel = SIMD_GENERIC;
+
+        // select the kernels when the library is loaded. Until then, the
+        // statically initialized generic kernels are used.
+        struct Init
+        {
+          Init()
+          {
+            setSimdLevel(xRequestedLevel());
+          }
+        } gInit;
+      } // anonymous namespace
+
+      const TransformKernels kGenericTransformKernels = {
+        &xTransformMultiply,
+        &xTransformInverse,
+        &xRotationMultiply,
+        &xRotationApply,
+        &xRotatePositions,
+        &xSinCos,
+        &xAtan2,
+        &xClip,
+        &xClipUniform
+      };
+
+      const TransformKernels* gTransformKernels = &kGenericTransformKernels;
+
+    } // end namespace detail
+
+    SimdLevel simdLevel()
+    {
+      return detail::gLevel;
+    }
+
+    SimdLevel simdLevelSupported()
+    {
+      static const SimdLevel lLevel = detail::xSupportedLevel();
+      return lLevel;
+    }
+
+    SimdLevel setSimdLevel(SimdLevel pLevel)
+    {
+      const SimdLevel lSupported = simdLevelSupported();
+      detail::gLevel = pLevel < lSupported ? pLevel : lSupported;
+      detail::gTransformKernels = detail::xKernels(detail::gLevel);
+      return detail::gLevel;
+    }
+
+  } // end namespace Math
+} // end namespace AL
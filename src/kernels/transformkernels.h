@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Private header: the kernels behind the Transform and Rotation operators,
+// the array versions of fastSinCos and fastAtan2, and the array clipData.
+//
+// The kernels work on the raw row major coefficients of the types:
+//  - a Transform is 12 floats r1_c1 ... r3_c4,
+//  - a Rotation is 9 floats r1_c1 ... r3_c3,
+//  - a Position3D is 3 floats x, y, z.
+// Outputs may alias inputs: each kernel reads all its inputs before
+// writing. Arrays may be the same but must not partially overlap.
+
+#pragma once
+#ifndef _LIBALMATH_SRC_KERNELS_TRANSFORMKERNELS_H_
+#define _LIBALMATH_SRC_KERNELS_TRANSFORMKERNELS_H_
+
+#include <almath/tools/alsimd.h>
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// the x86 kernels are compiled with function target attributes, so that
+// the library does not require the instruction sets it may use.
+# define ALMATH_KERNELS_X86 1
+#endif
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      struct TransformKernels
+      {
+        // pOut = pT1 * pT2, all Transform
+        void (*transformMultiply)(const float* pT1, const float* pT2,
+                                  float* pOut);
+        // pOut = pT^-1, assuming the rotation part is orthonormal
+        void (*transformInverse)(const float* pT, float* pOut);
+        // pOut = pR1 * pR2, all Rotation
+        void (*rotationMultiply)(const float* pR1, const float* pR2,
+                                 float* pOut);
+        // pOut = pR * pP, pR a Rotation, pP and pOut Position3D
+        void (*rotationApply)(const float* pR, const float* pP,
+                              float* pOut);
+        // pOut[i] = pR * pIn[i], pR a Rotation, pIn and pOut arrays of
+        // pSize Position3D
+        void (*rotatePositions)(const float* pR, const float* pIn,
+                                float* pOut, std::size_t pSize);
+        // fastSinCos(pAngles[i], pSin[i], pCos[i]), see alfastmath.h.
+        // pSin and pCos must not overlap pAngles.
+        void (*sinCos)(const float* pAngles, float* pSin, float* pCos,
+                       std::size_t pSize);
+        // pOut[i] = fastAtan2(pY[i], pX[i]), see alfastmath.h
+        void (*atan2)(const float* pY, const float* pX, float* pOut,
+                      std::size_t pSize);
+        // clamp pData[i] into [pMin[i], pMax[i]] as boost::algorithm::clamp
+        // does, return the number of clamped values (NaN are not clamped)
+        std::size_t (*clip)(const float* pMin, const float* pMax,
+                            float* pData, std::size_t pSize);
+        // the same with the bounds pMin and pMax for all the values
+        std::size_t (*clipUniform)(float pMin, float pMax, float* pData,
+                                   std::size_t pSize);
+      };
+
+      // one value of the clip kernels: clamp pData, return 1 if clamped
+      inline std::size_t clipValue(float pMin, float pMax, float& pData)
+      {
+        if (pData < pMin)
+        {
+          pData = pMin;
+          return 1u;
+        }
+        if (pMax < pData)
+        {
+          pData = pMax;
+          return 1u;
+        }
+        return 0u;
+      }
+
+      // the kernels in use, see setSimdLevel.
+      extern const TransformKernels* gTransformKernels;
+
+      inline const TransformKernels& transformKernels()
+      {
+        return *gTransformKernels;
+      }
+
+      extern const TransformKernels kGenericTransformKernels;
+#ifdef ALMATH_KERNELS_X86
+      extern const TransformKernels kSse2TransformKernels;
+      extern const TransformKernels kAvx2TransformKernels;
+#endif
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_SRC_KERNELS_TRANSFORMKERNELS_H_
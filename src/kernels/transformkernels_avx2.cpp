@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include "x86helpers.h"
+#include <almath/tools/alfastmath.h>
+
+#ifdef ALMATH_KERNELS_X86
+#include <immintrin.h>
+
+// The AVX2 kernels process two rows of a Transform in each 256 bits
+// register and accumulate the products with fused multiply-add. They are
+// only selected when the host supports both AVX2 and FMA.
+// FMA rounds a*b+c once instead of twice: see SimdLevel for the resulting
+// tolerance with respect to the generic kernels.
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      namespace {
+#define ALMATH_AVX2 ALMATH_TARGET_AVX2
+        using namespace x86;
+
+        // ((a1*B1 + a2*B2) + a3*B3) with two fma, for 4 floats rows
+        ALMATH_AVX2 inline __m128 xRow(__m128 pA, __m128 pB1, __m128 pB2,
+                                       __m128 pB3)
+        {
+          __m128 lR = _mm_mul_ps(_mm_permute_ps(pA, 0x00), pB1);
+          lR = _mm_fmadd_ps(_mm_permute_ps(pA, 0x55), pB2, lR);
+          return _mm_fmadd_ps(_mm_permute_ps(pA, 0xAA), pB3, lR);
+        }
+
+        ALMATH_AVX2 void xTransformMultiply(const float* pT1,
+                                            const float* pT2,
+                                            float* pOut)
+        {
+          const __m256 lB1 = _mm256_broadcast_ps(
+                reinterpret_cast<const __m128*>(pT2));
+          const __m256 lB2 = _mm256_broadcast_ps(
+                reinterpret_cast<const __m128*>(pT2 + 4));
+          const __m256 lB3 = _mm256_broadcast_ps(
+                reinterpret_cast<const __m128*>(pT2 + 8));
+          // rows 1 and 2 of pT1 in the low and high lanes
+          const __m256 lA12 = _mm256_loadu_ps(pT1);
+          const __m128 lA3 = _mm_loadu_ps(pT1 + 8);
+          const __m256 lMask4 = _mm256_castsi256_ps(
+                _mm256_set_epi32(-1, 0, 0, 0, -1, 0, 0, 0));
+
+          __m256 lR12 = _mm256_mul_ps(_mm256_permute_ps(lA12, 0x00), lB1);
+          lR12 = _mm256_fmadd_ps(_mm256_permute_ps(lA12, 0x55), lB2, lR12);
+          lR12 = _mm256_fmadd_ps(_mm256_permute_ps(lA12, 0xAA), lB3, lR12);
+          lR12 = _mm256_add_ps(lR12, _mm256_and_ps(lA12, lMask4));
+
+          __m128 lR3 = xRow(lA3, _mm256_castps256_ps128(lB1),
+                            _mm256_castps256_ps128(lB2),
+                            _mm256_castps256_ps128(lB3));
+          lR3 = _mm_add_ps(lR3, _mm_and_ps(lA3,
+                                           _mm256_castps256_ps128(lMask4)));
+          _mm256_storeu_ps(pOut, lR12);
+          _mm_storeu_ps(pOut + 8, lR3);
+        }
+
+        ALMATH_AVX2 void xTransformInverse(const float* pT, float* pOut)
+        {
+          __m128 lA1 = _mm_loadu_ps(pT);
+          __m128 lA2 = _mm_loadu_ps(pT + 4);
+          __m128 lA3 = _mm_loadu_ps(pT + 8);
+          __m128 lDot = _mm_mul_ps(lA1, _mm_permute_ps(lA1, 0xFF));
+          lDot = _mm_fmadd_ps(lA2, _mm_permute_ps(lA2, 0xFF), lDot);
+          lDot = _mm_fmadd_ps(lA3, _mm_permute_ps(lA3, 0xFF), lDot);
+          __m128 lA4 = _mm_xor_ps(lDot, _mm_set1_ps(-0.0f));
+          _MM_TRANSPOSE4_PS(lA1, lA2, lA3, lA4);
+          _mm_storeu_ps(pOut, lA1);
+          _mm_storeu_ps(pOut + 4, lA2);
+          _mm_storeu_ps(pOut + 8, lA3);
+        }
+
+        ALMATH_AVX2 void xRotationMultiply(const float* pR1,
+                                           const float* pR2,
+                                           float* pOut)
+        {
+          const __m128 lB1 = _mm_loadu_ps(pR2);
+          const __m128 lB2 = _mm_loadu_ps(pR2 + 3);
+          const __m128 lB3 = load3(pR2 + 6);
+          const __m128 lR1 = xRow(_mm_loadu_ps(pR1), lB1, lB2, lB3);
+          const __m128 lR2 = xRow(_mm_loadu_ps(pR1 + 3), lB1, lB2, lB3);
+          const __m128 lR3 = xRow(load3(pR1 + 6), lB1, lB2, lB3);
+          store3(pOut, lR1);
+          store3(pOut + 3, lR2);
+          store3(pOut + 6, lR3);
+        }
+
+        ALMATH_AVX2 void xRotationApply(const float* pR, const float* pP,
+                                        float* pOut)
+        {
+          __m128 lC1 = _mm_loadu_ps(pR);
+          __m128 lC2 = _mm_loadu_ps(pR + 3);
+          __m128 lC3 = load3(pR + 6);
+          __m128 lC4 = _mm_setzero_ps();
+          _MM_TRANSPOSE4_PS(lC1, lC2, lC3, lC4);
+          const __m128 lP = load3(pP);
+          __m128 lR = _mm_mul_ps(lC1, _mm_permute_ps(lP, 0x00));
+          lR = _mm_fmadd_ps(lC2, _mm_permute_ps(lP, 0x55), lR);
+          lR = _mm_fmadd_ps(lC3, _mm_permute_ps(lP, 0xAA), lR);
+          store3(pOut, lR);
+        }
+
+        // ((r1*X + r2*Y) + r3*Z) with two fma
+        ALMATH_AVX2 inline __m128 xDot(__m128 pR, __m128 pX, __m128 pY,
+                                       __m128 pZ)
+        {
+          __m128 lOut = _mm_mul_ps(_mm_permute_ps(pR, 0x00), pX);
+          lOut = _mm_fmadd_ps(_mm_permute_ps(pR, 0x55), pY, lOut);
+          return _mm_fmadd_ps(_mm_permute_ps(pR, 0xAA), pZ, lOut);
+        }
+
+        ALMATH_AVX2 void xRotatePositions(const float* pR, const float* pIn,
+                                          float* pOut, std::size_t pSize)
+        {
+          const __m128 lR1 = _mm_loadu_ps(pR);
+          const __m128 lR2 = _mm_loadu_ps(pR + 3);
+          const __m128 lR3 = load3(pR + 6);
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            __m128 lX, lY, lZ;
+            loadXYZ4(pIn + 3u*i, lX, lY, lZ);
+            storeXYZ4(pOut + 3u*i, xDot(lR1, lX, lY, lZ),
+                      xDot(lR2, lX, lY, lZ), xDot(lR3, lX, lY, lZ));
+          }
+          for (; i < pSize; ++i)
+          {
+            xRotationApply(pR, pIn + 3u*i, pOut + 3u*i);
+          }
+        }
+
+        // the operations of fastSinCos for 8 angles, with fma
+        ALMATH_AVX2 void xSinCos(const float* pAngles, float* pSin,
+                                 float* pCos, std::size_t pSize)
+        {
+          const __m256 lAbsMask = _mm256_castsi256_ps(
+                _mm256_set1_epi32(0x7fffffff));
+          const __m256 lRound = _mm256_set1_ps(FASTMATH_ROUND);
+          const __m256 lZ5 = _mm256_set1_ps(-0.5f);
+          const __m256 lOne = _mm256_set1_ps(1.0f);
+          const __m256i lOneI = _mm256_set1_epi32(1);
+          const __m256i lTwoI = _mm256_set1_epi32(2);
+          std::size_t i = 0u;
+          for (; i + 8u <= pSize; i += 8u)
+          {
+            const __m256 lX = _mm256_loadu_ps(pAngles + i);
+            const __m256 q = _mm256_sub_ps(
+                  _mm256_fmadd_ps(lX, _mm256_set1_ps(FASTMATH_TWO_OVER_PI),
+                                  lRound), lRound);
+            const __m256i lQuadrant = _mm256_cvttps_epi32(q);
+            __m256 r = _mm256_fnmadd_ps(q, _mm256_set1_ps(FASTMATH_PIO2_1), lX);
+            r = _mm256_fnmadd_ps(q, _mm256_set1_ps(FASTMATH_PIO2_2), r);
+            r = _mm256_fnmadd_ps(q, _mm256_set1_ps(FASTMATH_PIO2_3), r);
+            const __m256 z = _mm256_mul_ps(r, r);
+
+            __m256 lSin = _mm256_fmadd_ps(_mm256_set1_ps(FASTMATH_S3), z,
+                                          _mm256_set1_ps(FASTMATH_S2));
+            lSin = _mm256_fmadd_ps(lSin, z, _mm256_set1_ps(FASTMATH_S1));
+            lSin = _mm256_fmadd_ps(_mm256_mul_ps(lSin, z), r, r);
+            __m256 lCos = _mm256_fmadd_ps(_mm256_set1_ps(FASTMATH_C3), z,
+                                          _mm256_set1_ps(FASTMATH_C2));
+            lCos = _mm256_fmadd_ps(lCos, z, _mm256_set1_ps(FASTMATH_C1));
+            lCos = _mm256_add_ps(
+                  _mm256_fmadd_ps(_mm256_mul_ps(lCos, z), z,
+                                  _mm256_mul_ps(lZ5, z)), lOne);
+
+            const __m256 lSwap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                  _mm256_and_si256(lQuadrant, lOneI), lOneI));
+            const __m256 lSinSign = _mm256_castsi256_ps(_mm256_slli_epi32(
+                  _mm256_and_si256(lQuadrant, lTwoI), 30));
+            const __m256 lCosSign = _mm256_castsi256_ps(_mm256_slli_epi32(
+                  _mm256_and_si256(_mm256_add_epi32(lQuadrant, lOneI), lTwoI),
+                  30));
+            _mm256_storeu_ps(pSin + i, _mm256_xor_ps(
+                               _mm256_blendv_ps(lSin, lCos, lSwap), lSinSign));
+            _mm256_storeu_ps(pCos + i, _mm256_xor_ps(
+                               _mm256_blendv_ps(lCos, lSin, lSwap), lCosSign));
+
+            // large angles, infinities and NaN
+            if (_mm256_movemask_ps(_mm256_cmp_ps(
+                                     _mm256_and_ps(lX, lAbsMask),
+                                     _mm256_set1_ps(FASTMATH_MAX_ANGLE),
+                                     _CMP_LE_OQ)) != 0xFF)
+            {
+              for (std::size_t j = i; j < i + 8u; ++j)
+              {
+                fastSinCos(pAngles[j], pSin[j], pCos[j]);
+              }
+            }
+          }
+          for (; i < pSize; ++i)
+          {
+            fastSinCos(pAngles[i], pSin[i], pCos[i]);
+          }
+        }
+
+        // the operations of fastAtan2 for 8 angles, with fma
+        ALMATH_AVX2 void xAtan2(const float* pY, const float* pX,
+                                float* pOut, std::size_t pSize)
+        {
+          const __m256 lAbsMask = _mm256_castsi256_ps(
+                _mm256_set1_epi32(0x7fffffff));
+          const __m256 lSignMask = _mm256_castsi256_ps(
+                _mm256_set1_epi32(static_cast<int>(0x80000000u)));
+          const __m256 lMax = _mm256_set1_ps(FLT_MAX);
+          std::size_t i = 0u;
+          for (; i + 8u <= pSize; i += 8u)
+          {
+            const __m256 lY = _mm256_loadu_ps(pY + i);
+            const __m256 lX = _mm256_loadu_ps(pX + i);
+            const __m256 lAbsY = _mm256_and_ps(lY, lAbsMask);
+            const __m256 lAbsX = _mm256_and_ps(lX, lAbsMask);
+            const __m256 lSwap = _mm256_cmp_ps(lAbsY, lAbsX, _CMP_GT_OQ);
+            const __m256 lNum = _mm256_min_ps(lAbsX, lAbsY);
+            const __m256 lDen = _mm256_max_ps(lAbsX, lAbsY);
+            const __m256 lShift = _mm256_cmp_ps(
+                  lNum, _mm256_mul_ps(_mm256_set1_ps(FASTMATH_TAN_PI_8), lDen),
+                  _CMP_GT_OQ);
+            // (num - den)/(num + den) or num/den, 0 if den is 0
+            const __m256 lShiftedNum = _mm256_sub_ps(
+                  lNum, _mm256_and_ps(lShift, lDen));
+            const __m256 lShiftedDen = _mm256_add_ps(
+                  lDen, _mm256_and_ps(lShift, lNum));
+            const __m256 t = _mm256_and_ps(
+                  _mm256_div_ps(lShiftedNum, lShiftedDen),
+                  _mm256_cmp_ps(lDen, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+            const __m256 z = _mm256_mul_ps(t, t);
+            __m256 lAngle = _mm256_fmadd_ps(_mm256_set1_ps(FASTMATH_A4), z,
+                                            _mm256_set1_ps(FASTMATH_A3));
+            lAngle = _mm256_fmadd_ps(lAngle, z, _mm256_set1_ps(FASTMATH_A2));
+            lAngle = _mm256_fmadd_ps(lAngle, z, _mm256_set1_ps(FASTMATH_A1));
+            lAngle = _mm256_fmadd_ps(_mm256_mul_ps(lAngle, z), t, t);
+            lAngle = _mm256_add_ps(lAngle, _mm256_and_ps(
+                                     lShift, _mm256_set1_ps(FASTMATH_PI_4)));
+
+            // unfold the octant
+            lAngle = _mm256_blendv_ps(
+                  lAngle, _mm256_sub_ps(_mm256_set1_ps(FASTMATH_PI_2), lAngle),
+                  lSwap);
+            lAngle = _mm256_blendv_ps(
+                  lAngle, _mm256_sub_ps(_mm256_set1_ps(FASTMATH_PI), lAngle),
+                  lX);
+            lAngle = _mm256_xor_ps(lAngle, _mm256_and_ps(lY, lSignMask));
+
+            // infinities and NaN
+            if (_mm256_movemask_ps(_mm256_and_ps(
+                                     _mm256_cmp_ps(lAbsX, lMax, _CMP_LE_OQ),
+                                     _mm256_cmp_ps(lAbsY, lMax, _CMP_LE_OQ)))
+                != 0xFF)
+            {
+              float lYs[8];
+              float lXs[8];
+              _mm256_storeu_ps(lYs, lY);
+              _mm256_storeu_ps(lXs, lX);
+              for (std::size_t j = 0u; j < 8u; ++j)
+              {
+                pOut[i + j] = fastAtan2(lYs[j], lXs[j]);
+              }
+            }
+            else
+            {
+              _mm256_storeu_ps(pOut + i, lAngle);
+            }
+          }
+          for (; i < pSize; ++i)
+          {
+            pOut[i] = fastAtan2(pY[i], pX[i]);
+          }
+        }
+
+        // clamp 8 values as clipValue does, count the clamped ones in
+        // pCount (a mask of all ones is -1)
+        ALMATH_AVX2 inline void xClip8(__m256 pMin, __m256 pMax, float* pData,
+                                       __m256i& pCount)
+        {
+          const __m256 lData = _mm256_loadu_ps(pData);
+          const __m256 lBelow = _mm256_cmp_ps(lData, pMin, _CMP_LT_OQ);
+          const __m256 lAbove = _mm256_andnot_ps(
+                lBelow, _mm256_cmp_ps(pMax, lData, _CMP_LT_OQ));
+          __m256 lClipped = _mm256_blendv_ps(lData, pMin, lBelow);
+          lClipped = _mm256_blendv_ps(lClipped, pMax, lAbove);
+          _mm256_storeu_ps(pData, lClipped);
+          pCount = _mm256_sub_epi32(pCount, _mm256_castps_si256(
+                                      _mm256_or_ps(lBelow, lAbove)));
+        }
+
+        ALMATH_AVX2 inline std::size_t xCount(__m256i pCount)
+        {
+          uint32_t lCounts[8];
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(lCounts), pCount);
+          std::size_t lCount = 0u;
+          for (int j = 0; j < 8; ++j)
+          {
+            lCount += lCounts[j];
+          }
+          return lCount;
+        }
+
+        ALMATH_AVX2 std::size_t xClip(const float* pMin, const float* pMax,
+                                      float* pData, std::size_t pSize)
+        {
+          __m256i lCount = _mm256_setzero_si256();
+          std::size_t i = 0u;
+          for (; i + 8u <= pSize; i += 8u)
+          {
+            xClip8(_mm256_loadu_ps(pMin + i), _mm256_loadu_ps(pMax + i),
+                   pData + i, lCount);
+          }
+          std::size_t lTail = 0u;
+          for (; i < pSize; ++i)
+          {
+            lTail += clipValue(pMin[i], pMax[i], pData[i]);
+          }
+          return xCount(lCount) + lTail;
+        }
+
+        ALMATH_AVX2 std::size_t xClipUniform(float pMin, float pMax,
+                                             float* pData, std::size_t pSize)
+        {
+          const __m256 lMin = _mm256_set1_ps(pMin);
+          const __m256 lMax = _mm256_set1_ps(pMax);
+          __m256i lCount = _mm256_setzero_si256();
+          std::size_t i = 0u;
+          for (; i + 8u <= pSize; i += 8u)
+          {
+            xClip8(lMin, lMax, pData + i, lCount);
+          }
+          std::size_t lTail = 0u;
+          for (; i < pSize; ++i)
+          {
+            lTail += clipValue(pMin, pMax, pData[i]);
+          }
+          return xCount(lCount) + lTail;
+        }
+
+#undef ALMATH_AVX2
+      } // anonymous namespace
+
+      const TransformKernels kAvx2TransformKernels = {
+        &xTransformMultiply,
+        &xTransformInverse,
+        &xRotationMultiply,
+        &xRotationApply,
+        &xRotatePositions,
+        &xSinCos,
+        &xAtan2,
+        &xClip,
+        &xClipUniform
+      };
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+#endif // ALMATH_KERNELS_X86
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include "x86helpers.h"
+#include <almath/tools/alfastmath.h>
+
+#ifdef ALMATH_KERNELS_X86
+
+// The SSE2 kernels keep the float operations of the generic kernels, in
+// the same order: a row of the result is computed as
+// ((a1*B1 + a2*B2) + a3*B3) + (0, 0, 0, a4), where Bi are the rows of the
+// right hand side matrix.
+// Lanes which do not hold a coefficient only get "+ 0.0f", which changes
+// -0.0f into 0.0f and nothing else.
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      namespace {
+#define ALMATH_SSE2 ALMATH_TARGET_SSE2
+        using namespace x86;
+
+        ALMATH_SSE2 inline __m128 xSplat(__m128 p, int pLane)
+        {
+          switch (pLane)
+          {
+          case 0: return _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0));
+          case 1: return _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1));
+          case 2: return _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2));
+          default: return _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3));
+          }
+        }
+
+        // keep lane 3 only
+        ALMATH_SSE2 inline __m128 xLane3(__m128 p)
+        {
+          const __m128 lMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+          return _mm_and_ps(p, lMask);
+        }
+
+        ALMATH_SSE2 inline __m128 xRow(__m128 pA, __m128 pB1, __m128 pB2,
+                                       __m128 pB3)
+        {
+          return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(xSplat(pA, 0), pB1),
+                           _mm_mul_ps(xSplat(pA, 1), pB2)),
+                _mm_mul_ps(xSplat(pA, 2), pB3));
+        }
+
+        ALMATH_SSE2 void xTransformMultiply(const float* pT1,
+                                            const float* pT2,
+                                            float* pOut)
+        {
+          const __m128 lB1 = _mm_loadu_ps(pT2);
+          const __m128 lB2 = _mm_loadu_ps(pT2 + 4);
+          const __m128 lB3 = _mm_loadu_ps(pT2 + 8);
+          const __m128 lA1 = _mm_loadu_ps(pT1);
+          const __m128 lA2 = _mm_loadu_ps(pT1 + 4);
+          const __m128 lA3 = _mm_loadu_ps(pT1 + 8);
+          const __m128 lR1 = _mm_add_ps(xRow(lA1, lB1, lB2, lB3), xLane3(lA1));
+          const __m128 lR2 = _mm_add_ps(xRow(lA2, lB1, lB2, lB3), xLane3(lA2));
+          const __m128 lR3 = _mm_add_ps(xRow(lA3, lB1, lB2, lB3), xLane3(lA3));
+          _mm_storeu_ps(pOut, lR1);
+          _mm_storeu_ps(pOut + 4, lR2);
+          _mm_storeu_ps(pOut + 8, lR3);
+        }
+
+        ALMATH_SSE2 void xTransformInverse(const float* pT, float* pOut)
+        {
+          __m128 lA1 = _mm_loadu_ps(pT);
+          __m128 lA2 = _mm_loadu_ps(pT + 4);
+          __m128 lA3 = _mm_loadu_ps(pT + 8);
+          // lane i: r1_ci*r1_c4 + r2_ci*r2_c4 + r3_ci*r3_c4
+          const __m128 lDot = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(lA1, xSplat(lA1, 3)),
+                           _mm_mul_ps(lA2, xSplat(lA2, 3))),
+                _mm_mul_ps(lA3, xSplat(lA3, 3)));
+          __m128 lA4 = _mm_xor_ps(lDot, _mm_set1_ps(-0.0f));
+          // the transpose of the rows (A1, A2, A3, -R'*r) are the rows
+          // (Ri(1), -ri(1)), (Ri(2), -ri(2)), (Ri(3), -ri(3)), (r, *).
+          _MM_TRANSPOSE4_PS(lA1, lA2, lA3, lA4);
+          _mm_storeu_ps(pOut, lA1);
+          _mm_storeu_ps(pOut + 4, lA2);
+          _mm_storeu_ps(pOut + 8, lA3);
+        }
+
+        ALMATH_SSE2 void xRotationMultiply(const float* pR1,
+                                           const float* pR2,
+                                           float* pOut)
+        {
+          // the 4th lanes of the full loads overlap the next row: they are
+          // computed but not stored.
+          const __m128 lB1 = _mm_loadu_ps(pR2);
+          const __m128 lB2 = _mm_loadu_ps(pR2 + 3);
+          const __m128 lB3 = load3(pR2 + 6);
+          const __m128 lR1 = xRow(_mm_loadu_ps(pR1), lB1, lB2, lB3);
+          const __m128 lR2 = xRow(_mm_loadu_ps(pR1 + 3), lB1, lB2, lB3);
+          const __m128 lR3 = xRow(load3(pR1 + 6), lB1, lB2, lB3);
+          store3(pOut, lR1);
+          store3(pOut + 3, lR2);
+          store3(pOut + 6, lR3);
+        }
+
+        ALMATH_SSE2 void xRotationApply(const float* pR, const float* pP,
+                                        float* pOut)
+        {
+          // result = (x*C1 + y*C2) + z*C3, where Ci are the columns of pR.
+          __m128 lC1 = _mm_loadu_ps(pR);
+          __m128 lC2 = _mm_loadu_ps(pR + 3);
+          __m128 lC3 = load3(pR + 6);
+          __m128 lC4 = _mm_setzero_ps();
+          _MM_TRANSPOSE4_PS(lC1, lC2, lC3, lC4);
+          const __m128 lP = load3(pP);
+          const __m128 lR = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(lC1, xSplat(lP, 0)),
+                           _mm_mul_ps(lC2, xSplat(lP, 1))),
+                _mm_mul_ps(lC3, xSplat(lP, 2)));
+          store3(pOut, lR);
+        }
+
+        ALMATH_SSE2 void xRotatePositions(const float* pR, const float* pIn,
+                                          float* pOut, std::size_t pSize)
+        {
+          const __m128 lR1 = _mm_loadu_ps(pR);
+          const __m128 lR2 = _mm_loadu_ps(pR + 3);
+          const __m128 lR3 = load3(pR + 6);
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            __m128 lX, lY, lZ;
+            loadXYZ4(pIn + 3u*i, lX, lY, lZ);
+            const __m128 lOutX = _mm_add_ps(
+                  _mm_add_ps(_mm_mul_ps(xSplat(lR1, 0), lX),
+                             _mm_mul_ps(xSplat(lR1, 1), lY)),
+                  _mm_mul_ps(xSplat(lR1, 2), lZ));
+            const __m128 lOutY = _mm_add_ps(
+                  _mm_add_ps(_mm_mul_ps(xSplat(lR2, 0), lX),
+                             _mm_mul_ps(xSplat(lR2, 1), lY)),
+                  _mm_mul_ps(xSplat(lR2, 2), lZ));
+            const __m128 lOutZ = _mm_add_ps(
+                  _mm_add_ps(_mm_mul_ps(xSplat(lR3, 0), lX),
+                             _mm_mul_ps(xSplat(lR3, 1), lY)),
+                  _mm_mul_ps(xSplat(lR3, 2), lZ));
+            storeXYZ4(pOut + 3u*i, lOutX, lOutY, lOutZ);
+          }
+          for (; i < pSize; ++i)
+          {
+            xRotationApply(pR, pIn + 3u*i, pOut + 3u*i);
+          }
+        }
+
+        // the operations of fastSinCos, for 4 angles
+        ALMATH_SSE2 void xSinCos(const float* pAngles, float* pSin,
+                                 float* pCos, std::size_t pSize)
+        {
+          const __m128 lAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+          const __m128 lRound = _mm_set1_ps(FASTMATH_ROUND);
+          const __m128 lZ5 = _mm_set1_ps(0.5f);
+          const __m128 lOne = _mm_set1_ps(1.0f);
+          const __m128i lOneI = _mm_set1_epi32(1);
+          const __m128i lTwoI = _mm_set1_epi32(2);
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            const __m128 lX = _mm_loadu_ps(pAngles + i);
+            const __m128 q = _mm_sub_ps(
+                  _mm_add_ps(_mm_mul_ps(lX, _mm_set1_ps(FASTMATH_TWO_OVER_PI)),
+                             lRound), lRound);
+            const __m128i lQuadrant = _mm_cvttps_epi32(q);
+            __m128 r = _mm_sub_ps(lX,
+                                  _mm_mul_ps(q, _mm_set1_ps(FASTMATH_PIO2_1)));
+            r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(FASTMATH_PIO2_2)));
+            r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(FASTMATH_PIO2_3)));
+            const __m128 z = _mm_mul_ps(r, r);
+
+            __m128 lSin = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_S3), z),
+                                     _mm_set1_ps(FASTMATH_S2));
+            lSin = _mm_add_ps(_mm_mul_ps(lSin, z), _mm_set1_ps(FASTMATH_S1));
+            lSin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(lSin, z), r), r);
+            __m128 lCos = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_C3), z),
+                                     _mm_set1_ps(FASTMATH_C2));
+            lCos = _mm_add_ps(_mm_mul_ps(lCos, z), _mm_set1_ps(FASTMATH_C1));
+            lCos = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(lCos, z), z),
+                                         _mm_mul_ps(lZ5, z)), lOne);
+
+            const __m128 lSwap = _mm_castsi128_ps(_mm_cmpeq_epi32(
+                  _mm_and_si128(lQuadrant, lOneI), lOneI));
+            const __m128 lSinSign = _mm_castsi128_ps(_mm_slli_epi32(
+                  _mm_and_si128(lQuadrant, lTwoI), 30));
+            const __m128 lCosSign = _mm_castsi128_ps(_mm_slli_epi32(
+                  _mm_and_si128(_mm_add_epi32(lQuadrant, lOneI), lTwoI), 30));
+            _mm_storeu_ps(pSin + i, _mm_xor_ps(
+                            _mm_or_ps(_mm_and_ps(lSwap, lCos),
+                                      _mm_andnot_ps(lSwap, lSin)), lSinSign));
+            _mm_storeu_ps(pCos + i, _mm_xor_ps(
+                            _mm_or_ps(_mm_and_ps(lSwap, lSin),
+                                      _mm_andnot_ps(lSwap, lCos)), lCosSign));
+
+            // large angles, infinities and NaN
+            if (_mm_movemask_ps(_mm_cmple_ps(
+                                  _mm_and_ps(lX, lAbsMask),
+                                  _mm_set1_ps(FASTMATH_MAX_ANGLE))) != 0xF)
+            {
+              for (std::size_t j = i; j < i + 4u; ++j)
+              {
+                fastSinCos(pAngles[j], pSin[j], pCos[j]);
+              }
+            }
+          }
+          for (; i < pSize; ++i)
+          {
+            fastSinCos(pAngles[i], pSin[i], pCos[i]);
+          }
+        }
+
+        // the operations of fastAtan2, for 4 angles
+        ALMATH_SSE2 void xAtan2(const float* pY, const float* pX,
+                                float* pOut, std::size_t pSize)
+        {
+          const __m128 lAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+          const __m128 lSignMask = _mm_castsi128_ps(
+                _mm_set1_epi32(static_cast<int>(0x80000000u)));
+          const __m128 lMax = _mm_set1_ps(FLT_MAX);
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            const __m128 lY = _mm_loadu_ps(pY + i);
+            const __m128 lX = _mm_loadu_ps(pX + i);
+            const __m128 lAbsY = _mm_and_ps(lY, lAbsMask);
+            const __m128 lAbsX = _mm_and_ps(lX, lAbsMask);
+            const __m128 lSwap = _mm_cmpgt_ps(lAbsY, lAbsX);
+            const __m128 lNum = _mm_min_ps(lAbsX, lAbsY);
+            const __m128 lDen = _mm_max_ps(lAbsX, lAbsY);
+            const __m128 lShift = _mm_cmpgt_ps(
+                  lNum, _mm_mul_ps(_mm_set1_ps(FASTMATH_TAN_PI_8), lDen));
+            // (num - den)/(num + den) or num/den, 0 if den is 0
+            const __m128 lShiftedNum = _mm_sub_ps(lNum,
+                                                  _mm_and_ps(lShift, lDen));
+            const __m128 lShiftedDen = _mm_add_ps(lDen,
+                                                  _mm_and_ps(lShift, lNum));
+            const __m128 t = _mm_and_ps(_mm_div_ps(lShiftedNum, lShiftedDen),
+                                        _mm_cmpneq_ps(lDen, _mm_setzero_ps()));
+            const __m128 z = _mm_mul_ps(t, t);
+            __m128 lAngle = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FASTMATH_A4), z),
+                                       _mm_set1_ps(FASTMATH_A3));
+            lAngle = _mm_add_ps(_mm_mul_ps(lAngle, z),
+                                _mm_set1_ps(FASTMATH_A2));
+            lAngle = _mm_add_ps(_mm_mul_ps(lAngle, z),
+                                _mm_set1_ps(FASTMATH_A1));
+            lAngle = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(lAngle, z), t), t);
+            lAngle = _mm_add_ps(lAngle, _mm_and_ps(
+                                  lShift, _mm_set1_ps(FASTMATH_PI_4)));
+
+            // unfold the octant
+            const __m128 lSwapped = _mm_sub_ps(_mm_set1_ps(FASTMATH_PI_2),
+                                               lAngle);
+            lAngle = _mm_or_ps(_mm_and_ps(lSwap, lSwapped),
+                               _mm_andnot_ps(lSwap, lAngle));
+            const __m128 lNegX = _mm_castsi128_ps(
+                  _mm_srai_epi32(_mm_castps_si128(lX), 31));
+            const __m128 lMirrored = _mm_sub_ps(_mm_set1_ps(FASTMATH_PI),
+                                                lAngle);
+            lAngle = _mm_or_ps(_mm_and_ps(lNegX, lMirrored),
+                               _mm_andnot_ps(lNegX, lAngle));
+            lAngle = _mm_xor_ps(lAngle, _mm_and_ps(lY, lSignMask));
+
+            // infinities and NaN
+            if (_mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(lAbsX, lMax),
+                                           _mm_cmple_ps(lAbsY, lMax))) != 0xF)
+            {
+              float lYs[4];
+              float lXs[4];
+              _mm_storeu_ps(lYs, lY);
+              _mm_storeu_ps(lXs, lX);
+              for (std::size_t j = 0u; j < 4u; ++j)
+              {
+                pOut[i + j] = fastAtan2(lYs[j], lXs[j]);
+              }
+            }
+            else
+            {
+              _mm_storeu_ps(pOut + i, lAngle);
+            }
+          }
+          for (; i < pSize; ++i)
+          {
+            pOut[i] = fastAtan2(pY[i], pX[i]);
+          }
+        }
+
+        // clamp 4 values as clipValue does, count the clamped ones in
+        // pCount (a mask of all ones is -1)
+        ALMATH_SSE2 inline void xClip4(__m128 pMin, __m128 pMax, float* pData,
+                                       __m128i& pCount)
+        {
+          const __m128 lData = _mm_loadu_ps(pData);
+          const __m128 lBelow = _mm_cmplt_ps(lData, pMin);
+          const __m128 lAbove = _mm_andnot_ps(lBelow,
+                                              _mm_cmplt_ps(pMax, lData));
+          __m128 lClipped = _mm_or_ps(_mm_and_ps(lBelow, pMin),
+                                      _mm_andnot_ps(lBelow, lData));
+          lClipped = _mm_or_ps(_mm_and_ps(lAbove, pMax),
+                               _mm_andnot_ps(lAbove, lClipped));
+          _mm_storeu_ps(pData, lClipped);
+          pCount = _mm_sub_epi32(pCount, _mm_castps_si128(
+                                   _mm_or_ps(lBelow, lAbove)));
+        }
+
+        ALMATH_SSE2 inline std::size_t xCount(__m128i pCount)
+        {
+          uint32_t lCounts[4];
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(lCounts), pCount);
+          return static_cast<std::size_t>(lCounts[0]) + lCounts[1] +
+              lCounts[2] + lCounts[3];
+        }
+
+        ALMATH_SSE2 std::size_t xClip(const float* pMin, const float* pMax,
+                                      float* pData, std::size_t pSize)
+        {
+          __m128i lCount = _mm_setzero_si128();
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            xClip4(_mm_loadu_ps(pMin + i), _mm_loadu_ps(pMax + i), pData + i,
+                   lCount);
+          }
+          std::size_t lTail = 0u;
+          for (; i < pSize; ++i)
+          {
+            lTail += clipValue(pMin[i], pMax[i], pData[i]);
+          }
+          return xCount(lCount) + lTail;
+        }
+
+        ALMATH_SSE2 std::size_t xClipUniform(float pMin, float pMax,
+                                             float* pData, std::size_t pSize)
+        {
+          const __m128 lMin = _mm_set1_ps(pMin);
+          const __m128 lMax = _mm_set1_ps(pMax);
+          __m128i lCount = _mm_setzero_si128();
+          std::size_t i = 0u;
+          for (; i + 4u <= pSize; i += 4u)
+          {
+            xClip4(lMin, lMax, pData + i, lCount);
+          }
+          std::size_t lTail = 0u;
+          for (; i < pSize; ++i)
+          {
+            lTail += clipValue(pMin, pMax, pData[i]);
+          }
+          return xCount(lCount) + lTail;
+        }
+
+#undef ALMATH_SSE2
+      } // anonymous namespace
+
+      const TransformKernels kSse2TransformKernels = {
+        &xTransformMultiply,
+        &xTransformInverse,
+        &xRotationMultiply,
+        &xRotationApply,
+        &xRotatePositions,
+        &xSinCos,
+        &xAtan2,
+        &xClip,
+        &xClipUniform
+      };
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+#endif // ALMATH_KERNELS_X86
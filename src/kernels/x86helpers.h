@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Private header: SSE2 helpers shared by the x86 kernels.
+// They are compiled for SSE2 and can be inlined in the AVX2 kernels.
+
+#pragma once
+#ifndef _LIBALMATH_SRC_KERNELS_X86HELPERS_H_
+#define _LIBALMATH_SRC_KERNELS_X86HELPERS_H_
+
+#include "transformkernels.h"
+
+#ifdef ALMATH_KERNELS_X86
+#include <emmintrin.h>
+
+#define ALMATH_TARGET_SSE2 __attribute__((target("sse2")))
+#define ALMATH_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+      namespace x86 {
+
+        // load 3 floats, the fourth lane is 0.
+        ALMATH_TARGET_SSE2 inline __m128 load3(const float* p)
+        {
+          const __m128 lXY = _mm_castpd_ps(
+                _mm_load_sd(reinterpret_cast<const double*>(p)));
+          return _mm_movelh_ps(lXY, _mm_load_ss(p + 2));
+        }
+
+        // store the 3 first lanes.
+        ALMATH_TARGET_SSE2 inline void store3(float* p, __m128 pV)
+        {
+          _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(pV));
+          _mm_store_ss(p + 2, _mm_movehl_ps(pV, pV));
+        }
+
+        // shuffle (pA[i], pA[i], pB[j], pB[j]) then (pU[0], pU[2], pV[0], pV[2])
+#define ALMATH_PAIR(pA, pB, i, j) \
+        _mm_shuffle_ps(pA, pB, _MM_SHUFFLE(j, j, i, i))
+#define ALMATH_EVEN(pU, pV) _mm_shuffle_ps(pU, pV, _MM_SHUFFLE(2, 0, 2, 0))
+
+        // load 4 xyz triplets (12 floats) as the x, y and z of 4 points.
+        ALMATH_TARGET_SSE2 inline void loadXYZ4(
+          const float* p, __m128& pX, __m128& pY, __m128& pZ)
+        {
+          const __m128 l0 = _mm_loadu_ps(p);      // x0 y0 z0 x1
+          const __m128 l1 = _mm_loadu_ps(p + 4);  // y1 z1 x2 y2
+          const __m128 l2 = _mm_loadu_ps(p + 8);  // z2 x3 y3 z3
+          pX = ALMATH_EVEN(ALMATH_PAIR(l0, l0, 0, 3), ALMATH_PAIR(l1, l2, 2, 1));
+          pY = ALMATH_EVEN(ALMATH_PAIR(l0, l1, 1, 0), ALMATH_PAIR(l1, l2, 3, 2));
+          pZ = ALMATH_EVEN(ALMATH_PAIR(l0, l1, 2, 1), ALMATH_PAIR(l2, l2, 0, 3));
+        }
+
+        // store the x, y and z of 4 points as 4 xyz triplets.
+        ALMATH_TARGET_SSE2 inline void storeXYZ4(
+          float* p, __m128 pX, __m128 pY, __m128 pZ)
+        {
+          _mm_storeu_ps(p, ALMATH_EVEN(ALMATH_PAIR(pX, pY, 0, 0),
+                                       ALMATH_PAIR(pZ, pX, 0, 1)));
+          _mm_storeu_ps(p + 4, ALMATH_EVEN(ALMATH_PAIR(pY, pZ, 1, 1),
+                                           ALMATH_PAIR(pX, pY, 2, 2)));
+          _mm_storeu_ps(p + 8, ALMATH_EVEN(ALMATH_PAIR(pZ, pX, 2, 3),
+                                           ALMATH_PAIR(pY, pZ, 3, 3)));
+        }
+
+#undef ALMATH_PAIR
+#undef ALMATH_EVEN
+
+      } // end namespace x86
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+
+#endif // ALMATH_KERNELS_X86
+#endif  // _LIBALMATH_SRC_KERNELS_X86HELPERS_H_
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/scenegraph/inversekinematics.h>
+#include <almath/tools/altransformhelpers.h>
+#include "../tools/parallelfor.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace AL {
+namespace Math {
+
+namespace {
+
+// a thread solves at least this number of targets
+const std::size_t kMinGrain = 16u;
+
+// a pivot of the Cholesky decomposition below this fraction of the largest
+// diagonal entry is a direction in which J does not move the link
+const double kPivotEpsilon = 1e-10;
+
+// Solve a * x = b in place of b, for the 6 x 6 symmetric positive
+// semidefinite matrix a, stored row by row, by a Cholesky decomposition in
+// place of a. Only the lower triangle of a is read. Without damping, a is
+// singular when J has fewer than 6 independent rows: the components of x
+// along the null pivots are 0.
+void xCholeskySolve(double *a, double *b) {
+  double largest = 0.0;
+  for (int j = 0; j < 6; ++j) largest = std::max(largest, a[6 * j + j]);
+  const double tolerance = kPivotEpsilon * largest;
+  for (int j = 0; j < 6; ++j) {
+    double d = a[6 * j + j];
+    for (int k = 0; k < j; ++k) d -= a[6 * j + k] * a[6 * j + k];
+    if (d <= tolerance) {
+      for (int i = j; i < 6; ++i) a[6 * i + j] = 0.0;
+      continue;
+    }
+    d = std::sqrt(d);
+    a[6 * j + j] = d;
+    for (int i = j + 1; i < 6; ++i) {
+      double v = a[6 * i + j];
+      for (int k = 0; k < j; ++k) v -= a[6 * i + k] * a[6 * j + k];
+      a[6 * i + j] = v / d;
+    }
+  }
+  for (int i = 0; i < 6; ++i) {
+    for (int k = 0; k < i; ++k) b[i] -= a[6 * i + k] * b[k];
+    b[i] = a[6 * i + i] > 0.0 ? b[i] / a[6 * i + i] : 0.0;
+  }
+  for (int i = 5; i >= 0; --i) {
+    for (int k = i + 1; k < 6; ++k) b[i] -= a[6 * k + i] * b[k];
+    b[i] = a[6 * i + i] > 0.0 ? b[i] / a[6 * i + i] : 0.0;
+  }
+}
+
+void xCheckLink(const KinematicModel &model, std::size_t link) {
+  if (link >= model.linkCount()) {
+    throw std::runtime_error(
+        "ALMath: InverseKinematics::solve called with a wrong link");
+  }
+}
+}
+
+InverseKinematics::Options::Options()
+    : maxIterations(100),
+      tolerance(1e-4f),
+      damping(0.01f),
+      rotationWeight(1.0f),
+      maxStep(0.5f) {}
+
+InverseKinematics::Workspace::Workspace(const KinematicModel &model)
+    : poses(model.linkCount()),
+      jacobian(6u * model.variableCount()),
+      step(model.variableCount()) {
+  path.reserve(model.linkCount());
+}
+
+InverseKinematics::InverseKinematics(const KinematicModel &model,
+                                     const Options &options)
+    : _model(model), _options(options), _workspace(model) {}
+
+InverseKinematics::Result InverseKinematics::solve(const Transform &target,
+                                                   std::size_t link,
+                                                   float *q) {
+  xCheckLink(_model, link);
+  return solveWith(target, link, q, _workspace);
+}
+
+InverseKinematics::Result InverseKinematics::solve(const Transform &target,
+                                                   std::size_t link,
+                                                   std::vector<float> &q) {
+  if (q.size() != _model.variableCount()) {
+    throw std::runtime_error(
+        "ALMath: InverseKinematics::solve called with a wrong number of "
+        "variables");
+  }
+  xCheckLink(_model, link);
+  return solveWith(target, link, q.data(), _workspace);
+}
+
+void InverseKinematics::solve(const Transform *targets, std::size_t count,
+                              std::size_t link, float *q, Result *results,
+                              unsigned int maxThreads) const {
+  xCheckLink(_model, link);
+  const std::size_t variables = _model.variableCount();
+  detail::parallelFor(count, maxThreads, kMinGrain,
+                      [&](std::size_t begin, std::size_t end) {
+    Workspace workspace(_model);
+    for (std::size_t i = begin; i < end; ++i) {
+      results[i] = solveWith(targets[i], link, q + i * variables, workspace);
+    }
+  });
+}
+
+InverseKinematics::Result InverseKinematics::solveWith(
+    const Transform &target, std::size_t link, float *q,
+    Workspace &workspace) const {
+  const std::size_t variables = _model.variableCount();
+  const float weight = _options.rotationWeight;
+  const double damping2 =
+      static_cast<double>(_options.damping) * _options.damping;
+
+  // only the link and its ancestors move it, in increasing order
+  workspace.path.clear();
+  for (std::size_t i = link; i > 0u;
+       i = static_cast<std::size_t>(_model.parent(i))) {
+    workspace.path.push_back(i);
+  }
+  std::reverse(workspace.path.begin(), workspace.path.end());
+
+  Transform *poses = workspace.poses.data();
+  float *jacobian = workspace.jacobian.data();
+  float *step = workspace.step.data();
+  Velocity6D log;
+  for (int iteration = 0;; ++iteration) {
+    for (std::size_t i : workspace.path) {
+      _model.forwardKinematics(q, poses, i, i + 1u);
+    }
+    transformLogarithmInPlace(poses[link].inverseRigid() * target, log);
+    double e[6] = {log.xd, log.yd, log.zd, weight * log.wxd,
+                   weight * log.wyd, weight * log.wzd};
+    const float error = static_cast<float>(
+        std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2] + e[3] * e[3] +
+                  e[4] * e[4] + e[5] * e[5]));
+    if (error <= _options.tolerance) {
+      return Result{true, iteration, error};
+    }
+    if (iteration == _options.maxIterations) {
+      return Result{false, iteration, error};
+    }
+
+    // e = (J J^T + damping^2 I)^-1 e, then step = J^T e
+    _model.jacobian(poses, link, KinematicModel::JACOBIAN_LOCAL, jacobian);
+    double a[36] = {};
+    for (std::size_t v = 0u; v < variables; ++v) {
+      float *column = jacobian + 6u * v;
+      column[3] *= weight;
+      column[4] *= weight;
+      column[5] *= weight;
+      for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) a[6 * i + j] += column[i] * column[j];
+      }
+    }
+    for (int i = 0; i < 6; ++i) a[6 * i + i] += damping2;
+    xCholeskySolve(a, e);
+    float largest = 0.0f;
+    for (std::size_t v = 0u; v < variables; ++v) {
+      const float *column = jacobian + 6u * v;
+      double dq = 0.0;
+      for (int i = 0; i < 6; ++i) dq += column[i] * e[i];
+      step[v] = static_cast<float>(dq);
+      largest = std::max(largest, std::abs(step[v]));
+    }
+    const float scale =
+        largest > _options.maxStep ? _options.maxStep / largest : 1.0f;
+    for (std::size_t v = 0u; v < variables; ++v) {
+      q[v] = std::min(std::max(q[v] + scale * step[v],
+                               _model.variableLower(v)),
+                      _model.variableUpper(v));
+    }
+  }
+}
+}
+}
@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/scenegraph/kinematicmodel.h>
+#include <almath/scenegraph/almatheigen.h>
+#include <almath/scenegraph/urdfeigen.h>
+#include "../kernels/transformkernels.h"
+#include "../tools/parallelfor.h"
+#include "../tools/trigonometry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+namespace AL {
+namespace Math {
+
+namespace {
+
+// collect the joints in the order of the depth first traversal:
+// each joint comes after the joint of its parent link
+class JointCollector : public urdf::RobotTree::JointConstVisitor {
+ public:
+  bool discover(const urdf::ptree &joint) {
+    joints.push_back(&joint);
+    return true;
+  }
+  std::vector<const urdf::ptree *> joints;
+};
+
+// (a, b) = (c * a + s * b, -s * a + c * b): the columns a and b of a
+// matrix right-multiplied by a rotation about its third axis
+inline void xRotateColumns(float &a, float &b, float c, float s) {
+  const float a0 = a;
+  a = c * a0 + s * b;
+  b = c * b - s * a0;
+}
+
+// one row of m * r, on the rotation part of m
+inline void xMultiplyRow(float &c1, float &c2, float &c3, const float *r) {
+  const float a = c1;
+  const float b = c2;
+  const float d = c3;
+  c1 = a * r[0] + b * r[3] + d * r[6];
+  c2 = a * r[1] + b * r[4] + d * r[7];
+  c3 = a * r[2] + b * r[5] + d * r[8];
+}
+
+// m = m * rotation(axis, angle), on the rotation part of m
+void xRotateAboutAxis(Transform &m, const Position3D &axis, float c,
+                      float s) {
+  const float t = 1.0f - c;
+  const float r[9] = {
+      c + t * axis.x * axis.x,
+      t * axis.x * axis.y - s * axis.z,
+      t * axis.x * axis.z + s * axis.y,
+      t * axis.x * axis.y + s * axis.z,
+      c + t * axis.y * axis.y,
+      t * axis.y * axis.z - s * axis.x,
+      t * axis.x * axis.z - s * axis.y,
+      t * axis.y * axis.z + s * axis.x,
+      c + t * axis.z * axis.z};
+  xMultiplyRow(m.r1_c1, m.r1_c2, m.r1_c3, r);
+  xMultiplyRow(m.r2_c1, m.r2_c2, m.r2_c3, r);
+  xMultiplyRow(m.r3_c1, m.r3_c2, m.r3_c3, r);
+}
+
+// m = m * translation(distance * axis)
+inline void xTranslateAlongAxis(Transform &m, const Position3D &axis,
+                                float distance) {
+  const float x = distance * axis.x;
+  const float y = distance * axis.y;
+  const float z = distance * axis.z;
+  m.r1_c4 += m.r1_c1 * x + m.r1_c2 * y + m.r1_c3 * z;
+  m.r2_c4 += m.r2_c1 * x + m.r2_c2 * y + m.r2_c3 * z;
+  m.r3_c4 += m.r3_c1 * x + m.r3_c2 * y + m.r3_c3 * z;
+}
+
+// r = m^T * v, on the rotation part of m
+inline void xRotateInverse(const Transform &m, const float *v, float *r) {
+  r[0] = m.r1_c1 * v[0] + m.r2_c1 * v[1] + m.r3_c1 * v[2];
+  r[1] = m.r1_c2 * v[0] + m.r2_c2 * v[1] + m.r3_c2 * v[2];
+  r[2] = m.r1_c3 * v[0] + m.r2_c3 * v[1] + m.r3_c3 * v[2];
+}
+
+const std::size_t kLanes = TransformBatch::LANES;
+// The batched forward kinematics go link by link over blocks of kBlock
+// configurations, a multiple of kLanes: each coefficient of a link is then
+// a contiguous row of the block, and the rows of the parent stay in cache.
+const std::size_t kBlock = 256u;
+// a thread computes at least this number of blocks
+const std::size_t kMinGrainBlocks = 2u;
+
+// xRotateColumns on the columns A and B of a block of matrices: the
+// constant columns let the compiler vectorize the loops.
+template <int A, int B>
+void xRotateColumnsBlock(float (*m)[kBlock], const float *c, const float *s,
+                         std::size_t padded) {
+  for (int row = 0; row < 12; row += 4) {
+    for (std::size_t b = 0u; b < padded; b += kLanes) {
+      for (std::size_t l = 0u; l < kLanes; ++l) {
+        const std::size_t k = b + l;
+        const float a0 = m[row + A][k];
+        m[row + A][k] = c[k] * a0 + s[k] * m[row + B][k];
+        m[row + B][k] = c[k] * m[row + B][k] - s[k] * a0;
+      }
+    }
+  }
+}
+
+// The batched forward kinematics of the configurations [first, first +
+// kBlock) of the batch. The loops on the lanes have a constant trip count
+// and are vectorized by the compiler, the sines and cosines by the
+// fastSinCos kernel. The other operations are those of the single forward
+// kinematics, in the same order, lane by lane.
+void xForwardKinematicsBlock(const KinematicModel &model, const float *q,
+                             std::size_t count, std::size_t first,
+                             std::vector<TransformBatch> &poses) {
+  const std::size_t variables = model.variableCount();
+  const std::size_t size = std::min(kBlock, count - first);
+  // the padding lanes of the batches are computed too
+  const std::size_t padded = (size + kLanes - 1u) / kLanes * kLanes;
+  const std::size_t rootStride = poses[0].stride();
+  float *root = poses[0].data(TransformBatch::R1_C1) + first;
+  for (std::size_t i = 0u; i < TransformBatch::COEFFICIENTS; ++i) {
+    const float value = (i == 0u || i == 5u || i == 10u) ? 1.0f : 0.0f;
+    for (std::size_t b = 0u; b < padded; b += kLanes) {
+      for (std::size_t k = 0u; k < kLanes; ++k) {
+        root[i * rootStride + b + k] = value;
+      }
+    }
+  }
+  float m[TransformBatch::COEFFICIENTS][kBlock];
+  float out[TransformBatch::COEFFICIENTS][kBlock];
+  float position[kBlock];
+  float s[kBlock];
+  float c[kBlock];
+  for (std::size_t link = 1u; link < model.linkCount(); ++link) {
+    const float *origin = &model.jointOrigin(link).r1_c1;
+    for (std::size_t i = 0u; i < TransformBatch::COEFFICIENTS; ++i) {
+      for (std::size_t b = 0u; b < padded; b += kLanes) {
+        for (std::size_t k = 0u; k < kLanes; ++k) m[i][b + k] = origin[i];
+      }
+    }
+    const KinematicModel::JointType type = model.jointType(link);
+    if (type != KinematicModel::JOINT_FIXED) {
+      // the padding lanes get the zero position
+      const float *values = q + first * variables + model.jointVariable(link);
+      const float multiplier = model.jointMultiplier(link);
+      const float offset = model.jointOffset(link);
+      for (std::size_t k = 0u; k < padded; ++k) {
+        position[k] =
+            k < size ? multiplier * values[k * variables] + offset : 0.0f;
+      }
+    }
+    const Position3D &axis = model.jointAxis(link);
+    if (type == KinematicModel::JOINT_PRISMATIC) {
+      for (std::size_t b = 0u; b < padded; b += kLanes) {
+        for (std::size_t l = 0u; l < kLanes; ++l) {
+          const std::size_t k = b + l;
+          const float x = position[k] * axis.x;
+          const float y = position[k] * axis.y;
+          const float z = position[k] * axis.z;
+          m[3][k] += m[0][k] * x + m[1][k] * y + m[2][k] * z;
+          m[7][k] += m[4][k] * x + m[5][k] * y + m[6][k] * z;
+          m[11][k] += m[8][k] * x + m[9][k] * y + m[10][k] * z;
+        }
+      }
+    } else if (type != KinematicModel::JOINT_FIXED) {
+      detail::transformKernels().sinCos(position, s, c, padded);
+      switch (type) {
+        case KinematicModel::JOINT_RX:
+          xRotateColumnsBlock<1, 2>(m, c, s, padded);
+          break;
+        case KinematicModel::JOINT_RY:
+          xRotateColumnsBlock<2, 0>(m, c, s, padded);
+          break;
+        case KinematicModel::JOINT_RZ:
+          xRotateColumnsBlock<0, 1>(m, c, s, padded);
+          break;
+        default:
+          for (std::size_t k = 0u; k < padded; ++k) {
+            Transform motion = model.jointOrigin(link);
+            xRotateAboutAxis(motion, axis, c[k], s[k]);
+            const float *rotated = &motion.r1_c1;
+            for (std::size_t i = 0u; i < TransformBatch::COEFFICIENTS; ++i) {
+              m[i][k] = rotated[i];
+            }
+          }
+          break;
+      }
+    }
+    // pose = parent * m, in the order of the Transform kernels. The block
+    // is computed in a local buffer, which the compiler knows does not
+    // alias the parent. The batches of a reused vector may have different
+    // strides.
+    const TransformBatch &parent = poses[model.parent(link)];
+    const std::size_t stride = parent.stride();
+    const float *p = parent.data(TransformBatch::R1_C1) + first;
+    for (std::size_t r = 0u; r < 12u; r += 4u) {
+      const float *p0 = p + r * stride;
+      const float *p1 = p0 + stride;
+      const float *p2 = p1 + stride;
+      const float *p3 = p2 + stride;
+      for (std::size_t b = 0u; b < padded; b += kLanes) {
+        for (std::size_t l = 0u; l < kLanes; ++l) {
+          const std::size_t k = b + l;
+          out[r][k] =
+              (p0[k] * m[0][k]) + (p1[k] * m[4][k]) + (p2[k] * m[8][k]);
+          out[r + 1u][k] =
+              (p0[k] * m[1][k]) + (p1[k] * m[5][k]) + (p2[k] * m[9][k]);
+          out[r + 2u][k] =
+              (p0[k] * m[2][k]) + (p1[k] * m[6][k]) + (p2[k] * m[10][k]);
+          out[r + 3u][k] = (p0[k] * m[3][k]) + (p1[k] * m[7][k]) +
+                           (p2[k] * m[11][k]) + p3[k];
+        }
+      }
+    }
+    TransformBatch &pose = poses[link];
+    for (std::size_t i = 0u; i < TransformBatch::COEFFICIENTS; ++i) {
+      std::memcpy(pose.data(TransformBatch::R1_C1) + i * pose.stride() + first,
+                  out[i], padded * sizeof(float));
+    }
+  }
+}
+
+[[noreturn]] void xThrow(const std::string &message) {
+  throw std::runtime_error("ALMath: KinematicModel: " + message);
+}
+}
+
+KinematicModel::KinematicModel(const urdf::RobotTree &tree) {
+  JointCollector collector;
+  tree.traverse_joints(collector);
+  const std::size_t size = collector.joints.size() + 1u;
+  _parents.reserve(size);
+  _types.reserve(size);
+  _origins.reserve(size);
+  _axes.reserve(size);
+  _variables.reserve(size);
+  _multipliers.reserve(size);
+  _offsets.reserve(size);
+  _linkNames.reserve(size);
+  _jointNames.reserve(size);
+
+  _parents.push_back(-1);
+  _types.push_back(JOINT_FIXED);
+  _origins.push_back(Transform());
+  _axes.push_back(Position3D());
+  _variables.push_back(-1);
+  _multipliers.push_back(1.0f);
+  _offsets.push_back(0.0f);
+  _linkNames.push_back(tree.root_link());
+  _jointNames.push_back(std::string());
+
+  std::map<std::string, std::size_t> links;
+  links[tree.root_link()] = 0u;
+  std::map<std::string, std::size_t> joints;
+  for (const urdf::ptree *pt : collector.joints) {
+    const urdf::Joint joint(*pt);
+    const std::size_t link = _parents.size();
+    _parents.push_back(static_cast<int>(links.at(joint.parent_link())));
+    links[joint.child_link()] = link;
+    joints[joint.name()] = link;
+    _linkNames.push_back(joint.child_link());
+    _jointNames.push_back(joint.name());
+    _origins.push_back(toALMathTransform(
+        toEigenTransform(joint.origin()).matrix().topRows<3>().cast<float>()));
+    _variables.push_back(-1);
+    _multipliers.push_back(1.0f);
+    _offsets.push_back(0.0f);
+
+    Position3D axis;
+    switch (joint.type()) {
+      case urdf::Joint::fixed:
+        _types.push_back(JOINT_FIXED);
+        _axes.push_back(axis);
+        continue;
+      case urdf::Joint::revolute:
+      case urdf::Joint::continuous:
+        _types.push_back(JOINT_REVOLUTE);
+        break;
+      case urdf::Joint::prismatic:
+        _types.push_back(JOINT_PRISMATIC);
+        break;
+      case urdf::Joint::floating:
+      case urdf::Joint::planar:
+        xThrow("unsupported type for joint \"" + joint.name() + "\"");
+    }
+    const urdf::Array3d xyz = joint.axis();
+    const double norm =
+        std::sqrt(xyz[0] * xyz[0] + xyz[1] * xyz[1] + xyz[2] * xyz[2]);
+    if (norm == 0.0) {
+      xThrow("null axis for joint \"" + joint.name() + "\"");
+    }
+    axis = Position3D(static_cast<float>(xyz[0] / norm),
+                      static_cast<float>(xyz[1] / norm),
+                      static_cast<float>(xyz[2] / norm));
+    _axes.push_back(axis);
+    if (!joint.mimic()) {
+      _variables.back() = static_cast<int>(_variableNames.size());
+      _variableNames.push_back(joint.name());
+      const boost::optional<std::pair<double, double>> limits =
+          joint.limit_lower_upper();
+      if (limits && joint.type() != urdf::Joint::continuous) {
+        _variableLowers.push_back(static_cast<float>(limits->first));
+        _variableUppers.push_back(static_cast<float>(limits->second));
+      } else {
+        _variableLowers.push_back(-std::numeric_limits<float>::infinity());
+        _variableUppers.push_back(std::numeric_limits<float>::infinity());
+      }
+    }
+  }
+
+  // Resolve the mimic joints. A mimic joint may mimic another mimic joint:
+  // iterate until all are resolved, RobotTree forbids the loops.
+  bool resolved = false;
+  while (!resolved) {
+    resolved = true;
+    for (std::size_t link = 1u; link < _parents.size(); ++link) {
+      if (_types[link] == JOINT_FIXED || _variables[link] >= 0) continue;
+      const urdf::Joint joint(*collector.joints[link - 1u]);
+      const urdf::Mimic mimic = *joint.mimic();
+      const std::map<std::string, std::size_t>::const_iterator source =
+          joints.find(mimic.joint());
+      if (source == joints.end() || _types[source->second] == JOINT_FIXED) {
+        xThrow("joint \"" + _jointNames[link] +
+               "\" mimics a joint which is not movable");
+      }
+      if (_variables[source->second] < 0) {
+        resolved = false;
+        continue;
+      }
+      const float multiplier = static_cast<float>(mimic.multiplier());
+      _variables[link] = _variables[source->second];
+      _multipliers[link] = multiplier * _multipliers[source->second];
+      _offsets[link] = multiplier * _offsets[source->second] +
+                       static_cast<float>(mimic.offset());
+
+      // the limits of the mimic joint restrict its variable
+      const boost::optional<std::pair<double, double>> limits =
+          joint.limit_lower_upper();
+      if (!limits || joint.type() == urdf::Joint::continuous ||
+          _multipliers[link] == 0.0f) {
+        continue;
+      }
+      const std::size_t variable = static_cast<std::size_t>(_variables[link]);
+      float lower =
+          (static_cast<float>(limits->first) - _offsets[link]) /
+          _multipliers[link];
+      float upper =
+          (static_cast<float>(limits->second) - _offsets[link]) /
+          _multipliers[link];
+      if (_multipliers[link] < 0.0f) std::swap(lower, upper);
+      _variableLowers[variable] = std::max(_variableLowers[variable], lower);
+      _variableUppers[variable] = std::min(_variableUppers[variable], upper);
+      if (_variableLowers[variable] > _variableUppers[variable]) {
+        xThrow("the limits of joint \"" + _jointNames[link] +
+               "\" do not overlap those of the joint it mimics");
+      }
+    }
+  }
+
+  // the links are in depth first order: each subtree is contiguous
+  _subtreeEnds.resize(_parents.size());
+  for (std::size_t link = _parents.size(); link-- > 0u;) {
+    _subtreeEnds[link] = std::max(_subtreeEnds[link], link + 1u);
+    if (link > 0u) {
+      std::size_t &parentEnd = _subtreeEnds[_parents[link]];
+      parentEnd = std::max(parentEnd, _subtreeEnds[link]);
+    }
+  }
+
+  // the revolute joints about +/-x, +/-y or +/-z get their own kernel
+  for (std::size_t link = 1u; link < _parents.size(); ++link) {
+    if (_types[link] != JOINT_REVOLUTE) continue;
+    const Position3D &axis = _axes[link];
+    const float coordinates[3] = {axis.x, axis.y, axis.z};
+    for (int i = 0; i < 3; ++i) {
+      const float value = coordinates[i];
+      if ((value == 1.0f || value == -1.0f) &&
+          coordinates[(i + 1) % 3] == 0.0f &&
+          coordinates[(i + 2) % 3] == 0.0f) {
+        _types[link] = static_cast<JointType>(JOINT_RX + i);
+        _multipliers[link] *= value;
+        _offsets[link] *= value;
+        _axes[link] = Position3D(i == 0 ? 1.0f : 0.0f, i == 1 ? 1.0f : 0.0f,
+                                 i == 2 ? 1.0f : 0.0f);
+      }
+    }
+  }
+}
+
+const std::string &KinematicModel::linkName(std::size_t link) const {
+  return _linkNames.at(link);
+}
+
+std::size_t KinematicModel::linkIndex(const std::string &name) const {
+  for (std::size_t i = 0u; i < _linkNames.size(); ++i) {
+    if (_linkNames[i] == name) return i;
+  }
+  xThrow("no link named \"" + name + "\"");
+}
+
+const std::string &KinematicModel::jointName(std::size_t link) const {
+  return _jointNames.at(link);
+}
+
+const std::string &KinematicModel::variableName(std::size_t variable) const {
+  return _variableNames.at(variable);
+}
+
+std::size_t KinematicModel::variableIndex(const std::string &jointName) const {
+  for (std::size_t i = 0u; i < _variableNames.size(); ++i) {
+    if (_variableNames[i] == jointName) return i;
+  }
+  xThrow("no variable for joint \"" + jointName + "\"");
+}
+
+// The products by the parent pose go through the Transform kernels. The
+// motion of a joint is applied to a copy of its origin rather than to the
+// product: the kernel of the child link would then load the pose right
+// after the scalar stores which updated it, and stall.
+void KinematicModel::forwardKinematics(const float *q, Transform *poses,
+                                       std::size_t begin,
+                                       std::size_t end) const {
+  const detail::TransformKernels &kernels = detail::transformKernels();
+  if (begin == 0u) {
+    poses[0] = Transform();
+    begin = 1u;
+  }
+  for (std::size_t link = begin; link < end; ++link) {
+    const Transform &parent = poses[_parents[link]];
+    const JointType type = _types[link];
+    if (type == JOINT_FIXED) {
+      kernels.transformMultiply(&parent.r1_c1, &_origins[link].r1_c1,
+                                &poses[link].r1_c1);
+      continue;
+    }
+    const float position =
+        _multipliers[link] * q[_variables[link]] + _offsets[link];
+    Transform motion = _origins[link];
+    if (type == JOINT_PRISMATIC) {
+      xTranslateAlongAxis(motion, _axes[link], position);
+    } else {
+      float s, c;
+      detail::sinCos(position, s, c);
+      switch (type) {
+        case JOINT_RX:
+          xRotateColumns(motion.r1_c2, motion.r1_c3, c, s);
+          xRotateColumns(motion.r2_c2, motion.r2_c3, c, s);
+          xRotateColumns(motion.r3_c2, motion.r3_c3, c, s);
+          break;
+        case JOINT_RY:
+          xRotateColumns(motion.r1_c3, motion.r1_c1, c, s);
+          xRotateColumns(motion.r2_c3, motion.r2_c1, c, s);
+          xRotateColumns(motion.r3_c3, motion.r3_c1, c, s);
+          break;
+        case JOINT_RZ:
+          xRotateColumns(motion.r1_c1, motion.r1_c2, c, s);
+          xRotateColumns(motion.r2_c1, motion.r2_c2, c, s);
+          xRotateColumns(motion.r3_c1, motion.r3_c2, c, s);
+          break;
+        default:
+          xRotateAboutAxis(motion, _axes[link], c, s);
+          break;
+      }
+    }
+    kernels.transformMultiply(&parent.r1_c1, &motion.r1_c1,
+                              &poses[link].r1_c1);
+  }
+}
+
+void KinematicModel::forwardKinematics(const float *q,
+                                       Transform *poses) const {
+  forwardKinematics(q, poses, 0u, _parents.size());
+}
+
+void KinematicModel::forwardKinematics(const std::vector<float> &q,
+                                       std::vector<Transform> &poses) const {
+  if (q.size() != _variableNames.size()) {
+    xThrow("forwardKinematics called with a wrong number of variables");
+  }
+  poses.resize(_parents.size());
+  forwardKinematics(q.data(), poses.data());
+}
+
+void KinematicModel::forwardKinematics(const float *q, std::size_t count,
+                                       std::vector<TransformBatch> &poses,
+                                       unsigned int maxThreads) const {
+  poses.resize(_parents.size());
+  for (TransformBatch &batch : poses) batch.resize(count);
+  const std::size_t blocks = (count + kBlock - 1u) / kBlock;
+  detail::parallelFor(blocks, maxThreads, kMinGrainBlocks,
+                      [&](std::size_t begin, std::size_t end) {
+    for (std::size_t block = begin; block < end; ++block) {
+      xForwardKinematicsBlock(*this, q, count, block * kBlock, poses);
+    }
+  });
+}
+
+// The column of a joint is its twist: for a revolute joint of axis z
+// through the point p, the angular velocity z and the linear velocity
+// z x (o - p) of the point o of the link taken as reference; for a
+// prismatic joint, no angular velocity and the linear velocity z. The
+// joints which share a variable add up their columns.
+void KinematicModel::jacobian(const Transform *poses, std::size_t link,
+                              JacobianFrame frame, float *jacobian) const {
+  std::fill(jacobian, jacobian + 6u * _variableNames.size(), 0.0f);
+  const Transform &end = poses[link];
+  for (std::size_t i = link; i > 0u;
+       i = static_cast<std::size_t>(_parents[i])) {
+    if (_types[i] == JOINT_FIXED) continue;
+    // the joint frame has the orientation of the child link
+    const Transform &pose = poses[i];
+    const Position3D &axis = _axes[i];
+    const float m = _multipliers[i];
+    const float z[3] = {
+        m * (pose.r1_c1 * axis.x + pose.r1_c2 * axis.y + pose.r1_c3 * axis.z),
+        m * (pose.r2_c1 * axis.x + pose.r2_c2 * axis.y + pose.r2_c3 * axis.z),
+        m * (pose.r3_c1 * axis.x + pose.r3_c2 * axis.y + pose.r3_c3 * axis.z)};
+    float twist[6];
+    if (_types[i] == JOINT_PRISMATIC) {
+      twist[0] = z[0];
+      twist[1] = z[1];
+      twist[2] = z[2];
+      twist[3] = twist[4] = twist[5] = 0.0f;
+    } else {
+      // from the joint to the reference point
+      float d[3] = {-pose.r1_c4, -pose.r2_c4, -pose.r3_c4};
+      if (frame != JACOBIAN_WORLD) {
+        d[0] += end.r1_c4;
+        d[1] += end.r2_c4;
+        d[2] += end.r3_c4;
+      }
+      twist[0] = z[1] * d[2] - z[2] * d[1];
+      twist[1] = z[2] * d[0] - z[0] * d[2];
+      twist[2] = z[0] * d[1] - z[1] * d[0];
+      twist[3] = z[0];
+      twist[4] = z[1];
+      twist[5] = z[2];
+    }
+    float *column = jacobian + 6u * _variables[i];
+    if (frame == JACOBIAN_LOCAL) {
+      float local[6];
+      xRotateInverse(end, twist, local);
+      xRotateInverse(end, twist + 3, local + 3);
+      for (int k = 0; k < 6; ++k) column[k] += local[k];
+    } else {
+      for (int k = 0; k < 6; ++k) column[k] += twist[k];
+    }
+  }
+}
+
+void KinematicModel::jacobians(const float *q, std::size_t count,
+                               std::size_t link, JacobianFrame frame,
+                               Transform *poses, float *jacobians) const {
+  const std::size_t variables = _variableNames.size();
+  const std::size_t links = _parents.size();
+  for (std::size_t k = 0u; k < count; ++k) {
+    forwardKinematics(q + k * variables, poses + k * links);
+    jacobian(poses + k * links, link, frame, jacobians + 6u * k * variables);
+  }
+}
+}
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/scenegraph/kinematicstate.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace AL {
+namespace Math {
+
+KinematicState::KinematicState(const KinematicModel &model)
+    : _model(model),
+      _q(model.variableCount(), 0.0f),
+      _poses(model.linkCount()),
+      _variableLinkOffsets(model.variableCount() + 1u, 0u),
+      _dirtyFlags(model.linkCount(), 0) {
+  // counting sort of the links by variable
+  const std::size_t size = model.linkCount();
+  for (std::size_t link = 0u; link < size; ++link) {
+    const int variable = model.jointVariable(link);
+    if (variable >= 0) ++_variableLinkOffsets[variable + 1];
+  }
+  for (std::size_t v = 0u; v < model.variableCount(); ++v) {
+    _variableLinkOffsets[v + 1u] += _variableLinkOffsets[v];
+  }
+  _variableLinks.resize(_variableLinkOffsets.back());
+  std::vector<std::size_t> next(_variableLinkOffsets.begin(),
+                                _variableLinkOffsets.end() - 1);
+  for (std::size_t link = 0u; link < size; ++link) {
+    const int variable = model.jointVariable(link);
+    if (variable >= 0) _variableLinks[next[variable]++] = link;
+  }
+  _model.forwardKinematics(_q.data(), _poses.data());
+}
+
+void KinematicState::setVariable(std::size_t variable, float value) {
+  if (_q[variable] == value) return;
+  _q[variable] = value;
+  for (std::size_t i = _variableLinkOffsets[variable];
+       i < _variableLinkOffsets[variable + 1u]; ++i) {
+    const std::size_t link = _variableLinks[i];
+    if (!_dirtyFlags[link]) {
+      _dirtyFlags[link] = 1;
+      _dirtyLinks.push_back(link);
+    }
+  }
+}
+
+void KinematicState::setVariables(const float *q) {
+  for (std::size_t v = 0u; v < _q.size(); ++v) {
+    setVariable(v, q[v]);
+  }
+}
+
+void KinematicState::setVariables(const std::vector<float> &q) {
+  if (q.size() != _q.size()) {
+    throw std::runtime_error(
+        "ALMath: KinematicState::setVariables called with a wrong number of "
+        "variables");
+  }
+  setVariables(q.data());
+}
+
+std::size_t KinematicState::update() {
+  if (_dirtyLinks.empty()) return 0u;
+  // a dirty subtree may contain others: skip them
+  std::sort(_dirtyLinks.begin(), _dirtyLinks.end());
+  std::size_t count = 0u;
+  std::size_t end = 0u;
+  for (std::size_t link : _dirtyLinks) {
+    _dirtyFlags[link] = 0;
+    if (link < end) continue;
+    end = _model.subtreeEnd(link);
+    _model.forwardKinematics(_q.data(), _poses.data(), link, end);
+    count += end - link;
+  }
+  _dirtyLinks.clear();
+  return count;
+}
+
+const Transform &KinematicState::pose(std::size_t link) {
+  for (std::size_t dirtyLink : _dirtyLinks) {
+    if (dirtyLink <= link && link < _model.subtreeEnd(dirtyLink)) {
+      update();
+      break;
+    }
+  }
+  return _poses[link];
+}
+
+const std::vector<Transform> &KinematicState::poses() {
+  update();
+  return _poses;
+}
+
+void KinematicState::jacobian(std::size_t link,
+                              KinematicModel::JacobianFrame frame,
+                              float *jacobian) {
+  // the ancestors of a link are dirty only if the link is
+  pose(link);
+  _model.jacobian(_poses.data(), link, frame, jacobian);
+}
+}
+}
@@ -4,6 +4,7 @@
  */
 #include <almath/scenegraph/meshfactory.h>
 #include <almath/scenegraph/mesh.h>
+#include "../tools/trigonometry.h"
 #include <stdexcept>
 #include <cmath>
 #include <stddef.h>
@@ -109,19 +110,21 @@ static Vert xAddMeridian(float pHalfExtentZ, float pRadius, int pNbVertices,
   const int nphi = 2 * (pNbVertices + 1);
   const float dphi = 3.14f / nphi;
   float z = pHalfExtentZ;
+  float sinLambda, cosLambda;
+  Math::detail::sinCos(lambda, sinLambda, cosLambda);
   for (int iphi = 1; iphi < nphi; ++iphi) {
     float phi = iphi * dphi;  // polar angle
-    float rxy = pRadius * std::sin(phi);
-    data.normal(std::sin(phi) * std::cos(lambda),
-                std::sin(phi) * std::sin(lambda), std::cos(phi));
-    data.position(x + rxy * std::cos(lambda), y + rxy * std::sin(lambda),
-                  z + pRadius * std::cos(phi));
+    float sinPhi, cosPhi;
+    Math::detail::sinCos(phi, sinPhi, cosPhi);
+    float rxy = pRadius * sinPhi;
+    data.normal(sinPhi * cosLambda, sinPhi * sinLambda, cosPhi);
+    data.position(x + rxy * cosLambda, y + rxy * sinLambda,
+                  z + pRadius * cosPhi);
     if ((iphi % (nphi / 2) == 0) && pHalfExtentZ != 0) {
       z = -pHalfExtentZ;
-      data.normal(std::sin(phi) * std::cos(lambda),
-                  std::sin(phi) * std::sin(lambda), std::cos(phi));
-      data.position(x + rxy * std::cos(lambda), y + rxy * std::sin(lambda),
-                    z + pRadius * std::cos(phi));
+      data.normal(sinPhi * cosLambda, sinPhi * sinLambda, cosPhi);
+      data.position(x + rxy * cosLambda, y + rxy * sinLambda,
+                    z + pRadius * cosPhi);
     }
   }
   return vert;
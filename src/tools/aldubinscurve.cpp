@@ -8,6 +8,7 @@
 
 #include <almath/types/alposition2d.h>
 #include <almath/tools/altrigonometry.h>
+#include "trigonometry.h"
 
 #include "float.h" // for FLT_MAX
 #include <stdexcept>
@@ -263,14 +264,17 @@ namespace AL {
       tmpCircle.y = -pCircleRadius;
       pCircles.at(1) = tmpCircle;
 
+      float lSin, lCos;
+      detail::sinCos(pPose.theta, lSin, lCos);
+
       // Left Circle - Desired
-      tmpCircle.x = pPose.x - ( sin(pPose.theta)*pCircleRadius );
-      tmpCircle.y = pPose.y + ( cos(pPose.theta)*pCircleRadius );
+      tmpCircle.x = pPose.x - ( lSin*pCircleRadius );
+      tmpCircle.y = pPose.y + ( lCos*pCircleRadius );
       pCircles.at(2) = tmpCircle;
 
       // Right Circle - Desired
-      tmpCircle.x = pPose.x + ( sin(pPose.theta)*pCircleRadius );
-      tmpCircle.y = pPose.y - ( cos(pPose.theta)*pCircleRadius );
+      tmpCircle.x = pPose.x + ( lSin*pCircleRadius );
+      tmpCircle.y = pPose.y - ( lCos*pCircleRadius );
       pCircles.at(3) = tmpCircle;
     } // end getCircles
 
@@ -314,8 +318,9 @@ namespace AL {
       //// First CheckPoint of this Dubins Curve
       tmpSolution.x = bestTangent.at(0).x;
       tmpSolution.y = bestTangent.at(0).y;
-      tmpSolution.theta = std::atan2(bestTangent.at(1).y - bestTangent.at(0).y,
-                                     bestTangent.at(1).x - bestTangent.at(0).x);
+      tmpSolution.theta = detail::atan2(
+            bestTangent.at(1).y - bestTangent.at(0).y,
+            bestTangent.at(1).x - bestTangent.at(0).x);
       solutions.push_back(tmpSolution);
 
       //// Second CheckPoint of this Dubins Curve
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alerrorpolicy.h>
+#include "errorpolicy.h"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace AL {
+  namespace Math {
+
+    namespace {
+      std::atomic<int> gErrorPolicy(ERROR_POLICY_WARN);
+      std::atomic<ErrorCallback> gErrorCallback(NULL);
+      std::atomic<std::size_t> gErrorCounts[ERROR_KIND_COUNT];
+      thread_local ErrorPolicy tThreadErrorPolicy = ERROR_POLICY_GLOBAL;
+
+      void xCheckKind(ErrorKind pKind)
+      {
+        if (pKind < 0 || pKind >= ERROR_KIND_COUNT)
+        {
+          throw std::runtime_error("ALMath: unknown ErrorKind.");
+        }
+      }
+
+      void xCheckPolicy(ErrorPolicy pPolicy)
+      {
+        if (pPolicy < ERROR_POLICY_WARN || pPolicy > ERROR_POLICY_GLOBAL)
+        {
+          throw std::runtime_error("ALMath: unknown ErrorPolicy.");
+        }
+      }
+
+      void xReport(ErrorPolicy pPolicy, ErrorKind pKind,
+                   const std::string& pMessage)
+      {
+        switch (pPolicy)
+        {
+        case ERROR_POLICY_WARN:
+          std::cerr << "ALMath: WARNING: " << pMessage << std::endl;
+          break;
+        case ERROR_POLICY_CALLBACK:
+        {
+          const ErrorCallback lCallback = gErrorCallback.load();
+          if (lCallback != NULL)
+          {
+            lCallback(pKind, pMessage.c_str());
+          }
+          break;
+        }
+        case ERROR_POLICY_THROW:
+          throw std::runtime_error("ALMath: " + pMessage);
+        default:
+          break;
+        }
+      }
+    }
+
+    ErrorPolicy setErrorPolicy(ErrorPolicy pPolicy)
+    {
+      xCheckPolicy(pPolicy);
+      if (pPolicy == ERROR_POLICY_GLOBAL)
+      {
+        throw std::runtime_error(
+          "ALMath: setErrorPolicy: ERROR_POLICY_GLOBAL is only valid for "
+          "setThreadErrorPolicy.");
+      }
+      return static_cast<ErrorPolicy>(gErrorPolicy.exchange(pPolicy));
+    }
+
+    ErrorPolicy setThreadErrorPolicy(ErrorPolicy pPolicy)
+    {
+      xCheckPolicy(pPolicy);
+      const ErrorPolicy lPrevious = tThreadErrorPolicy;
+      tThreadErrorPolicy = pPolicy;
+      return lPrevious;
+    }
+
+    ErrorPolicy errorPolicy()
+    {
+      const ErrorPolicy lPolicy = tThreadErrorPolicy;
+      if (lPolicy != ERROR_POLICY_GLOBAL)
+      {
+        return lPolicy;
+      }
+      return static_cast<ErrorPolicy>(
+            gErrorPolicy.load(std::memory_order_relaxed));
+    }
+
+    ErrorCallback setErrorCallback(ErrorCallback pCallback)
+    {
+      return gErrorCallback.exchange(pCallback);
+    }
+
+    std::size_t errorCount(ErrorKind pKind)
+    {
+      xCheckKind(pKind);
+      return gErrorCounts[pKind].load(std::memory_order_relaxed);
+    }
+
+    void resetErrorCounts()
+    {
+      for (int i = 0; i < ERROR_KIND_COUNT; ++i)
+      {
+        gErrorCounts[i].store(0u, std::memory_order_relaxed);
+      }
+    }
+
+    namespace detail {
+
+      void countError(ErrorKind pKind)
+      {
+        gErrorCounts[pKind].fetch_add(1u, std::memory_order_relaxed);
+      }
+
+      void reportError(ErrorKind pKind, const char* pMessage)
+      {
+        countError(pKind);
+        const ErrorPolicy lPolicy = errorPolicy();
+        if (lPolicy != ERROR_POLICY_IGNORE)
+        {
+          xReport(lPolicy, pKind, pMessage);
+        }
+      }
+
+      void reportWrongSize(const char* pCall,
+                           const char* pExpected,
+                           std::size_t pSize,
+                           const char* pResult)
+      {
+        countError(ERROR_WRONG_SIZE);
+        const ErrorPolicy lPolicy = errorPolicy();
+        if (lPolicy != ERROR_POLICY_IGNORE)
+        {
+          xReport(lPolicy, ERROR_WRONG_SIZE,
+                  std::string(pCall) +
+                  " call with a wrong size of vector. Size expected: " +
+                  pExpected + ". Size given: " + std::to_string(pSize) +
+                  ". " + pResult);
+        }
+      }
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alfastmath.h>
+#include "../kernels/transformkernels.h"
+
+namespace AL {
+  namespace Math {
+
+    void fastSinCos(
+      const float* pAngles,
+      float*       pSin,
+      float*       pCos,
+      std::size_t  pSize)
+    {
+      detail::transformKernels().sinCos(pAngles, pSin, pCos, pSize);
+    }
+
+    void fastAtan2(
+      const float* pY,
+      const float* pX,
+      float*       pOut,
+      std::size_t  pSize)
+    {
+      detail::transformKernels().atan2(pY, pX, pOut, pSize);
+    }
+
+  } // end namespace Math
+} // end namespace AL
@@ -6,8 +6,12 @@
 
 #include <almath/tools/almath.h>
 #include <almath/tools/altrigonometry.h>
+#include "../kernels/transformkernels.h"
+#include "trigonometry.h"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 #include <boost/math/special_functions/pow.hpp>
 #include <boost/algorithm/clamp.hpp>
 
@@ -37,9 +41,79 @@ namespace AL
       return result;
     }
 
+    namespace
+    {
+      // sines and cosines are computed by blocks, on the stack
+      const std::size_t MEAN_ANGLE_BLOCK = 256u;
+
+      // add the sum of the unit vectors of the angles, weighted by
+      // pWeights if not null, to pSumCos and pSumSin
+      void xSumUnitVectors(
+        const float* pAngles,
+        const float* pWeights,
+        std::size_t  pSize,
+        float&       pSumCos,
+        float&       pSumSin)
+      {
+        float lSin[MEAN_ANGLE_BLOCK];
+        float lCos[MEAN_ANGLE_BLOCK];
+        for (std::size_t lBegin = 0u; lBegin < pSize;
+             lBegin += MEAN_ANGLE_BLOCK)
+        {
+          const std::size_t lSize = std::min(pSize - lBegin, MEAN_ANGLE_BLOCK);
+          detail::sinCos(pAngles + lBegin, lSin, lCos, lSize);
+          if (pWeights != NULL)
+          {
+            const float* w = pWeights + lBegin;
+            for (std::size_t i = 0u; i < lSize; ++i)
+            {
+              if (w[i] <= 0.f) {
+                throw std::runtime_error(
+                  "All weights must be strictly positive.");
+              }
+              lCos[i] *= w[i];
+              lSin[i] *= w[i];
+            }
+          }
+          // four partial sums, which the compiler can vectorize
+          float lC[4] = {0.f, 0.f, 0.f, 0.f};
+          float lS[4] = {0.f, 0.f, 0.f, 0.f};
+          std::size_t i = 0u;
+          for (; i + 4u <= lSize; i += 4u)
+          {
+            for (std::size_t j = 0u; j < 4u; ++j)
+            {
+              lC[j] += lCos[i + j];
+              lS[j] += lSin[i + j];
+            }
+          }
+          for (; i < lSize; ++i)
+          {
+            lC[0] += lCos[i];
+            lS[0] += lSin[i];
+          }
+          pSumCos += (lC[0] + lC[1]) + (lC[2] + lC[3]);
+          pSumSin += (lS[0] + lS[1]) + (lS[2] + lS[3]);
+        }
+      }
+
+      float xMeanAngle(
+        const float* pAngles,
+        const float* pWeights,
+        std::size_t  pSize)
+      {
+        float lSumCos = 0.f;
+        float lSumSin = 0.f;
+        xSumUnitVectors(pAngles, pWeights, pSize, lSumCos, lSumSin);
+        if (Math::Position2D(lSumCos, lSumSin).norm() < 1e-3f) {
+          throw std::runtime_error("No defined mean.");
+        }
+        return Math::modulo2PI(detail::atan2(lSumSin, lSumCos));
+      }
+    }
+
     float meanAngle(const std::vector<float> &pAngles) {
-      const std::vector<float> weights(pAngles.size(), 1.f);
-      return weightedMeanAngle(pAngles, weights);
+      return xMeanAngle(pAngles.data(), NULL, pAngles.size());
     }
 
     float weightedMeanAngle(const std::vector<float> &pAngles,
@@ -47,21 +121,105 @@ namespace AL
       if (pAngles.size() != pWeights.size()) {
         throw std::runtime_error("Angles and weights must have the same size.");
       }
-      Math::Position2D sumPosition;
-      std::vector<float>::const_iterator a = pAngles.begin();
-      std::vector<float>::const_iterator w = pWeights.begin();
-      float weightSum = 0.f;
-      for (; a != pAngles.end(); ++a, ++w) {
-        if (*w <= 0.f) {
-          throw std::runtime_error("All weights must be strictly positive.");
-        }
-        weightSum += *w;
-        sumPosition += *w * Math::Position2D(std::cos(*a), std::sin(*a));
+      return xMeanAngle(pAngles.data(), pWeights.data(), pAngles.size());
+    }
+
+    float meanAngle(const float* pAngles, std::size_t pSize)
+    {
+      return xMeanAngle(pAngles, NULL, pSize);
+    }
+
+    float weightedMeanAngle(
+      const float* pAngles,
+      const float* pWeights,
+      std::size_t  pSize)
+    {
+      return xMeanAngle(pAngles, pWeights, pSize);
+    }
+
+    CircularMeanAccumulator::CircularMeanAccumulator()
+      : fSumCos(0.0)
+      , fSumSin(0.0)
+      , fWeightSum(0.0)
+      , fCount(0u)
+    {}
+
+    void CircularMeanAccumulator::add(float pAngle, float pWeight)
+    {
+      if (pWeight <= 0.f) {
+        throw std::runtime_error("All weights must be strictly positive.");
       }
-      if (sumPosition.norm() < 1e-3f) {
+      float lSin, lCos;
+      detail::sinCos(pAngle, lSin, lCos);
+      fSumCos += static_cast<double>(pWeight*lCos);
+      fSumSin += static_cast<double>(pWeight*lSin);
+      fWeightSum += static_cast<double>(pWeight);
+      ++fCount;
+    }
+
+    void CircularMeanAccumulator::remove(float pAngle, float pWeight)
+    {
+      if (fCount == 0u) {
+        throw std::runtime_error(
+          "ALMath: CircularMeanAccumulator::remove on an empty accumulator.");
+      }
+      if (--fCount == 0u)
+      {
+        // drop the rounding residue
+        reset();
+        return;
+      }
+      float lSin, lCos;
+      detail::sinCos(pAngle, lSin, lCos);
+      fSumCos -= static_cast<double>(pWeight*lCos);
+      fSumSin -= static_cast<double>(pWeight*lSin);
+      fWeightSum -= static_cast<double>(pWeight);
+    }
+
+    void CircularMeanAccumulator::reset()
+    {
+      fSumCos = 0.0;
+      fSumSin = 0.0;
+      fWeightSum = 0.0;
+      fCount = 0u;
+    }
+
+    std::size_t CircularMeanAccumulator::count() const
+    {
+      return fCount;
+    }
+
+    float CircularMeanAccumulator::weightSum() const
+    {
+      return static_cast<float>(fWeightSum);
+    }
+
+    bool CircularMeanAccumulator::hasMean() const
+    {
+      return std::sqrt(fSumCos*fSumCos + fSumSin*fSumSin) >= 1e-3;
+    }
+
+    float CircularMeanAccumulator::mean() const
+    {
+      if (!hasMean()) {
         throw std::runtime_error("No defined mean.");
       }
-      return Math::modulo2PI(std::atan2(sumPosition.y, sumPosition.x));
+      return Math::modulo2PI(static_cast<float>(std::atan2(fSumSin, fSumCos)));
+    }
+
+    float CircularMeanAccumulator::resultantLength() const
+    {
+      if (fWeightSum <= 0.0) {
+        return 0.f;
+      }
+      const double lLength =
+          std::sqrt(fSumCos*fSumCos + fSumSin*fSumSin) / fWeightSum;
+      return static_cast<float>(std::min(lLength, 1.0));
+    }
+
+    float CircularMeanAccumulator::circularVariance() const
+    {
+      return 1.f - resultantLength();
     }
 
     bool clipData(
@@ -79,15 +237,7 @@ namespace AL
       const float& pMax,
       std::vector<float>& pData)
     {
-      bool isClipped = false;
-      for (unsigned int i=0; i<pData.size(); ++i)
-      {
-        if (clipData(pMin, pMax, pData[i]))
-        {
-          isClipped = true;
-        }
-      }
-      return isClipped;
+      return clipData(pMin, pMax, pData.data(), pData.size()) != 0u;
     }
 
     bool clipData(
@@ -106,14 +256,32 @@ namespace AL
       return isClipped;
     }
 
+    std::size_t clipData(
+      const float* pMin,
+      const float* pMax,
+      float*       pData,
+      std::size_t  pSize)
+    {
+      return detail::transformKernels().clip(pMin, pMax, pData, pSize);
+    }
+
+    std::size_t clipData(
+      const float& pMin,
+      const float& pMax,
+      float*       pData,
+      std::size_t  pSize)
+    {
+      return detail::transformKernels().clipUniform(pMin, pMax, pData, pSize);
+    }
+
 
     void changeReferencePose2D(
         const float&  pTheta,
         const Pose2D& pPosIn,
         Pose2D&       pPosOut)
     {
-      const float cs = std::cos(pTheta);
-      const float sn = std::sin(pTheta);
+      float sn, cs;
+      detail::sinCos(pTheta, sn, cs);
       pPosOut.x = cs*pPosIn.x - sn*pPosIn.y;
       pPosOut.y = sn*pPosIn.x + cs*pPosIn.y;
       pPosOut.theta = pPosIn.theta;
@@ -124,8 +292,8 @@ namespace AL
         const float& pTheta,
         Pose2D&      pPosOut)
     {
-      const float cs = std::cos(pTheta);
-      const float sn = std::sin(pTheta);
+      float sn, cs;
+      detail::sinCos(pTheta, sn, cs);
       const float xOld = pPosOut.x;
       const float yOld = pPosOut.y;
 
@@ -155,10 +323,9 @@ namespace AL
       const Rotation&   pRot,
       const Position3D& pPos)
     {
-      return Position3D(
-            pRot.r1_c1*pPos.x + pRot.r1_c2*pPos.y + pRot.r1_c3*pPos.z,
-            pRot.r2_c1*pPos.x + pRot.r2_c2*pPos.y + pRot.r2_c3*pPos.z,
-            pRot.r3_c1*pPos.x + pRot.r3_c2*pPos.y + pRot.r3_c3*pPos.z);
+      Position3D lResult;
+      detail::transformKernels().rotationApply(&pRot.r1_c1, &pPos.x, &lResult.x);
+      return lResult;
     }
 
     Position3D operator*(
@@ -328,21 +495,21 @@ namespace AL
       const Pose2D&     pVal,
       const Position2D& pPos)
     {
+      float lSin, lCos;
+      detail::sinCos(pVal.theta, lSin, lCos);
       return Position2D(
-            pVal.x + std::cos(pVal.theta)*pPos.x - std::sin(pVal.theta)*pPos.y,
-            pVal.y + std::sin(pVal.theta)*pPos.x + std::cos(pVal.theta)*pPos.y);
+            pVal.x + lCos*pPos.x - lSin*pPos.y,
+            pVal.y + lSin*pPos.x + lCos*pPos.y);
     }
 
     void quaternionFromRotation3D(
         const Rotation3D& pRot3D,
         Quaternion& pQuaternion)
     {
-      const float cx = std::cos(0.5f*pRot3D.wx);
-      const float cy = std::cos(0.5f*pRot3D.wy);
-      const float cz = std::cos(0.5f*pRot3D.wz);
-      const float sx = std::sin(0.5f*pRot3D.wx);
-      const float sy = std::sin(0.5f*pRot3D.wy);
-      const float sz = std::sin(0.5f*pRot3D.wz);
+      float sx, cx, sy, cy, sz, cz;
+      detail::sinCos(0.5f*pRot3D.wx, sx, cx);
+      detail::sinCos(0.5f*pRot3D.wy, sy, cy);
+      detail::sinCos(0.5f*pRot3D.wz, sz, cz);
 
       pQuaternion.w = cz * cy * cx + sz * sy * sx;
       pQuaternion.x = cz * cy * sx - sz * sy * cx;
@@ -392,11 +559,11 @@ namespace AL
       AL::Math::Rotation lRot;
       rotationFromQuaternion(pQuaternion, lRot);
 
-      pRot3D.wz = std::atan2(lRot.r2_c1, lRot.r1_c1);
-      const float sy = std::sin(pRot3D.wz);
-      const float cy = std::cos(pRot3D.wz);
-      pRot3D.wy = std::atan2(-lRot.r3_c1, cy*lRot.r1_c1+sy*lRot.r2_c1);
-      pRot3D.wx = std::atan2(sy*lRot.r1_c3-cy*lRot.r2_c3, cy*lRot.r2_c2-sy*lRot.r1_c2);
+      pRot3D.wz = detail::atan2(lRot.r2_c1, lRot.r1_c1);
+      float sy, cy;
+      detail::sinCos(pRot3D.wz, sy, cy);
+      pRot3D.wy = detail::atan2(-lRot.r3_c1, cy*lRot.r1_c1+sy*lRot.r2_c1);
+      pRot3D.wx = detail::atan2(sy*lRot.r1_c3-cy*lRot.r2_c3, cy*lRot.r2_c2-sy*lRot.r1_c2);
     }
 
     Rotation3D rotation3DFromQuaternion(
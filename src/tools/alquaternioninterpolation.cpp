@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/tools/alquaternioninterpolation.h>
+#include <cmath>
+
+namespace AL {
+  namespace Math {
+
+    namespace {
+      // above this cosinus, slerp is replaced by nlerp: 1/sin(angle)
+      // would amplify the rounding errors.
+      const float kLinearCosThreshold = 0.9995f;
+
+      inline float xDot(const Quaternion& pQua1, const Quaternion& pQua2)
+      {
+        return pQua1.w*pQua2.w + pQua1.x*pQua2.x +
+            pQua1.y*pQua2.y + pQua1.z*pQua2.z;
+      }
+
+      // pA*pQua1 + pB*pQua2
+      inline Quaternion xCombine(
+        float             pA,
+        const Quaternion& pQua1,
+        float             pB,
+        const Quaternion& pQua2)
+      {
+        return Quaternion(pA*pQua1.w + pB*pQua2.w,
+                          pA*pQua1.x + pB*pQua2.x,
+                          pA*pQua1.y + pB*pQua2.y,
+                          pA*pQua1.z + pB*pQua2.z);
+      }
+
+      inline Quaternion xNlerp(
+        const Quaternion& pQua1,
+        const Quaternion& pQua2,
+        float             pT)
+      {
+        const Quaternion lQua = xCombine(1.0f - pT, pQua1, pT, pQua2);
+        return lQua * (1.0f / std::sqrt(xDot(lQua, lQua)));
+      }
+
+      void xInitSegment(
+        const Quaternion&       pQua1,
+        const Quaternion&       pQua2,
+        bool                    pShortestPath,
+        QuaternionSlerpSegment& pSegment)
+      {
+        float lCos = xDot(pQua1, pQua2);
+        pSegment.q1 = pQua1;
+        pSegment.q2 = pQua2;
+        if (pShortestPath && lCos < 0.0f)
+        {
+          pSegment.q2 *= -1.0f;
+          lCos = -lCos;
+        }
+        if (std::abs(lCos) > kLinearCosThreshold)
+        {
+          pSegment.angle = std::acos(lCos > 1.0f ? 1.0f :
+                                     (lCos < -1.0f ? -1.0f : lCos));
+          pSegment.inverseSinAngle = 0.0f;
+        }
+        else
+        {
+          pSegment.angle = std::acos(lCos);
+          pSegment.inverseSinAngle = 1.0f / std::sin(pSegment.angle);
+        }
+      }
+
+      // slerp which does not negate pQua2
+      Quaternion xSlerp(
+        const Quaternion& pQua1,
+        const Quaternion& pQua2,
+        float             pT)
+      {
+        QuaternionSlerpSegment lSegment;
+        xInitSegment(pQua1, pQua2, false, lSegment);
+        return lSegment.interpolate(pT);
+      }
+
+      // log of a unit Quaternion, as a pure Quaternion
+      Quaternion xLog(const Quaternion& pQua)
+      {
+        const float lSin = std::sqrt(pQua.x*pQua.x + pQua.y*pQua.y +
+                                     pQua.z*pQua.z);
+        if (lSin < 1e-7f)
+        {
+          return Quaternion(0.0f, pQua.x, pQua.y, pQua.z);
+        }
+        const float lScale = std::atan2(lSin, pQua.w) / lSin;
+        return Quaternion(0.0f, lScale*pQua.x, lScale*pQua.y, lScale*pQua.z);
+      }
+
+      // exp of a pure Quaternion
+      Quaternion xExp(const Quaternion& pQua)
+      {
+        const float lAngle = std::sqrt(pQua.x*pQua.x + pQua.y*pQua.y +
+                                       pQua.z*pQua.z);
+        if (lAngle < 1e-7f)
+        {
+          return Quaternion(1.0f, pQua.x, pQua.y, pQua.z);
+        }
+        const float lScale = std::sin(lAngle) / lAngle;
+        return Quaternion(std::cos(lAngle),
+                          lScale*pQua.x, lScale*pQua.y, lScale*pQua.z);
+      }
+
+      inline Quaternion xConjugate(const Quaternion& pQua)
+      {
+        return Quaternion(pQua.w, -pQua.x, -pQua.y, -pQua.z);
+      }
+
+      inline Quaternion xSameHemisphere(
+        const Quaternion& pReference,
+        const Quaternion& pQua)
+      {
+        return xDot(pReference, pQua) < 0.0f ? pQua * -1.0f : pQua;
+      }
+
+      // the sequence sin(a), sin(a + d), sin(a + 2d), ... computed with
+      // sin(a + d) = 2 cos(d) sin(a) - sin(a - d). The state is kept in
+      // double: the rounding errors of the recurrence accumulate.
+      class SinSequence
+      {
+      public:
+        SinSequence(double pA, double pD, double pTwoCosD)
+          : fPrevious(std::sin(pA - pD))
+          , fCurrent(std::sin(pA))
+          , fTwoCosD(pTwoCosD)
+        {}
+
+        double value() const
+        {
+          return fCurrent;
+        }
+
+        void next()
+        {
+          const double lNext = fTwoCosD*fCurrent - fPrevious;
+          fPrevious = fCurrent;
+          fCurrent = lNext;
+        }
+
+      private:
+        double fPrevious;
+        double fCurrent;
+        const double fTwoCosD;
+      };
+
+      // the samples of a slerp segment at pT0 + i*pDt
+      class SlerpSequence
+      {
+      public:
+        SlerpSequence(
+          const QuaternionSlerpSegment& pSegment,
+          float                         pT0,
+          float                         pDt)
+          : fSegment(pSegment)
+          , fT(pT0)
+          , fDt(pDt)
+          , fI(0u)
+          , fWeight1((1.0 - pT0)*pSegment.angle,
+                     -static_cast<double>(pDt)*pSegment.angle,
+                     2.0*std::cos(static_cast<double>(pDt)*pSegment.angle))
+          , fWeight2(static_cast<double>(pT0)*pSegment.angle,
+                     static_cast<double>(pDt)*pSegment.angle,
+                     2.0*std::cos(static_cast<double>(pDt)*pSegment.angle))
+        {}
+
+        Quaternion value() const
+        {
+          if (fSegment.inverseSinAngle == 0.0f)
+          {
+            return xNlerp(fSegment.q1, fSegment.q2, fT + fI*fDt);
+          }
+          return xCombine(
+                static_cast<float>(fWeight1.value())*fSegment.inverseSinAngle,
+                fSegment.q1,
+                static_cast<float>(fWeight2.value())*fSegment.inverseSinAngle,
+                fSegment.q2);
+        }
+
+        void next()
+        {
+          fWeight1.next();
+          fWeight2.next();
+          ++fI;
+        }
+
+      private:
+        const QuaternionSlerpSegment& fSegment;
+        const float fT;
+        const float fDt;
+        std::size_t fI;
+        SinSequence fWeight1;
+        SinSequence fWeight2;
+      };
+    } // anonymous namespace
+
+
+    Quaternion quaternionNlerp(
+      const Quaternion& pQua1,
+      const Quaternion& pQua2,
+      float             pT)
+    {
+      return xNlerp(pQua1, xSameHemisphere(pQua1, pQua2), pT);
+    }
+
+
+    Quaternion quaternionSlerp(
+      const Quaternion& pQua1,
+      const Quaternion& pQua2,
+      float             pT)
+    {
+      return QuaternionSlerpSegment(pQua1, pQua2).interpolate(pT);
+    }
+
+
+    void quaternionNlerp(
+      const Quaternion* pQua1,
+      const Quaternion* pQua2,
+      const float*      pT,
+      Quaternion*       pOut,
+      std::size_t       pSize)
+    {
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        pOut[i] = quaternionNlerp(pQua1[i], pQua2[i], pT[i]);
+      }
+    }
+
+
+    void quaternionSlerp(
+      const Quaternion* pQua1,
+      const Quaternion* pQua2,
+      const float*      pT,
+      Quaternion*       pOut,
+      std::size_t       pSize)
+    {
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        pOut[i] = quaternionSlerp(pQua1[i], pQua2[i], pT[i]);
+      }
+    }
+
+
+    Quaternion quaternionSquadControlPoint(
+      const Quaternion& pPrevious,
+      const Quaternion& pQua,
+      const Quaternion& pNext)
+    {
+      const Quaternion lInverse = xConjugate(pQua);
+      const Quaternion lLogNext =
+          xLog(lInverse * xSameHemisphere(pQua, pNext));
+      const Quaternion lLogPrevious =
+          xLog(lInverse * xSameHemisphere(pQua, pPrevious));
+      return pQua * xExp(xCombine(-0.25f, lLogNext, -0.25f, lLogPrevious));
+    }
+
+
+    Quaternion quaternionSquad(
+      const Quaternion& pQua1,
+      const Quaternion& pS1,
+      const Quaternion& pS2,
+      const Quaternion& pQua2,
+      float             pT)
+    {
+      return xSlerp(xSlerp(pQua1, pQua2, pT), xSlerp(pS1, pS2, pT),
+                    2.0f*pT*(1.0f - pT));
+    }
+
+
+    QuaternionSlerpSegment::QuaternionSlerpSegment()
+      : q1()
+      , q2()
+      , angle(0.0f)
+      , inverseSinAngle(0.0f)
+    {}
+
+
+    QuaternionSlerpSegment::QuaternionSlerpSegment(
+      const Quaternion& pQua1,
+      const Quaternion& pQua2)
+    {
+      xInitSegment(pQua1, pQua2, true, *this);
+    }
+
+
+    Quaternion QuaternionSlerpSegment::interpolate(float pT) const
+    {
+      if (inverseSinAngle == 0.0f)
+      {
+        return xNlerp(q1, q2, pT);
+      }
+      return xCombine(std::sin((1.0f - pT)*angle)*inverseSinAngle, q1,
+                      std::sin(pT*angle)*inverseSinAngle, q2);
+    }
+
+
+    QuaternionSquadSegment::QuaternionSquadSegment()
+    {}
+
+
+    QuaternionSquadSegment::QuaternionSquadSegment(
+      const Quaternion& pQua1,
+      const Quaternion& pS1,
+      const Quaternion& pS2,
+      const Quaternion& pQua2)
+    {
+      xInitSegment(pQua1, pQua2, false, keys);
+      xInitSegment(pS1, pS2, false, controls);
+    }
+
+
+    Quaternion QuaternionSquadSegment::interpolate(float pT) const
+    {
+      return xSlerp(keys.interpolate(pT), controls.interpolate(pT),
+                    2.0f*pT*(1.0f - pT));
+    }
+
+
+    void quaternionSlerpSegments(
+      const Quaternion*       pKeys,
+      std::size_t             pKeyCount,
+      QuaternionSlerpSegment* pSegments)
+    {
+      for (std::size_t i = 0u; i + 1u < pKeyCount; ++i)
+      {
+        pSegments[i] = QuaternionSlerpSegment(pKeys[i], pKeys[i+1u]);
+      }
+    }
+
+
+    void quaternionSquadSegments(
+      const Quaternion*       pKeys,
+      std::size_t             pKeyCount,
+      QuaternionSquadSegment* pSegments)
+    {
+      if (pKeyCount < 2u)
+      {
+        return;
+      }
+      // the keys brought to the hemisphere of their predecessor, and the
+      // control point of lCurrent.
+      Quaternion lPrevious = pKeys[0];
+      Quaternion lCurrent = pKeys[0];
+      Quaternion lNext = xSameHemisphere(lCurrent, pKeys[1]);
+      Quaternion lControl = lCurrent;
+      for (std::size_t i = 0u; i + 1u < pKeyCount; ++i)
+      {
+        lPrevious = lCurrent;
+        lCurrent = lNext;
+        Quaternion lNextControl = lCurrent;
+        if (i + 2u < pKeyCount)
+        {
+          lNext = xSameHemisphere(lCurrent, pKeys[i+2u]);
+          lNextControl = quaternionSquadControlPoint(lPrevious, lCurrent,
+                                                     lNext);
+        }
+        pSegments[i] = QuaternionSquadSegment(lPrevious, lControl,
+                                              lNextControl, lCurrent);
+        lControl = lNextControl;
+      }
+    }
+
+
+    void quaternionSlerpUniform(
+      const QuaternionSlerpSegment& pSegment,
+      float                         pT0,
+      float                         pDt,
+      std::size_t                   pCount,
+      Quaternion*                   pOut)
+    {
+      SlerpSequence lSlerp(pSegment, pT0, pDt);
+      for (std::size_t i = 0u; i < pCount; ++i)
+      {
+        pOut[i] = lSlerp.value();
+        lSlerp.next();
+      }
+    }
+
+
+    void quaternionSquadUniform(
+      const QuaternionSquadSegment& pSegment,
+      float                         pT0,
+      float                         pDt,
+      std::size_t                   pCount,
+      Quaternion*                   pOut)
+    {
+      SlerpSequence lKeys(pSegment.keys, pT0, pDt);
+      SlerpSequence lControls(pSegment.controls, pT0, pDt);
+      for (std::size_t i = 0u; i < pCount; ++i)
+      {
+        const float lT = pT0 + i*pDt;
+        pOut[i] = xSlerp(lKeys.value(), lControls.value(),
+                         2.0f*lT*(1.0f - lT));
+        lKeys.next();
+        lControls.next();
+      }
+    }
+
+  } // end namespace Math
+} // end namespace AL
@@ -4,13 +4,23 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/altransformhelpers.h
+#define ALMATH_BUILDING_OUT_OF_LINE
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <vector>
 
 #include <almath/tools/altransformhelpers.h>
+#include <almath/inline/altransformhelpers.h>
 #include <stdexcept>
 #include <almath/tools/altrigonometry.h>
 #include <almath/tools/almathio.h>
 #include <assert.h>
+#include "../kernels/transformkernels.h"
+#include "parallelfor.h"
+#include "trigonometry.h"
 
 namespace AL {
   namespace Math {
@@ -252,6 +262,404 @@ namespace AL {
     }
 
 
+    namespace
+    {
+      // the batched exponentials, logarithms and Jacobians: the angles,
+      // sines and cosines are computed by blocks with the kernels
+      const std::size_t SE3_BLOCK = 256u;
+      const std::size_t SE3_MIN_GRAIN = 4096u;
+      // below 0.5 rad (squared), the coefficients use their Taylor series
+      const float SE3_SERIES_THETA2 = 0.25f;
+      // above 2pi/3 (cos below -0.5), the logarithm takes the rotation axis
+      // from the symmetric part of the rotation
+      const float SE3_SYMMETRIC_COS = -0.5f;
+
+      // the coefficients of velocityExponential and of the Jacobians,
+      // functions of the angle t = |w|:
+      // sinc = sin(t)/t, a = (1-cos(t))/t^2, b = (t-sin(t))/t^3,
+      // and for the Jacobians c = (t^2/2+cos(t)-1)/t^4,
+      // d = (2t-3sin(t)+t*cos(t))/(2t^5) and, for their inverses,
+      // l = (1-t*sin(t)/(2(1-cos(t))))/t^2.
+      struct Se3Coefficients
+      {
+        float sinc;
+        float a;
+        float b;
+        float c;
+        float d;
+        float l;
+      };
+
+      // both the series and the direct formulas are computed, and one is
+      // selected: no branch. In the unused direct formulas, t is replaced
+      // by 1 so that they do not divide by 0.
+      inline void xCoefficients(
+        float            pT2,
+        float            pSin,
+        float            pCos,
+        bool             pJacobian,
+        Se3Coefficients& pCoef)
+      {
+        const bool lSeries = pT2 < SE3_SERIES_THETA2;
+        const float x = pT2;
+        const float t = lSeries ? 1.0f : std::sqrt(pT2);
+        const float s = lSeries ? 0.0f : pSin;
+        const float c = lSeries ? 0.0f : pCos;
+        const float lInvT = 1.0f/t;
+        const float lInvT2 = lInvT*lInvT;
+        // 1 - cos(t), without cancellation for cos(t) > 0
+        const float lOneMinusCos = c > 0.0f ? s*s/(1.0f + c) : 1.0f - c;
+
+        pCoef.sinc = lSeries ?
+              1.0f - x*(1.0f/6.0f - x*(1.0f/120.0f - x*(1.0f/5040.0f))) :
+              s*lInvT;
+        pCoef.a = lSeries ?
+              0.5f - x*(1.0f/24.0f - x*(1.0f/720.0f - x*(1.0f/40320.0f))) :
+              lOneMinusCos*lInvT2;
+        pCoef.b = lSeries ?
+              1.0f/6.0f - x*(1.0f/120.0f - x*(1.0f/5040.0f -
+                                               x*(1.0f/362880.0f))) :
+              (t - s)*lInvT2*lInvT;
+        if (!pJacobian)
+        {
+          return;
+        }
+        pCoef.c = lSeries ?
+              1.0f/24.0f - x*(1.0f/720.0f - x*(1.0f/40320.0f -
+                                                x*(1.0f/3628800.0f))) :
+              (0.5f*t*t - lOneMinusCos)*lInvT2*lInvT2;
+        pCoef.d = lSeries ?
+              1.0f/120.0f - x*(1.0f/2520.0f - x*(1.0f/120960.0f -
+                                                  x*(1.0f/9979200.0f))) :
+              0.5f*(2.0f*t - 3.0f*s + t*c)*lInvT2*lInvT2*lInvT;
+        pCoef.l = lSeries ?
+              1.0f/12.0f + x*(1.0f/720.0f + x*(1.0f/30240.0f +
+                                               x*(1.0f/1209600.0f))) :
+              (1.0f - 0.5f*t*s/lOneMinusCos)*lInvT2;
+      }
+
+      // call pFunction(i, t^2, sin(t), cos(t)), t = |w| of pVel[i], for i
+      // in [0, pSize), split across threads
+      template <typename F>
+      void xForEachRotationSinCos(
+          const Velocity6D* pVel,
+          std::size_t       pSize,
+          unsigned int      pMaxThreads,
+          F                 pFunction)
+      {
+        const detail::TransformKernels& lKernels = detail::transformKernels();
+        detail::parallelFor(pSize, pMaxThreads, SE3_MIN_GRAIN,
+                            [&](std::size_t pBegin, std::size_t pEnd)
+        {
+          float lT2[SE3_BLOCK];
+          float lT[SE3_BLOCK];
+          float lSin[SE3_BLOCK];
+          float lCos[SE3_BLOCK];
+          for (std::size_t b = pBegin; b < pEnd; b += SE3_BLOCK)
+          {
+            const std::size_t lCount = std::min(SE3_BLOCK, pEnd - b);
+            for (std::size_t i = 0u; i < lCount; ++i)
+            {
+              const Velocity6D& v = pVel[b + i];
+              lT2[i] = v.wxd*v.wxd + v.wyd*v.wyd + v.wzd*v.wzd;
+              lT[i] = std::sqrt(lT2[i]);
+            }
+            lKernels.sinCos(lT, lSin, lCos, lCount);
+            for (std::size_t i = 0u; i < lCount; ++i)
+            {
+              pFunction(b + i, lT2[i], lSin[i], lCos[i]);
+            }
+          }
+        });
+      }
+
+      // pOut = pA * pB, 3x3 row major
+      inline void xMultiply3(const float* pA, const float* pB, float* pOut)
+      {
+        for (int r = 0; r < 3; ++r)
+        {
+          for (int c = 0; c < 3; ++c)
+          {
+            pOut[3*r + c] = pA[3*r]*pB[c] + pA[3*r + 1]*pB[3 + c] +
+                pA[3*r + 2]*pB[6 + c];
+          }
+        }
+      }
+
+      inline void xSkew(float x, float y, float z, float* pOut)
+      {
+        pOut[0] = 0.0f; pOut[1] = -z;   pOut[2] = y;
+        pOut[3] = z;    pOut[4] = 0.0f; pOut[5] = -x;
+        pOut[6] = -y;   pOut[7] = x;    pOut[8] = 0.0f;
+      }
+
+      // the left Jacobian of velocityExponential at (p, w), or its
+      // inverse: [[J, Q], [0, J]] and [[J^-1, -J^-1 Q J^-1], [0, J^-1]],
+      // with J the left Jacobian of the rotation and Q the coupling term
+      // of T. Barfoot and P. Furgale, Associating Uncertainty With
+      // Three-Dimensional Poses for Use in Estimation Problems (2014).
+      // The right Jacobian at (p, w) is the left one at (-p, -w).
+      void xLeftJacobian(
+        const float*           p,
+        const float*           w,
+        const Se3Coefficients& pCoef,
+        bool                   pInverse,
+        float*                 pOut)
+      {
+        float W[9];
+        float P[9];
+        float WW[9];
+        float WP[9];
+        float PW[9];
+        float WPW[9];
+        float WWP[9];
+        float PWW[9];
+        float WPWW[9];
+        float WWPW[9];
+        xSkew(w[0], w[1], w[2], W);
+        xSkew(p[0], p[1], p[2], P);
+        xMultiply3(W, W, WW);
+        xMultiply3(W, P, WP);
+        xMultiply3(P, W, PW);
+        xMultiply3(WP, W, WPW);
+        xMultiply3(W, WP, WWP);
+        xMultiply3(PW, W, PWW);
+        xMultiply3(WPW, W, WPWW);
+        xMultiply3(W, WPW, WWPW);
+
+        float Q[9];
+        float J[9];
+        for (int i = 0; i < 9; ++i)
+        {
+          Q[i] = 0.5f*P[i] + pCoef.b*(WP[i] + PW[i] + WPW[i]) +
+              pCoef.c*(WWP[i] + PWW[i] - 3.0f*WPW[i]) +
+              pCoef.d*(WPWW[i] + WWPW[i]);
+          const float lIdentity = (i % 4 == 0) ? 1.0f : 0.0f;
+          J[i] = pInverse ? lIdentity - 0.5f*W[i] + pCoef.l*WW[i] :
+                            lIdentity + pCoef.a*W[i] + pCoef.b*WW[i];
+        }
+        if (pInverse)
+        {
+          float lTmp[9];
+          xMultiply3(J, Q, lTmp);
+          xMultiply3(lTmp, J, Q);
+          for (int i = 0; i < 9; ++i)
+          {
+            Q[i] = -Q[i];
+          }
+        }
+
+        for (int r = 0; r < 3; ++r)
+        {
+          for (int c = 0; c < 3; ++c)
+          {
+            pOut[6*r + c] = J[3*r + c];
+            pOut[6*r + c + 3] = Q[3*r + c];
+            pOut[6*(r + 3) + c] = 0.0f;
+            pOut[6*(r + 3) + c + 3] = J[3*r + c];
+          }
+        }
+      }
+
+      void xJacobians(
+        const Velocity6D* pVel,
+        float*            pJacobians,
+        std::size_t       pSize,
+        unsigned int      pMaxThreads,
+        bool              pRight,
+        bool              pInverse)
+      {
+        const float lSign = pRight ? -1.0f : 1.0f;
+        xForEachRotationSinCos(pVel, pSize, pMaxThreads,
+                               [&](std::size_t i, float t2, float sn, float cs)
+        {
+          const Velocity6D& v = pVel[i];
+          const float p[3] = {lSign*v.xd, lSign*v.yd, lSign*v.zd};
+          const float w[3] = {lSign*v.wxd, lSign*v.wyd, lSign*v.wzd};
+          Se3Coefficients lCoef;
+          xCoefficients(t2, sn, cs, true, lCoef);
+          xLeftJacobian(p, w, lCoef, pInverse, pJacobians + 36u*i);
+        });
+      }
+    } // anonymous namespace
+
+    void transformLogarithm(
+      const Transform* pT,
+      Velocity6D*      pVel,
+      std::size_t      pSize,
+      unsigned int     pMaxThreads)
+    {
+      const detail::TransformKernels& lKernels = detail::transformKernels();
+      detail::parallelFor(pSize, pMaxThreads, SE3_MIN_GRAIN,
+                          [&](std::size_t pBegin, std::size_t pEnd)
+      {
+        float lSin[SE3_BLOCK];
+        float lCos[SE3_BLOCK];
+        float lAngle[SE3_BLOCK];
+        for (std::size_t b = pBegin; b < pEnd; b += SE3_BLOCK)
+        {
+          const std::size_t lCount = std::min(SE3_BLOCK, pEnd - b);
+          for (std::size_t i = 0u; i < lCount; ++i)
+          {
+            const Transform& H = pT[b + i];
+            const float ax = H.r3_c2 - H.r2_c3;
+            const float ay = H.r1_c3 - H.r3_c1;
+            const float az = H.r2_c1 - H.r1_c2;
+            lSin[i] = 0.5f*std::sqrt(ax*ax + ay*ay + az*az);
+            lCos[i] = 0.5f*(H.r1_c1 + H.r2_c2 + H.r3_c3 - 1.0f);
+          }
+          lKernels.atan2(lSin, lCos, lAngle, lCount);
+          for (std::size_t i = 0u; i < lCount; ++i)
+          {
+            const Transform& H = pT[b + i];
+            const float si = lSin[i];
+            const float co = lCos[i];
+            const float t = lAngle[i];
+            const float x = t*t;
+            const bool lSeries = x < SE3_SERIES_THETA2;
+            // as in xCoefficients, no division by 0 in the unused formulas
+            const float lT = lSeries ? 1.0f : t;
+            const float lSi = lSeries ? 1.0f : si;
+
+            // w = t/(2 sin(t)) * (R - R^T)
+            const float ax = H.r3_c2 - H.r2_c3;
+            const float ay = H.r1_c3 - H.r3_c1;
+            const float az = H.r2_c1 - H.r1_c2;
+            const float lHalfTOverSin = lSeries ?
+                  0.5f + x*(1.0f/12.0f + x*(7.0f/720.0f +
+                                            x*(31.0f/30240.0f +
+                                               x*(127.0f/1209600.0f)))) :
+                  0.5f*lT/lSi;
+            float wx = lHalfTOverSin*ax;
+            float wy = lHalfTOverSin*ay;
+            float wz = lHalfTOverSin*az;
+
+            // near pi, sin(t) vanishes: (R + R^T)/2 - cos(t) I is
+            // (1 - cos(t)) u u^T, u the axis. Take its column of largest
+            // diagonal, and the sign of u from R - R^T.
+            const float m11 = H.r1_c1 - co;
+            const float m22 = H.r2_c2 - co;
+            const float m33 = H.r3_c3 - co;
+            const float m12 = 0.5f*(H.r1_c2 + H.r2_c1);
+            const float m13 = 0.5f*(H.r1_c3 + H.r3_c1);
+            const float m23 = 0.5f*(H.r2_c3 + H.r3_c2);
+            const bool l1 = (m11 >= m22) && (m11 >= m33);
+            const bool l2 = !l1 && (m22 >= m33);
+            const float ux = l1 ? m11 : (l2 ? m12 : m13);
+            const float uy = l1 ? m12 : (l2 ? m22 : m23);
+            const float uz = l1 ? m13 : (l2 ? m23 : m33);
+            const float lDiagonal = l1 ? m11 : (l2 ? m22 : m33);
+            const float lNorm = std::sqrt(std::max(lDiagonal*(1.0f - co),
+                                                   FLT_MIN));
+            const float lScale = ((ux*ax + uy*ay + uz*az) < 0.0f ? -t : t) /
+                lNorm;
+            const bool lSymmetric = co < SE3_SYMMETRIC_COS;
+            wx = lSymmetric ? lScale*ux : wx;
+            wy = lSymmetric ? lScale*uy : wy;
+            wz = lSymmetric ? lScale*uz : wz;
+
+            // p = J^-1 t = t - w x t / 2 + l w x (w x t)
+            const float lOneMinusCos = co > 0.0f ? lSi*lSi/(1.0f + co) :
+                                                   1.0f - co;
+            const float l = lSeries ?
+                  1.0f/12.0f + x*(1.0f/720.0f + x*(1.0f/30240.0f +
+                                                   x*(1.0f/1209600.0f))) :
+                  (1.0f - 0.5f*lT*lSi/lOneMinusCos)/(lT*lT);
+            const float tx = H.r1_c4;
+            const float ty = H.r2_c4;
+            const float tz = H.r3_c4;
+            const float cx = wy*tz - wz*ty;
+            const float cy = wz*tx - wx*tz;
+            const float cz = wx*ty - wy*tx;
+            Velocity6D& lOut = pVel[b + i];
+            lOut.xd = tx - 0.5f*cx + l*(wy*cz - wz*cy);
+            lOut.yd = ty - 0.5f*cy + l*(wz*cx - wx*cz);
+            lOut.zd = tz - 0.5f*cz + l*(wx*cy - wy*cx);
+            lOut.wxd = wx;
+            lOut.wyd = wy;
+            lOut.wzd = wz;
+          }
+        }
+      });
+    }
+
+    void velocityExponential(
+      const Velocity6D* pVel,
+      Transform*        pT,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads)
+    {
+      xForEachRotationSinCos(pVel, pSize, pMaxThreads,
+                             [&](std::size_t i, float t2, float sn, float cs)
+      {
+        const Velocity6D v = pVel[i];
+        Se3Coefficients lCoef;
+        xCoefficients(t2, sn, cs, false, lCoef);
+        const float SC = lCoef.sinc;
+        const float CC = lCoef.a;
+        const float dSC = lCoef.b;
+        Transform& tM = pT[i];
+
+        // see velocityExponentialInPlace
+        tM.r1_c1 = 1.0f - CC*(v.wzd*v.wzd + v.wyd*v.wyd);
+        tM.r1_c2 =   - SC*v.wzd  + CC*v.wxd*v.wyd;
+        tM.r1_c3 =     SC*v.wyd  + CC*v.wxd*v.wzd;
+        tM.r2_c1 =     SC*v.wzd  + CC*v.wxd*v.wyd;
+        tM.r2_c2 = 1.0f - CC*(v.wxd*v.wxd + v.wzd*v.wzd);
+        tM.r2_c3 =   - SC*v.wxd  + CC*v.wyd*v.wzd;
+        tM.r3_c1 =   - SC*v.wyd  + CC*v.wxd*v.wzd;
+        tM.r3_c2 =     SC*v.wxd  + CC*v.wyd*v.wzd;
+        tM.r3_c3 = 1.0f - CC*(v.wxd*v.wxd + v.wyd*v.wyd);
+
+        tM.r1_c4 = (SC + dSC*v.wxd*v.wxd)*v.xd +
+                   (-CC*v.wzd + dSC*v.wxd*v.wyd)*v.yd +
+                   (+CC*v.wyd + dSC*v.wxd*v.wzd)*v.zd;
+        tM.r2_c4 = (CC*v.wzd + dSC*v.wyd*v.wxd)*v.xd +
+                   (SC + dSC*v.wyd*v.wyd)*v.yd +
+                   (-CC*v.wxd + dSC*v.wyd*v.wzd)*v.zd;
+        tM.r3_c4 = (-CC*v.wyd + dSC*v.wzd*v.wxd)*v.xd +
+                   (CC*v.wxd + dSC*v.wzd*v.wyd)*v.yd +
+                   (SC + dSC*v.wzd*v.wzd)*v.zd;
+      });
+    }
+
+    void velocityExponentialLeftJacobian(
+      const Velocity6D* pVel,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads)
+    {
+      xJacobians(pVel, pJacobians, pSize, pMaxThreads, false, false);
+    }
+
+    void velocityExponentialRightJacobian(
+      const Velocity6D* pVel,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads)
+    {
+      xJacobians(pVel, pJacobians, pSize, pMaxThreads, true, false);
+    }
+
+    void transformLogarithmLeftJacobian(
+      const Velocity6D* pLog,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads)
+    {
+      xJacobians(pLog, pJacobians, pSize, pMaxThreads, false, true);
+    }
+
+    void transformLogarithmRightJacobian(
+      const Velocity6D* pLog,
+      float*            pJacobians,
+      std::size_t       pSize,
+      unsigned int      pMaxThreads)
+    {
+      xJacobians(pLog, pJacobians, pSize, pMaxThreads, true, true);
+    }
+
+
     void changeReferenceVelocity6D(
         const Transform&  pH,
         const Velocity6D& pVIn,
@@ -332,6 +740,138 @@ namespace AL {
     }
 
 
+    namespace {
+      // a thread rotates at least this number of points
+      const std::size_t CHANGE_REFERENCE_MIN_GRAIN = 32768u;
+
+      void xChangeReferencePositions(
+          const Transform& pH,
+          bool             pTranspose,
+          const float*     pXYZIn,
+          float*           pXYZOut,
+          std::size_t      pSize,
+          unsigned int     pMaxThreads)
+      {
+        float lR[9];
+        if (pTranspose)
+        {
+          const float lTmp[9] = {pH.r1_c1, pH.r2_c1, pH.r3_c1,
+                                 pH.r1_c2, pH.r2_c2, pH.r3_c2,
+                                 pH.r1_c3, pH.r2_c3, pH.r3_c3};
+          std::copy(lTmp, lTmp + 9, lR);
+        }
+        else
+        {
+          const float lTmp[9] = {pH.r1_c1, pH.r1_c2, pH.r1_c3,
+                                 pH.r2_c1, pH.r2_c2, pH.r2_c3,
+                                 pH.r3_c1, pH.r3_c2, pH.r3_c3};
+          std::copy(lTmp, lTmp + 9, lR);
+        }
+        const detail::TransformKernels& lKernels = detail::transformKernels();
+        detail::parallelFor(pSize, pMaxThreads, CHANGE_REFERENCE_MIN_GRAIN,
+                            [&](std::size_t pBegin, std::size_t pEnd)
+        {
+          lKernels.rotatePositions(lR, pXYZIn + 3u*pBegin,
+                                   pXYZOut + 3u*pBegin, pEnd - pBegin);
+        });
+      }
+
+      static_assert(sizeof(Position3D) == 3u*sizeof(float),
+                    "Position3D must be 3 packed floats");
+    } // anonymous namespace
+
+    void changeReferencePosition3D(
+        const Transform&  pH,
+        const Position3D* pPosIn,
+        Position3D*       pPosOut,
+        std::size_t       pSize,
+        unsigned int      pMaxThreads)
+    {
+      xChangeReferencePositions(pH, false,
+                                reinterpret_cast<const float*>(pPosIn),
+                                reinterpret_cast<float*>(pPosOut),
+                                pSize, pMaxThreads);
+    }
+
+
+    void changeReferencePosition3D(
+        const Transform& pH,
+        const float*     pXYZIn,
+        float*           pXYZOut,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      xChangeReferencePositions(pH, false, pXYZIn, pXYZOut,
+                                pSize, pMaxThreads);
+    }
+
+
+    void changeReferencePosition3DInPlace(
+        const Transform& pH,
+        Position3D*      pPos,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      changeReferencePosition3D(pH, pPos, pPos, pSize, pMaxThreads);
+    }
+
+
+    void changeReferencePosition3DInPlace(
+        const Transform& pH,
+        float*           pXYZ,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      changeReferencePosition3D(pH, pXYZ, pXYZ, pSize, pMaxThreads);
+    }
+
+
+    void changeReferenceTransposePosition3D(
+        const Transform&  pH,
+        const Position3D* pPosIn,
+        Position3D*       pPosOut,
+        std::size_t       pSize,
+        unsigned int      pMaxThreads)
+    {
+      xChangeReferencePositions(pH, true,
+                                reinterpret_cast<const float*>(pPosIn),
+                                reinterpret_cast<float*>(pPosOut),
+                                pSize, pMaxThreads);
+    }
+
+
+    void changeReferenceTransposePosition3D(
+        const Transform& pH,
+        const float*     pXYZIn,
+        float*           pXYZOut,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      xChangeReferencePositions(pH, true, pXYZIn, pXYZOut,
+                                pSize, pMaxThreads);
+    }
+
+
+    void changeReferenceTransposePosition3DInPlace(
+        const Transform& pH,
+        Position3D*      pPos,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      changeReferenceTransposePosition3D(pH, pPos, pPos, pSize, pMaxThreads);
+    }
+
+
+    void changeReferenceTransposePosition3DInPlace(
+        const Transform& pH,
+        float*           pXYZ,
+        std::size_t      pSize,
+        unsigned int     pMaxThreads)
+    {
+      changeReferenceTransposePosition3D(pH, pXYZ, pXYZ, pSize, pMaxThreads);
+    }
+
+
     void changeReferenceTransform(
         const AL::Math::Transform&  pH,
         const AL::Math::Transform&  pHIn,
@@ -437,6 +977,427 @@ namespace AL {
     }
 
 
+    namespace {
+      // the unit quaternion (w, x, y, z) of the rotation of pT, in double.
+      // Shepperd's method: the square root is taken on the largest of the
+      // four diagonal combinations, which keeps full precision near the
+      // identity and near half turns.
+      void xQuaternionFromRotation(const Transform& pT, double* pQ)
+      {
+        const double r11 = pT.r1_c1;
+        const double r22 = pT.r2_c2;
+        const double r33 = pT.r3_c3;
+        const double lTrace = r11 + r22 + r33;
+        if (lTrace >= r11 && lTrace >= r22 && lTrace >= r33)
+        {
+          const double s = 2.0*std::sqrt(std::max(1.0 + lTrace, 0.0));
+          pQ[0] = 0.25*s;
+          pQ[1] = (pT.r3_c2 - pT.r2_c3) / s;
+          pQ[2] = (pT.r1_c3 - pT.r3_c1) / s;
+          pQ[3] = (pT.r2_c1 - pT.r1_c2) / s;
+        }
+        else if (r11 >= r22 && r11 >= r33)
+        {
+          const double s = 2.0*std::sqrt(std::max(1.0 + r11 - r22 - r33, 0.0));
+          pQ[0] = (pT.r3_c2 - pT.r2_c3) / s;
+          pQ[1] = 0.25*s;
+          pQ[2] = (pT.r1_c2 + pT.r2_c1) / s;
+          pQ[3] = (pT.r1_c3 + pT.r3_c1) / s;
+        }
+        else if (r22 >= r33)
+        {
+          const double s = 2.0*std::sqrt(std::max(1.0 + r22 - r11 - r33, 0.0));
+          pQ[0] = (pT.r1_c3 - pT.r3_c1) / s;
+          pQ[1] = (pT.r1_c2 + pT.r2_c1) / s;
+          pQ[2] = 0.25*s;
+          pQ[3] = (pT.r2_c3 + pT.r3_c2) / s;
+        }
+        else
+        {
+          const double s = 2.0*std::sqrt(std::max(1.0 + r33 - r11 - r22, 0.0));
+          pQ[0] = (pT.r2_c1 - pT.r1_c2) / s;
+          pQ[1] = (pT.r1_c3 + pT.r3_c1) / s;
+          pQ[2] = (pT.r2_c3 + pT.r3_c2) / s;
+          pQ[3] = 0.25*s;
+        }
+      }
+    }
+
+
+    TransformMeanAccumulator::TransformMeanAccumulator()
+    {
+      reset();
+    }
+
+
+    void TransformMeanAccumulator::add(
+        const Transform& pT,
+        float            pWeight)
+    {
+      if (!(pWeight > 0.0f))
+      {
+        throw std::runtime_error(
+            "ALMath: TransformMeanAccumulator::add weight must be positive.");
+      }
+      // in the hemisphere of the current sum, which is null when empty
+      double lQuaternion[4];
+      xQuaternionFromRotation(pT, lQuaternion);
+      const bool lNegated = lQuaternion[0]*fQuaternionSum[0] +
+          lQuaternion[1]*fQuaternionSum[1] +
+          lQuaternion[2]*fQuaternionSum[2] +
+          lQuaternion[3]*fQuaternionSum[3] < 0.0;
+      const Sample lSample = {pT, pWeight, lNegated};
+      fSamples.push_back(lSample);
+      const double lWeight = pWeight;
+      const double lQuaternionWeight = lNegated ? -lWeight : lWeight;
+      for (int i = 0; i < 4; ++i)
+      {
+        fQuaternionSum[i] += lQuaternionWeight*lQuaternion[i];
+      }
+      fTranslationSum[0] += lWeight*pT.r1_c4;
+      fTranslationSum[1] += lWeight*pT.r2_c4;
+      fTranslationSum[2] += lWeight*pT.r3_c4;
+      fWeightSum += lWeight;
+    }
+
+
+    void TransformMeanAccumulator::remove()
+    {
+      if (fSamples.empty())
+      {
+        throw std::runtime_error(
+            "ALMath: TransformMeanAccumulator::remove on an empty accumulator.");
+      }
+      if (fSamples.size() == 1u)
+      {
+        // no rounding residue left once the window is empty
+        reset();
+        return;
+      }
+      // the very values which were added
+      const Sample& lSample = fSamples.front();
+      const Transform& lT = lSample.transform;
+      double lQuaternion[4];
+      xQuaternionFromRotation(lT, lQuaternion);
+      const double lWeight = lSample.weight;
+      const double lQuaternionWeight = lSample.negated ? -lWeight : lWeight;
+      for (int i = 0; i < 4; ++i)
+      {
+        fQuaternionSum[i] -= lQuaternionWeight*lQuaternion[i];
+      }
+      fTranslationSum[0] -= lWeight*lT.r1_c4;
+      fTranslationSum[1] -= lWeight*lT.r2_c4;
+      fTranslationSum[2] -= lWeight*lT.r3_c4;
+      fWeightSum -= lWeight;
+      fSamples.pop_front();
+    }
+
+
+    void TransformMeanAccumulator::remove(
+        const Transform& pT,
+        float            pWeight)
+    {
+      if (!fSamples.empty() &&
+          (fSamples.front().weight != pWeight ||
+           !fSamples.front().transform.isNear(pT, 0.0f)))
+      {
+        throw std::runtime_error(
+            "ALMath: TransformMeanAccumulator::remove of a sample which is "
+            "not the oldest one.");
+      }
+      remove();
+    }
+
+
+    void TransformMeanAccumulator::reset()
+    {
+      fSamples.clear();
+      for (int i = 0; i < 4; ++i)
+      {
+        fQuaternionSum[i] = 0.0;
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+        fTranslationSum[i] = 0.0;
+      }
+      fWeightSum = 0.0;
+    }
+
+
+    std::size_t TransformMeanAccumulator::count() const
+    {
+      return fSamples.size();
+    }
+
+
+    float TransformMeanAccumulator::weightSum() const
+    {
+      return static_cast<float>(fWeightSum);
+    }
+
+
+    Transform TransformMeanAccumulator::mean() const
+    {
+      if (fSamples.empty())
+      {
+        throw std::runtime_error(
+            "ALMath: TransformMeanAccumulator::mean on an empty accumulator.");
+      }
+      const double lNorm = std::sqrt(
+            fQuaternionSum[0]*fQuaternionSum[0] +
+            fQuaternionSum[1]*fQuaternionSum[1] +
+            fQuaternionSum[2]*fQuaternionSum[2] +
+            fQuaternionSum[3]*fQuaternionSum[3]);
+      Transform lT = transformFromQuaternion(
+            Quaternion(static_cast<float>(fQuaternionSum[0] / lNorm),
+                       static_cast<float>(fQuaternionSum[1] / lNorm),
+                       static_cast<float>(fQuaternionSum[2] / lNorm),
+                       static_cast<float>(fQuaternionSum[3] / lNorm)));
+      lT.r1_c4 = static_cast<float>(fTranslationSum[0] / fWeightSum);
+      lT.r2_c4 = static_cast<float>(fTranslationSum[1] / fWeightSum);
+      lT.r3_c4 = static_cast<float>(fTranslationSum[2] / fWeightSum);
+      return lT;
+    }
+
+
+    namespace {
+      // the samples are reduced by blocks of this size, in a fixed order, so
+      // that the result does not depend on the number of threads
+      const std::size_t ROBUST_MEAN_BLOCK = 1024u;
+      // a thread reduces at least this number of blocks
+      const std::size_t ROBUST_MEAN_MIN_BLOCKS = 4u;
+
+      // the mean being estimated: unit quaternion and translation
+      struct RobustMeanEstimate
+      {
+        double q[4];
+        double t[3];
+      };
+
+      // weighted sums of the quaternions (aligned with the estimate), of
+      // the translations, and of the weights
+      struct RobustMeanSums
+      {
+        double q[4];
+        double t[3];
+        double w;
+      };
+
+      // distance between the sample i and the estimate, see
+      // transformRobustMean
+      double xRobustDistance(
+          const RobustMeanEstimate& pEstimate,
+          const Transform&          pT,
+          const double*             pQ,
+          double                    pLength,
+          double*                   pAligned)
+      {
+        const double lDot = pQ[0]*pEstimate.q[0] + pQ[1]*pEstimate.q[1] +
+            pQ[2]*pEstimate.q[2] + pQ[3]*pEstimate.q[3];
+        const double lSign = (lDot < 0.0) ? -1.0 : 1.0;
+        double lChord2 = 0.0;
+        for (int k = 0; k < 4; ++k)
+        {
+          pAligned[k] = lSign*pQ[k];
+          const double d = pAligned[k] - pEstimate.q[k];
+          lChord2 += d*d;
+        }
+        // the chord between the unit quaternions is 2 sin(angle / 4)
+        const double lAngle = 4.0*std::asin(std::min(0.5*std::sqrt(lChord2),
+                                                     1.0));
+        const double dx = pT.r1_c4 - pEstimate.t[0];
+        const double dy = pT.r2_c4 - pEstimate.t[1];
+        const double dz = pT.r3_c4 - pEstimate.t[2];
+        const double lRotation = pLength*lAngle;
+        return std::sqrt(dx*dx + dy*dy + dz*dz + lRotation*lRotation);
+      }
+
+      // the weight of a sample at pDistance from the estimate
+      double xRobustWeight(double pDistance, double pThreshold)
+      {
+        if (pThreshold > 0.0)
+        {
+          return (pDistance <= pThreshold) ? 1.0 : pThreshold / pDistance;
+        }
+        // Weiszfeld: the weight of a sample on the estimate is bounded
+        return 1.0 / std::max(pDistance, 1e-12);
+      }
+
+      // move pEstimate to the weighted mean of pSums, return the move
+      double xRobustUpdate(
+          const RobustMeanSums& pSums,
+          double                pLength,
+          RobustMeanEstimate&   pEstimate)
+      {
+        const double lNorm = std::sqrt(pSums.q[0]*pSums.q[0] +
+                                       pSums.q[1]*pSums.q[1] +
+                                       pSums.q[2]*pSums.q[2] +
+                                       pSums.q[3]*pSums.q[3]);
+        double lChord2 = 0.0;
+        for (int k = 0; k < 4; ++k)
+        {
+          const double q = pSums.q[k] / lNorm;
+          lChord2 += (q - pEstimate.q[k])*(q - pEstimate.q[k]);
+          pEstimate.q[k] = q;
+        }
+        double lMove2 = 0.0;
+        for (int k = 0; k < 3; ++k)
+        {
+          const double t = pSums.t[k] / pSums.w;
+          lMove2 += (t - pEstimate.t[k])*(t - pEstimate.t[k]);
+          pEstimate.t[k] = t;
+        }
+        const double lRotation =
+            pLength*4.0*std::asin(std::min(0.5*std::sqrt(lChord2), 1.0));
+        return std::sqrt(lMove2 + lRotation*lRotation);
+      }
+    }
+
+
+    Transform transformRobustMean(
+        const Transform* pTransforms,
+        std::size_t      pSize,
+        float            pThreshold,
+        float            pLength,
+        unsigned int     pMaxIterations,
+        float            pTolerance,
+        float*           pWeights,
+        unsigned int     pMaxThreads)
+    {
+      if (pSize == 0u)
+      {
+        throw std::runtime_error(
+            "ALMath: transformRobustMean on an empty array.");
+      }
+      if (!(pThreshold >= 0.0f))
+      {
+        throw std::runtime_error(
+            "ALMath: transformRobustMean threshold must be positive or null.");
+      }
+
+      const double lThreshold = pThreshold;
+      const double lLength = pLength;
+      std::vector<double> lQuaternions(4u*pSize);
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        xQuaternionFromRotation(pTransforms[i], &lQuaternions[4u*i]);
+      }
+
+      // first estimate: the plain mean, aligned with the first sample
+      RobustMeanEstimate lEstimate;
+      RobustMeanSums lSums = RobustMeanSums();
+      for (int k = 0; k < 4; ++k)
+      {
+        lEstimate.q[k] = lQuaternions[k];
+      }
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        const double* q = &lQuaternions[4u*i];
+        const double lSign = (q[0]*lEstimate.q[0] + q[1]*lEstimate.q[1] +
+            q[2]*lEstimate.q[2] + q[3]*lEstimate.q[3] < 0.0) ? -1.0 : 1.0;
+        for (int k = 0; k < 4; ++k)
+        {
+          lSums.q[k] += lSign*q[k];
+        }
+        lSums.t[0] += pTransforms[i].r1_c4;
+        lSums.t[1] += pTransforms[i].r2_c4;
+        lSums.t[2] += pTransforms[i].r3_c4;
+      }
+      lSums.w = static_cast<double>(pSize);
+      for (int k = 0; k < 3; ++k)
+      {
+        lEstimate.t[k] = 0.0;
+      }
+      xRobustUpdate(lSums, lLength, lEstimate);
+
+      const std::size_t lBlocks =
+          (pSize + ROBUST_MEAN_BLOCK - 1u) / ROBUST_MEAN_BLOCK;
+      std::vector<RobustMeanSums> lBlockSums(lBlocks);
+      for (unsigned int lIteration = 0u; lIteration < pMaxIterations;
+           ++lIteration)
+      {
+        detail::parallelFor(lBlocks, pMaxThreads, ROBUST_MEAN_MIN_BLOCKS,
+                            [&](std::size_t pBegin, std::size_t pEnd)
+        {
+          for (std::size_t b = pBegin; b < pEnd; ++b)
+          {
+            RobustMeanSums lBlock = RobustMeanSums();
+            const std::size_t lEnd =
+                std::min(pSize, (b + 1u)*ROBUST_MEAN_BLOCK);
+            for (std::size_t i = b*ROBUST_MEAN_BLOCK; i < lEnd; ++i)
+            {
+              double lAligned[4];
+              const double lWeight = xRobustWeight(
+                    xRobustDistance(lEstimate, pTransforms[i],
+                                    &lQuaternions[4u*i], lLength, lAligned),
+                    lThreshold);
+              for (int k = 0; k < 4; ++k)
+              {
+                lBlock.q[k] += lWeight*lAligned[k];
+              }
+              lBlock.t[0] += lWeight*pTransforms[i].r1_c4;
+              lBlock.t[1] += lWeight*pTransforms[i].r2_c4;
+              lBlock.t[2] += lWeight*pTransforms[i].r3_c4;
+              lBlock.w += lWeight;
+            }
+            lBlockSums[b] = lBlock;
+          }
+        });
+
+        lSums = RobustMeanSums();
+        for (std::size_t b = 0u; b < lBlocks; ++b)
+        {
+          for (int k = 0; k < 4; ++k)
+          {
+            lSums.q[k] += lBlockSums[b].q[k];
+          }
+          for (int k = 0; k < 3; ++k)
+          {
+            lSums.t[k] += lBlockSums[b].t[k];
+          }
+          lSums.w += lBlockSums[b].w;
+        }
+        if (xRobustUpdate(lSums, lLength, lEstimate) < pTolerance)
+        {
+          break;
+        }
+      }
+
+      if (pWeights != NULL)
+      {
+        double lMaxWeight = 0.0;
+        for (std::size_t i = 0u; i < pSize; ++i)
+        {
+          double lAligned[4];
+          const double lWeight = xRobustWeight(
+                xRobustDistance(lEstimate, pTransforms[i],
+                                &lQuaternions[4u*i], lLength, lAligned),
+                lThreshold);
+          pWeights[i] = static_cast<float>(lWeight);
+          lMaxWeight = std::max(lMaxWeight, lWeight);
+        }
+        if (lThreshold == 0.0)
+        {
+          // Weiszfeld weights are only relative: scale them to [0, 1]
+          for (std::size_t i = 0u; i < pSize; ++i)
+          {
+            pWeights[i] = static_cast<float>(pWeights[i] / lMaxWeight);
+          }
+        }
+      }
+
+      Transform lT = transformFromQuaternion(
+            Quaternion(static_cast<float>(lEstimate.q[0]),
+                       static_cast<float>(lEstimate.q[1]),
+                       static_cast<float>(lEstimate.q[2]),
+                       static_cast<float>(lEstimate.q[3])));
+      lT.r1_c4 = static_cast<float>(lEstimate.t[0]);
+      lT.r2_c4 = static_cast<float>(lEstimate.t[1]);
+      lT.r3_c4 = static_cast<float>(lEstimate.t[2]);
+      return lT;
+    }
+
+
     void transformFromPosition3DInPlace(
         const Position3D& pPosition,
         Transform&        pTransform)
@@ -514,11 +1475,11 @@ namespace AL {
       pPos.x = pT.r1_c4;
       pPos.y = pT.r2_c4;
       pPos.z = pT.r3_c4;
-      pPos.wz = std::atan2(pT.r2_c1, pT.r1_c1);
-      const float sy = std::sin(pPos.wz);
-      const float cy = std::cos(pPos.wz);
-      pPos.wy = std::atan2(-pT.r3_c1, cy*pT.r1_c1+sy*pT.r2_c1);
-      pPos.wx = std::atan2(sy*pT.r1_c3-cy*pT.r2_c3, cy*pT.r2_c2-sy*pT.r1_c2);
+      pPos.wz = detail::atan2(pT.r2_c1, pT.r1_c1);
+      float sy, cy;
+      detail::sinCos(pPos.wz, sy, cy);
+      pPos.wy = detail::atan2(-pT.r3_c1, cy*pT.r1_c1+sy*pT.r2_c1);
+      pPos.wx = detail::atan2(sy*pT.r1_c3-cy*pT.r2_c3, cy*pT.r2_c2-sy*pT.r1_c2);
     }
 
 
@@ -568,7 +1529,7 @@ namespace AL {
     {
       pPos.x = pT.r1_c4;
       pPos.y = pT.r2_c4;
-      pPos.theta = std::atan2(pT.r2_c1, pT.r1_c1);
+      pPos.theta = detail::atan2(pT.r2_c1, pT.r1_c1);
     }
 
 
@@ -654,11 +1615,11 @@ namespace AL {
     Rotation3D rotation3DFromTransform(const Transform& pT)
     {
       Rotation3D R;
-      R.wz = std::atan2(pT.r2_c1,pT.r1_c1);
-      const float sy = std::sin(R.wz);
-      const float cy = std::cos(R.wz);
-      R.wy = std::atan2(-pT.r3_c1, cy*pT.r1_c1+sy*pT.r2_c1);
-      R.wx = std::atan2(sy*pT.r1_c3-cy*pT.r2_c3, cy*pT.r2_c2-sy*pT.r1_c2);
+      R.wz = detail::atan2(pT.r2_c1,pT.r1_c1);
+      float sy, cy;
+      detail::sinCos(R.wz, sy, cy);
+      R.wy = detail::atan2(-pT.r3_c1, cy*pT.r1_c1+sy*pT.r2_c1);
+      R.wx = detail::atan2(sy*pT.r1_c3-cy*pT.r2_c3, cy*pT.r2_c2-sy*pT.r1_c2);
       return R;
     }
 
@@ -666,11 +1627,11 @@ namespace AL {
     Rotation3D rotation3DFromRotation(const Rotation& pR)
     {
       Rotation3D R;
-      R.wz = std::atan2(pR.r2_c1,pR.r1_c1);
-      const float sy = std::sin(R.wz);
-      const float cy = std::cos(R.wz);
-      R.wy = std::atan2(-pR.r3_c1, cy*pR.r1_c1+sy*pR.r2_c1);
-      R.wx = std::atan2(sy*pR.r1_c3-cy*pR.r2_c3, cy*pR.r2_c2-sy*pR.r1_c2);
+      R.wz = detail::atan2(pR.r2_c1,pR.r1_c1);
+      float sy, cy;
+      detail::sinCos(R.wz, sy, cy);
+      R.wy = detail::atan2(-pR.r3_c1, cy*pR.r1_c1+sy*pR.r2_c1);
+      R.wx = detail::atan2(sy*pR.r1_c3-cy*pR.r2_c3, cy*pR.r2_c2-sy*pR.r1_c2);
       return R;
     }
 
@@ -730,30 +1691,6 @@ namespace AL {
       pOut.r3_c3 = pZ.z;
       return pOut;
     }
-    Position3D operator*(
-        const Transform& pT,
-        const Position2D&  pPos)
-    {
-      Position3D result;
-      result.x = (pT.r1_c1 * pPos.x) + (pT.r1_c2 * pPos.y) + pT.r1_c4;
-      result.y = (pT.r2_c1 * pPos.x) + (pT.r2_c2 * pPos.y) + pT.r2_c4;
-      result.z = (pT.r3_c1 * pPos.x) + (pT.r3_c2 * pPos.y) + pT.r3_c4;
-      return result;
-    }
-
-
-    Position3D operator*(
-        const Transform& pT,
-        const Position3D&  pPos)
-    {
-      Position3D result;
-      result.x = (pT.r1_c1 * pPos.x) + (pT.r1_c2 * pPos.y) + (pT.r1_c3 * pPos.z) + pT.r1_c4;
-      result.y = (pT.r2_c1 * pPos.x) + (pT.r2_c2 * pPos.y) + (pT.r2_c3 * pPos.z) + pT.r2_c4;
-      result.z = (pT.r3_c1 * pPos.x) + (pT.r3_c2 * pPos.y) + (pT.r3_c3 * pPos.z) + pT.r3_c4;
-      return result;
-    }
-
-
     Transform axisRotationProjection(
         const Position3D& pAxis,
         const Transform&  pT)
@@ -829,14 +1766,14 @@ namespace AL {
         return;
       }
 
-      const float alpha  = std::atan2(b, a);
+      const float alpha  = detail::atan2(b, a);
       const float beta   = std::acos( c / std::sqrt( a*a + b*b ) );
 
-      const float cos_1 = 1.0f - std::cos( alpha + beta );
-      const float cos_2 = 1.0f - std::cos( alpha - beta );
+      const float cos_1 = 1.0f - detail::cos( alpha + beta );
+      const float cos_2 = 1.0f - detail::cos( alpha - beta );
 
-      const float sin_1 = std::sin( alpha + beta );
-      const float sin_2 = std::sin( alpha - beta );
+      const float sin_1 = detail::sin( alpha + beta );
+      const float sin_2 = detail::sin( alpha - beta );
 
       const float trace_1 = pRot.r1_c1*( cos_1*( - z_2 - y_2 ) + 1.0f ) +
                       pRot.r2_c2*( cos_1*( - z_2 - x_2 ) + 1.0f ) +
@@ -932,14 +1869,14 @@ namespace AL {
         return;
       }
 
-      const float alpha  = std::atan2(b, a);
+      const float alpha  = detail::atan2(b, a);
       const float beta   = std::acos(c / std::sqrt(a*a + b*b));
 
-      const float cos_1 = 1.0f - std::cos(alpha + beta);
-      const float cos_2 = 1.0f - std::cos(alpha - beta);
+      const float cos_1 = 1.0f - detail::cos(alpha + beta);
+      const float cos_2 = 1.0f - detail::cos(alpha - beta);
 
-      const float sin_1 = std::sin(alpha + beta);
-      const float sin_2 = std::sin(alpha - beta);
+      const float sin_1 = detail::sin(alpha + beta);
+      const float sin_2 = detail::sin(alpha - beta);
 
       const float trace_1 =
           pH.r1_c1*(cos_1*( - z_2 - y_2) + 1.0f) +
@@ -1001,8 +1938,8 @@ namespace AL {
       // Usefull initialization
       pT = AL::Math::Transform();
 
-      const float c = std::cos(pTheta);
-      const float s = std::sin(pTheta);
+      float s, c;
+      detail::sinCos(pTheta, s, c);
 
       pT.r1_c4 = pM.x;
       pT.r2_c4 = pM.y;
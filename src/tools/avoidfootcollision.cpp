@@ -6,6 +6,7 @@
 
 #include <almath/tools/avoidfootcollision.h>
 #include <almath/tools/almath.h>
+#include "trigonometry.h"
 #include <cmath>
 
 namespace AL
@@ -299,11 +300,11 @@ namespace AL
       {
         // we have to clip pMove
         // compute angle
-        const float theta = std::atan2(pMove.y, pMove.x);
+        const float theta = detail::atan2(pMove.y, pMove.x);
 
         // then compute polar equation
-        const float cosTheta = std::cos(theta);
-        const float sinTheta = std::sin(theta);
+        float sinTheta, cosTheta;
+        detail::sinCos(theta, sinTheta, cosTheta);
         const float t = (a*b)/(std::sqrt(b2*cosTheta*cosTheta + a2*sinTheta*sinTheta) );
 
         // finally compute new pMove
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Private header: report the errors of alerrorpolicy.h.
+// The messages are only built when the policy of the calling thread needs
+// them: with ERROR_POLICY_IGNORE, reporting an error is an atomic
+// increment.
+
+#pragma once
+#ifndef _LIBALMATH_SRC_TOOLS_ERRORPOLICY_H_
+#define _LIBALMATH_SRC_TOOLS_ERRORPOLICY_H_
+
+#include <almath/tools/alerrorpolicy.h>
+#include <cstddef>
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      // Count an error, without reporting it.
+      void countError(ErrorKind pKind);
+
+      // Count an error and report pMessage, for instance
+      // "normalizeRotation with null column. Rotation part set to identity."
+      void reportError(ErrorKind pKind, const char* pMessage);
+
+      // Count and report an ERROR_WRONG_SIZE:
+      // "<pCall> call with a wrong size of vector. Size expected: <pExpected>.
+      // Size given: <pSize>. <pResult>"
+      void reportWrongSize(const char* pCall,
+                           const char* pExpected,
+                           std::size_t pSize,
+                           const char* pResult);
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+
+#endif  // _LIBALMATH_SRC_TOOLS_ERRORPOLICY_H_
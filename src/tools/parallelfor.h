@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Private header: split a loop across threads.
+
+#pragma once
+#ifndef _LIBALMATH_SRC_TOOLS_PARALLELFOR_H_
+#define _LIBALMATH_SRC_TOOLS_PARALLELFOR_H_
+
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      // Return the number of threads to use for pSize elements, given that
+      // a thread should process at least pMinGrain elements.
+      // pMaxThreads == 0 means one thread per hardware thread.
+      inline unsigned int parallelThreads(
+        std::size_t  pSize,
+        unsigned int pMaxThreads,
+        std::size_t  pMinGrain)
+      {
+        unsigned int lMaxThreads = pMaxThreads;
+        if (lMaxThreads == 0u)
+        {
+          // hardware_concurrency reads the system configuration: cache it.
+          static const unsigned int lHardwareThreads =
+              std::thread::hardware_concurrency();
+          lMaxThreads = lHardwareThreads;
+        }
+        const std::size_t lByGrain = pMinGrain > 0u ? pSize / pMinGrain : pSize;
+        if (lByGrain < lMaxThreads)
+        {
+          lMaxThreads = static_cast<unsigned int>(lByGrain);
+        }
+        return lMaxThreads > 0u ? lMaxThreads : 1u;
+      }
+
+      // Join the started workers when it goes out of scope, so that a
+      // std::thread is never destroyed joinable, even on an exception.
+      class WorkersJoiner
+      {
+      public:
+        explicit WorkersJoiner(std::vector<std::thread>& pWorkers)
+          : fWorkers(pWorkers)
+        {}
+
+        WorkersJoiner(const WorkersJoiner&) = delete;
+        WorkersJoiner& operator=(const WorkersJoiner&) = delete;
+
+        ~WorkersJoiner()
+        {
+          for (std::size_t t = 0u; t < fWorkers.size(); ++t)
+          {
+            if (fWorkers[t].joinable())
+            {
+              fWorkers[t].join();
+            }
+          }
+        }
+
+      private:
+        std::vector<std::thread>& fWorkers;
+      };
+
+      // Call pFunction(begin, end) on contiguous chunks which cover
+      // [0, pSize). The chunks are processed in parallel, the last one by
+      // the calling thread. When a thread cannot be started, the calling
+      // thread processes its chunk. The workers are joined before an
+      // exception leaves the function, but pFunction should not throw: an
+      // exception in a worker calls std::terminate.
+      template <typename F>
+      void parallelFor(
+        std::size_t  pSize,
+        unsigned int pMaxThreads,
+        std::size_t  pMinGrain,
+        F            pFunction)
+      {
+        const unsigned int lThreads =
+            parallelThreads(pSize, pMaxThreads, pMinGrain);
+        if (lThreads <= 1u)
+        {
+          pFunction(std::size_t(0u), pSize);
+          return;
+        }
+        std::vector<std::thread> lWorkers;
+        lWorkers.reserve(lThreads - 1u);
+        const WorkersJoiner lJoiner(lWorkers);
+        const std::size_t lChunk = pSize / lThreads;
+        std::size_t lBegin = 0u;
+        for (unsigned int t = 0u; t + 1u < lThreads; ++t)
+        {
+          const std::size_t lEnd = lBegin + lChunk;
+          try
+          {
+            // reserved: push_back does not throw
+            lWorkers.push_back(std::thread(pFunction, lBegin, lEnd));
+          }
+          catch (const std::system_error&)
+          {
+            pFunction(lBegin, lEnd);
+          }
+          lBegin = lEnd;
+        }
+        pFunction(lBegin, pSize);
+      }
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_SRC_TOOLS_PARALLELFOR_H_
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// Private header: the trigonometry used inside the library.
+// With the ALMATH_FAST_TRIGONOMETRY build option, it goes through the
+// polynomials of alfastmath.h instead of the standard library.
+
+#pragma once
+#ifndef _LIBALMATH_SRC_TOOLS_TRIGONOMETRY_H_
+#define _LIBALMATH_SRC_TOOLS_TRIGONOMETRY_H_
+
+#include <almath/tools/alfastmath.h>
+#include "../kernels/transformkernels.h"
+#include <cmath>
+#include <cstddef>
+
+namespace AL {
+  namespace Math {
+    namespace detail {
+
+      inline void sinCos(float pAngle, float& pSin, float& pCos)
+      {
+#ifdef ALMATH_FAST_TRIGONOMETRY
+        fastSinCos(pAngle, pSin, pCos);
+#else
+        pSin = std::sin(pAngle);
+        pCos = std::cos(pAngle);
+#endif
+      }
+
+      // the sines and cosines of pSize angles; the fast ones go through the
+      // vectorized kernel
+      inline void sinCos(const float* pAngles, float* pSin, float* pCos,
+                         std::size_t pSize)
+      {
+#ifdef ALMATH_FAST_TRIGONOMETRY
+        transformKernels().sinCos(pAngles, pSin, pCos, pSize);
+#else
+        for (std::size_t i = 0u; i < pSize; ++i)
+        {
+          pSin[i] = std::sin(pAngles[i]);
+          pCos[i] = std::cos(pAngles[i]);
+        }
+#endif
+      }
+
+      inline float sin(float pAngle)
+      {
+#ifdef ALMATH_FAST_TRIGONOMETRY
+        return fastSin(pAngle);
+#else
+        return std::sin(pAngle);
+#endif
+      }
+
+      inline float cos(float pAngle)
+      {
+#ifdef ALMATH_FAST_TRIGONOMETRY
+        return fastCos(pAngle);
+#else
+        return std::cos(pAngle);
+#endif
+      }
+
+      inline float atan2(float pY, float pX)
+      {
+#ifdef ALMATH_FAST_TRIGONOMETRY
+        return fastAtan2(pY, pX);
+#else
+        return std::atan2(pY, pX);
+#endif
+      }
+
+    } // end namespace detail
+  } // end namespace Math
+} // end namespace AL
+#endif  // _LIBALMATH_SRC_TOOLS_TRIGONOMETRY_H_
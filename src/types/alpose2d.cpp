@@ -4,25 +4,21 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/alpose2d.h
+#define ALMATH_BUILDING_OUT_OF_LINE
 #include <almath/types/alpose2d.h>
+#include <almath/inline/alpose2d.h>
+#include "../kernels/transformkernels.h"
+#include "../tools/parallelfor.h"
+#include "../tools/trigonometry.h"
+#include "../tools/errorpolicy.h"
+#include <algorithm>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
 
-    Pose2D::Pose2D():x(0.0f), y(0.0f), theta(0.0f) {}
-
-    Pose2D::Pose2D(float pInit):x(pInit), y(pInit), theta(pInit) {}
-
-    Pose2D::Pose2D(
-      float pX,
-      float pY,
-      float pTheta)
-      :x(pX)
-      ,y(pY)
-      ,theta(pTheta) {}
-
     Pose2D::Pose2D (const std::vector<float>& pFloats)
     {
       if (pFloats.size() == 3u)
@@ -33,10 +29,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Pose2D constructor call with a wrong size of vector. "
-                  << "Size expected: 3. Size given: " << pFloats.size() << ". "
-                  << "Pose2D is set to default value." << std::endl;
+        detail::reportWrongSize("Pose2D constructor", "3", pFloats.size(),
+                                "Pose2D is set to default value.");
 
         x = 0.0f;
         y = 0.0f;
@@ -44,58 +38,6 @@ namespace AL {
       }
     }
 
-    Pose2D& Pose2D::operator*= (const Pose2D& pPos2)
-    {
-      const float x0 = pPos2.x;
-      const float y0 = pPos2.y;
-      const float cs = std::cos(theta);
-      const float sn = std::sin(theta);
-
-      x += cs*x0 - sn*y0;
-      y += sn*x0 + cs*y0;
-      theta += pPos2.theta;
-
-      return *this;
-    }
-
-    Pose2D& Pose2D::operator+= (const Pose2D& pPos2)
-    {
-      x     += pPos2.x;
-      y     += pPos2.y;
-      theta += pPos2.theta;
-      return *this;
-    }
-
-    Pose2D& Pose2D::operator-= (const Pose2D& pPos2)
-    {
-      x     -= pPos2.x;
-      y     -= pPos2.y;
-      theta -= pPos2.theta;
-      return *this;
-    }
-
-    bool Pose2D::operator==(const Pose2D& pPos2) const
-    {
-      return (x == pPos2.x &&
-              y == pPos2.y &&
-              theta == pPos2.theta);
-    }
-
-    bool Pose2D::operator!=(const Pose2D& pPos2) const
-    {
-      return ! (*this==pPos2);
-    }
-
-    float Pose2D::distanceSquared(const Pose2D& pPos) const
-    {
-      return Math::distanceSquared(*this, pPos);
-    }
-
-    float Pose2D::distance(const Pose2D& pPos2) const
-    {
-      return Math::distance(*this, pPos2);
-    }
-
     Pose2D Pose2D::operator/ (float pVal) const
     {
       if (pVal == 0.0f)
@@ -106,14 +48,6 @@ namespace AL {
       return *this * (1.0f/pVal);
     }
 
-    Pose2D& Pose2D::operator*= (const float pVal)
-    {
-      x     *= pVal;
-      y     *= pVal;
-      theta *= pVal;
-      return *this;
-    }
-
     Pose2D& Pose2D::operator/= (float pVal)
     {
       if (pVal == 0.0f)
@@ -130,12 +64,32 @@ namespace AL {
       return Math::pose2dDiff(*this, pPos2);
     }
 
+    Pose2D::Pose2D(const std::array<float, 3>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    Pose2D::Pose2D(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 3u)
+      {
+        throw std::runtime_error(
+          "ALMath: Pose2D constructor expects 3 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 3> Pose2D::toArray(void) const
+    {
+      std::array<float, 3> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void Pose2D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(3);
-      pReturnVector[0] = x;
-      pReturnVector[1] = y;
-      pReturnVector[2] = theta;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Pose2D::toVector(void) const
@@ -147,9 +101,7 @@ namespace AL {
 
     void Pose2D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = x;
-      *pIt++ = y;
-      *pIt++ = theta;
+      pIt = writeTo(pIt);
     }
 
     Pose2D Pose2D::normalize() const
@@ -163,21 +115,6 @@ namespace AL {
       return Pose2D(x / tmpNorm, y / tmpNorm, theta);
     }
 
-    float distanceSquared(
-      const Pose2D& pPos1,
-      const Pose2D& pPos2)
-    {
-      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+(pPos1.y-pPos2.y)*(pPos1.y-pPos2.y);
-    }
-
-    float distance(
-      const Pose2D& pPos1,
-      const Pose2D& pPos2)
-    {
-      return std::sqrt(distanceSquared(pPos1, pPos2));
-    }
-
-
     bool Pose2D::isNear(
         const Pose2D& pPos2,
         const float&  pEpsilon) const
@@ -204,8 +141,8 @@ namespace AL {
     {
       pPos.theta = -pPos.theta;
 
-      const float cos = std::cos(pPos.theta);
-      const float sin = std::sin(pPos.theta);
+      float sin, cos;
+      detail::sinCos(pPos.theta, sin, cos);
       const float x   = pPos.x;
 
       pPos.x = -(x*cos - pPos.y*sin);
@@ -236,12 +173,149 @@ namespace AL {
       return result;
     }
 
+    namespace {
+      // a thread processes at least this number of poses
+      const std::size_t POSE2D_MIN_GRAIN = 16384u;
+      // the sines and cosines are computed by blocks of this number of poses
+      const std::size_t POSE2D_SINCOS_BLOCK = 256u;
+
+      // call pFunction(i, sin, cos) for i in [0, pSize), where sin and cos
+      // are those of pPos[i].theta, computed by blocks with the kernels.
+      template <typename F>
+      void xForEachSinCos(
+          const Pose2D* pPos,
+          std::size_t   pSize,
+          unsigned int  pMaxThreads,
+          F             pFunction)
+      {
+        const detail::TransformKernels& lKernels = detail::transformKernels();
+        detail::parallelFor(pSize, pMaxThreads, POSE2D_MIN_GRAIN,
+                            [&](std::size_t pBegin, std::size_t pEnd)
+        {
+          float lAngles[POSE2D_SINCOS_BLOCK];
+          float lSin[POSE2D_SINCOS_BLOCK];
+          float lCos[POSE2D_SINCOS_BLOCK];
+          for (std::size_t b = pBegin; b < pEnd; b += POSE2D_SINCOS_BLOCK)
+          {
+            const std::size_t lCount = std::min(POSE2D_SINCOS_BLOCK, pEnd - b);
+            for (std::size_t i = 0u; i < lCount; ++i)
+            {
+              lAngles[i] = pPos[b + i].theta;
+            }
+            lKernels.sinCos(lAngles, lSin, lCos, lCount);
+            for (std::size_t i = 0u; i < lCount; ++i)
+            {
+              pFunction(b + i, lSin[i], lCos[i]);
+            }
+          }
+        });
+      }
+    } // anonymous namespace
+
+    void pose2DMultiply(
+      const Pose2D& pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads)
+    {
+      const Pose2D lPos1 = pPos1;
+      float sn, cs;
+      detail::sinCos(lPos1.theta, sn, cs);
+      detail::parallelFor(pSize, pMaxThreads, POSE2D_MIN_GRAIN,
+                          [&](std::size_t pBegin, std::size_t pEnd)
+      {
+        for (std::size_t i = pBegin; i < pEnd; ++i)
+        {
+          const Pose2D lPos2 = pPos2[i];
+          pOut[i].x = lPos1.x + (cs*lPos2.x - sn*lPos2.y);
+          pOut[i].y = lPos1.y + (sn*lPos2.x + cs*lPos2.y);
+          pOut[i].theta = lPos1.theta + lPos2.theta;
+        }
+      });
+    }
+
+    void pose2DMultiply(
+      const Pose2D* pPos1,
+      const Pose2D& pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads)
+    {
+      const Pose2D lPos2 = pPos2;
+      xForEachSinCos(pPos1, pSize, pMaxThreads,
+                     [&](std::size_t i, float sn, float cs)
+      {
+        const Pose2D lPos1 = pPos1[i];
+        pOut[i].x = lPos1.x + (cs*lPos2.x - sn*lPos2.y);
+        pOut[i].y = lPos1.y + (sn*lPos2.x + cs*lPos2.y);
+        pOut[i].theta = lPos1.theta + lPos2.theta;
+      });
+    }
+
+    void pose2DMultiply(
+      const Pose2D* pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads)
+    {
+      xForEachSinCos(pPos1, pSize, pMaxThreads,
+                     [&](std::size_t i, float sn, float cs)
+      {
+        const Pose2D lPos1 = pPos1[i];
+        const Pose2D lPos2 = pPos2[i];
+        pOut[i].x = lPos1.x + (cs*lPos2.x - sn*lPos2.y);
+        pOut[i].y = lPos1.y + (sn*lPos2.x + cs*lPos2.y);
+        pOut[i].theta = lPos1.theta + lPos2.theta;
+      });
+    }
+
+    void pose2DInverse(
+      const Pose2D* pPos,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads)
+    {
+      // cos(-theta) = cos(theta), sin(-theta) = -sin(theta)
+      xForEachSinCos(pPos, pSize, pMaxThreads,
+                     [&](std::size_t i, float sn, float cs)
+      {
+        const Pose2D lPos = pPos[i];
+        pOut[i].x = -(lPos.x*cs + lPos.y*sn);
+        pOut[i].y = -(lPos.y*cs - lPos.x*sn);
+        pOut[i].theta = -lPos.theta;
+      });
+    }
+
+    void pose2dDiff(
+      const Pose2D* pPos1,
+      const Pose2D* pPos2,
+      Pose2D*       pOut,
+      std::size_t   pSize,
+      unsigned int  pMaxThreads)
+    {
+      // inverse(pPos1[i])*pPos2[i], with the sine and cosine of
+      // pPos1[i].theta for both operations
+      xForEachSinCos(pPos1, pSize, pMaxThreads,
+                     [&](std::size_t i, float sn, float cs)
+      {
+        const Pose2D lPos1 = pPos1[i];
+        const Pose2D lPos2 = pPos2[i];
+        const float lInvX = -(lPos1.x*cs + lPos1.y*sn);
+        const float lInvY = -(lPos1.y*cs - lPos1.x*sn);
+        pOut[i].x = lInvX + (cs*lPos2.x + sn*lPos2.y);
+        pOut[i].y = lInvY + (cs*lPos2.y - sn*lPos2.x);
+        pOut[i].theta = lPos2.theta - lPos1.theta;
+      });
+    }
+
     Pose2D Pose2D::fromPolarCoordinates(
         const float pRadius,
         const float pAngle)
     {
-      return AL::Math::Pose2D(pRadius * std::cos(pAngle),
-                              pRadius * std::sin(pAngle),
+      return AL::Math::Pose2D(pRadius * detail::cos(pAngle),
+                              pRadius * detail::sin(pAngle),
                               pAngle);
     }
   } // end namespace math
@@ -4,20 +4,19 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/alposition2d.h
+#define ALMATH_BUILDING_OUT_OF_LINE
 #include <almath/types/alposition2d.h>
+#include <almath/inline/alposition2d.h>
+#include "../tools/trigonometry.h"
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
 
-    Position2D::Position2D(): x(0.0f), y(0.0f) {}
-
-    Position2D::Position2D(float pInit): x(pInit), y(pInit) {}
-
-    Position2D::Position2D(float pX, float pY): x(pX), y(pY) {}
-
     Position2D::Position2D (const std::vector<float>& pFloats)
     {
       if (pFloats.size() == 2u)
@@ -27,37 +26,14 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Position2D constructor call with a wrong size of vector. "
-                  << "Size expected: 2. Size given: " << pFloats.size() << ". "
-                  << "Position2D is set to default value." << std::endl;
+        detail::reportWrongSize("Position2D constructor", "2", pFloats.size(),
+                                "Position2D is set to default value.");
 
         x = 0.0f;
         y = 0.0f;
       }
     }
 
-    Position2D& Position2D::operator+= (const Position2D& pPos2)
-    {
-      x += pPos2.x;
-      y += pPos2.y;
-      return *this;
-    }
-
-    Position2D& Position2D::operator-= (const Position2D& pPos2)
-    {
-      x -= pPos2.x;
-      y -= pPos2.y;
-      return *this;
-    }
-
-
-    bool Position2D::operator!=(const Position2D& pPos2) const
-    {
-      return !(*this==pPos2);
-    }
-
-
     bool Position2D::isNear(
         const Position2D& pPos2,
         const float&      pEpsilon) const
@@ -66,13 +42,6 @@ namespace AL {
               std::abs(y - pPos2.y) <= pEpsilon);
     }
 
-    Position2D operator* (
-      const float       pVal,
-      const Position2D& pPos1)
-    {
-      return pPos1*pVal;
-    }
-
     Position2D Position2D::operator/ (float pVal) const
     {
       if (pVal == 0.0f)
@@ -83,13 +52,6 @@ namespace AL {
       return *this * (1.0f/pVal);
     }
 
-    Position2D& Position2D::operator*= (float pVal)
-    {
-      x *= pVal;
-      y *= pVal;
-      return *this;
-    }
-
     Position2D& Position2D::operator/= (float pVal)
     {
       if (pVal == 0.0f)
@@ -102,47 +64,37 @@ namespace AL {
     }
 
 
-    float Position2D::distanceSquared(const Position2D& pPos2) const
-    {
-      return Math::distanceSquared(*this, pPos2);
-    }
-
-    float Position2D::distance(const Position2D& pPos2) const
-    {
-      return Math::distance(*this, pPos2);
-    }
-
-    float Position2D::norm() const
-    {
-      return Math::norm(*this);
-    }
-
     Position2D Position2D::normalize() const
     {
       return Math::normalize(*this);
     }
 
-    float Position2D::dotProduct(const Position2D& pPos2) const
+    Position2D::Position2D(const std::array<float, 2>& pFloats)
     {
-      return Math::dotProduct(*this, pPos2);
+      readFrom(pFloats.begin());
     }
 
-    float Position2D::crossProduct(const Position2D& pPos2) const
+    Position2D::Position2D(const float* pFloats, std::size_t pSize)
     {
-      return Math::crossProduct(*this, pPos2);
+      if (pSize != 2u)
+      {
+        throw std::runtime_error(
+          "ALMath: Position2D constructor expects 2 floats.");
+      }
+      readFrom(pFloats);
     }
 
-    bool Position2D::operator==(const Position2D& pPos2) const
+    std::array<float, 2> Position2D::toArray(void) const
     {
-      return (x == pPos2.x &&
-              y == pPos2.y);
+      std::array<float, 2> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
     }
 
     void Position2D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(2);
-      pReturnVector[0] = x;
-      pReturnVector[1] = y;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Position2D::toVector(void) const
@@ -154,32 +106,12 @@ namespace AL {
 
     void Position2D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = x;
-      *pIt++ = y;
+      pIt = writeTo(pIt);
     }
 
     float Position2D::getAngle() const
     {
-      return std::atan2(y, x);
-    }
-
-    float distanceSquared(
-      const Position2D& pPos1,
-      const Position2D& pPos2)
-    {
-      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+(pPos1.y-pPos2.y)*(pPos1.y-pPos2.y);
-    }
-
-    float distance(
-      const Position2D& pPos1,
-      const Position2D& pPos2)
-    {
-      return std::sqrt(distanceSquared(pPos1, pPos2));
-    }
-
-    float norm(const Position2D& p)
-    {
-      return std::sqrt( (p.x*p.x) + (p.y*p.y) );
+      return detail::atan2(y, x);
     }
 
     Position2D normalize(const Position2D& p)
@@ -193,36 +125,12 @@ namespace AL {
       return p/tmpNorm;
     }
 
-    float dotProduct(
-      const Position2D& pPos1,
-      const Position2D& pPos2)
-    {
-      return (pPos1.x * pPos2.x + pPos1.y * pPos2.y);
-    }
-
-
-    float crossProduct(
-      const Position2D& pPos1,
-      const Position2D& pPos2)
-    {
-      return (pPos1.x*pPos2.y - pPos1.y*pPos2.x);
-    }
-
-
-    void crossProduct(
-      const Position2D& pPos1,
-      const Position2D& pPos2,
-      float&            result)
-    {
-      result = (pPos1.x*pPos2.y - pPos1.y*pPos2.x);
-    }
-
     Position2D Position2D::fromPolarCoordinates(
         const float pRadius,
         const float pAngle)
     {
-      return Position2D(pRadius * std::cos(pAngle),
-                        pRadius * std::sin(pAngle));
+      return Position2D(pRadius * detail::cos(pAngle),
+                        pRadius * detail::sin(pAngle));
     }
 
   } // end namespace math
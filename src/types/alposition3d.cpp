@@ -4,24 +4,18 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/alposition3d.h
+#define ALMATH_BUILDING_OUT_OF_LINE
 #include <almath/types/alposition3d.h>
+#include <almath/inline/alposition3d.h>
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
 
-    Position3D::Position3D() : x(0.0f), y(0.0f), z(0.0f) {}
-
-    Position3D::Position3D(float pInit) : x(pInit), y(pInit), z(pInit) {}
-
-    Position3D::Position3D(
-      float pX,
-      float pY,
-      float pZ):
-      x(pX), y(pY), z(pZ) {}
-
     Position3D::Position3D(const std::vector<float>& pFloats)
     {
       if (pFloats.size() == 3u)
@@ -32,10 +26,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Position3D constructor call with a wrong size of vector. "
-                  << "Size expected: 3. Size given: " << pFloats.size() << ". "
-                  << "Position3D is set to default value." << std::endl;
+        detail::reportWrongSize("Position3D constructor", "3", pFloats.size(),
+                                "Position3D is set to default value.");
 
         x = 0.0f;
         y = 0.0f;
@@ -43,23 +35,6 @@ namespace AL {
       }
     }
 
-    Position3D& Position3D::operator+= (const Position3D& pPos2)
-    {
-      x += pPos2.x;
-      y += pPos2.y;
-      z += pPos2.z;
-      return *this;
-    }
-
-    Position3D& Position3D::operator-= (const Position3D& pPos2)
-    {
-      x -= pPos2.x;
-      y -= pPos2.y;
-      z -= pPos2.z;
-      return *this;
-    }
-
-
     bool Position3D::isNear(
         const Position3D& pPos2,
         const float&      pEpsilon) const
@@ -69,11 +44,6 @@ namespace AL {
               std::abs(z - pPos2.z) <= pEpsilon);
     }
 
-    Position3D Position3D::operator* (float pVal) const
-    {
-      return Position3D(x*pVal, y*pVal, z*pVal);
-    }
-
     Position3D Position3D::operator/ (float pVal) const
     {
       if (pVal == 0.0f)
@@ -84,14 +54,6 @@ namespace AL {
       return *this * (1.0f/pVal);
     }
 
-    Position3D& Position3D::operator*= (float pVal)
-    {
-      x *= pVal;
-      y *= pVal;
-      z *= pVal;
-      return *this;
-    }
-
     Position3D& Position3D::operator/= (float pVal)
     {
       if (pVal == 0.0f)
@@ -103,54 +65,37 @@ namespace AL {
       return *this;
     }
 
-    bool Position3D::operator== (const Position3D& pPos2) const
-    {
-      return (x == pPos2.x &&
-              y == pPos2.y &&
-              z == pPos2.z);
-    }
-
-    bool Position3D::operator!= (const Position3D& pPos2) const
-    {
-      return !(*this==pPos2);
-    }
-
-    float Position3D::distanceSquared(const Position3D& pPos2) const
-    {
-      return Math::distanceSquared(*this, pPos2);
-    }
-
-    float Position3D::distance(const Position3D& pPos2) const
-    {
-      return Math::distance(*this, pPos2);
-    }
-
-    float Position3D::norm() const
+    Position3D Position3D::normalize() const
     {
-      return Math::norm(*this);
+      return Math::normalize(*this);
     }
 
-    Position3D Position3D::normalize() const
+    Position3D::Position3D(const std::array<float, 3>& pFloats)
     {
-      return Math::normalize(*this);
+      readFrom(pFloats.begin());
     }
 
-    float Position3D::dotProduct(const Position3D& pPos2) const
+    Position3D::Position3D(const float* pFloats, std::size_t pSize)
     {
-      return Math::dotProduct(*this, pPos2);
+      if (pSize != 3u)
+      {
+        throw std::runtime_error(
+          "ALMath: Position3D constructor expects 3 floats.");
+      }
+      readFrom(pFloats);
     }
 
-    Position3D Position3D::crossProduct(const Position3D& pPos2) const
+    std::array<float, 3> Position3D::toArray(void) const
     {
-      return Math::crossProduct(*this, pPos2);
+      std::array<float, 3> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
     }
 
     void Position3D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(3);
-      pReturnVector[0] = x;
-      pReturnVector[1] = y;
-      pReturnVector[2] = z;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Position3D::toVector(void) const
@@ -162,9 +107,7 @@ namespace AL {
 
     void Position3D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = x;
-      *pIt++ = y;
-      *pIt++ = z;
+      pIt = writeTo(pIt);
     }
 
     bool Position3D::isUnitVector(const float& pEpsilon) const
@@ -177,28 +120,6 @@ namespace AL {
       return Math::isOrthogonal(*this, pPos, pEpsilon);
     }
 
-    float distanceSquared(
-      const Position3D& pPos1,
-      const Position3D& pPos2)
-    {
-      return (pPos1.x-pPos2.x)*(pPos1.x-pPos2.x)+
-          (pPos1.y-pPos2.y)*(pPos1.y-pPos2.y)+
-          (pPos1.z-pPos2.z)*(pPos1.z-pPos2.z);
-    }
-
-
-    float distance(
-      const Position3D& pPos1,
-      const Position3D& pPos2)
-    {
-      return std::sqrt(distanceSquared(pPos1, pPos2));
-    }
-
-    float norm(const Position3D& p)
-    {
-      return std::sqrt( (p.x*p.x) + (p.y*p.y) + (p.z*p.z) );
-    }
-
     Position3D normalize(const Position3D& pPos)
     {
       const float tmpNorm = norm(pPos);
@@ -211,32 +132,6 @@ namespace AL {
       return pPos/tmpNorm;
     }
 
-    float dotProduct(
-      const Position3D& pPos1,
-      const Position3D& pPos2)
-    {
-      return (pPos1.x * pPos2.x + pPos1.y * pPos2.y + pPos1.z * pPos2.z);
-    }
-
-    void crossProduct(
-      const Position3D& pPos1,
-      const Position3D& pPos2,
-      Position3D&       pRes)
-    {
-      pRes.x = pPos1.y*pPos2.z - pPos1.z*pPos2.y;
-      pRes.y = pPos1.z*pPos2.x - pPos1.x*pPos2.z;
-      pRes.z = pPos1.x*pPos2.y - pPos1.y*pPos2.x;
-    }
-
-    Position3D crossProduct(
-      const Position3D& pPos1,
-      const Position3D& pPos2)
-    {
-      Position3D res;
-      crossProduct(pPos1, pPos2, res);
-      return res;
-    }
-
     bool isUnitVector(const Position3D& pPos,
                       const float& pEpsilon)
     {
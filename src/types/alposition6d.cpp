@@ -5,9 +5,9 @@
  */
 
 #include <almath/types/alposition6d.h>
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
@@ -56,10 +56,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Position6D constructor call with a wrong size of vector. "
-                  << "Size expected: 6. Size given: " << pFloats.size() << ". "
-                  << "Position6D is set to default value." << std::endl;
+        detail::reportWrongSize("Position6D constructor", "6", pFloats.size(),
+                                "Position6D is set to default value.");
 
         x = 0.0f;
         y = 0.0f;
@@ -169,15 +167,32 @@ namespace AL {
       return Math::norm(*this);
     }
 
+    Position6D::Position6D(const std::array<float, 6>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    Position6D::Position6D(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 6u)
+      {
+        throw std::runtime_error(
+          "ALMath: Position6D constructor expects 6 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 6> Position6D::toArray(void) const
+    {
+      std::array<float, 6> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void Position6D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(6);
-      pReturnVector[0] = x;
-      pReturnVector[1] = y;
-      pReturnVector[2] = z;
-      pReturnVector[3] = wx;
-      pReturnVector[4] = wy;
-      pReturnVector[5] = wz;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Position6D::toVector(void) const
@@ -189,12 +204,7 @@ namespace AL {
 
     void Position6D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = x;
-      *pIt++ = y;
-      *pIt++ = z;
-      *pIt++ = wx;
-      *pIt++ = wy;
-      *pIt++ = wz;
+      pIt = writeTo(pIt);
     }
 
     float distanceSquared(
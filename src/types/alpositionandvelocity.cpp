@@ -6,6 +6,7 @@
 
 #include <almath/types/alpositionandvelocity.h>
 #include <cmath>
+#include <stdexcept>
 
 namespace AL {
   namespace Math {
@@ -24,11 +25,35 @@ namespace AL {
               std::abs(dq - pDat.dq) <= pEpsilon);
     }
 
+    PositionAndVelocity::PositionAndVelocity(
+      const std::array<float, 2>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    PositionAndVelocity::PositionAndVelocity(
+      const float* pFloats,
+      std::size_t  pSize)
+    {
+      if (pSize != 2u)
+      {
+        throw std::runtime_error(
+          "ALMath: PositionAndVelocity constructor expects 2 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 2> PositionAndVelocity::toArray(void) const
+    {
+      std::array<float, 2> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void PositionAndVelocity::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(2);
-      pReturnVector[0] = q;
-      pReturnVector[1] = dq;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> PositionAndVelocity::toVector(void) const
@@ -5,10 +5,11 @@
  */
 
 #include <almath/types/alquaternion.h>
+#include "../tools/trigonometry.h"
 #include <cmath>
 #include <stdexcept>
 #include <almath/tools/altrigonometry.h>
-#include <iostream>
+#include "../tools/errorpolicy.h"
 
 namespace AL {
   namespace Math {
@@ -36,10 +37,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Quaternion constructor call with a wrong size of vector. "
-                  << "Size expected: 4. Size given: " << pFloats.size() << ". "
-                  << "Quaternion is set to default value." << std::endl;
+        detail::reportWrongSize("Quaternion constructor", "4", pFloats.size(),
+                                "Quaternion is set to default value.");
 
         w = 0.0f;
         x = 0.0f;
@@ -138,8 +137,8 @@ namespace AL {
     {
       Quaternion qua = Quaternion();
 
-      const float sin_a = std::sin(0.5f*pAngle);
-      const float cos_a = std::cos(0.5f*pAngle);
+      float sin_a, cos_a;
+      detail::sinCos(0.5f*pAngle, sin_a, cos_a);
 
       qua.w = cos_a;
       qua.x = pAxisX*sin_a;
@@ -165,13 +164,32 @@ namespace AL {
     }
 
 
+    Quaternion::Quaternion(const std::array<float, 4>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    Quaternion::Quaternion(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 4u)
+      {
+        throw std::runtime_error(
+          "ALMath: Quaternion constructor expects 4 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 4> Quaternion::toArray(void) const
+    {
+      std::array<float, 4> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void Quaternion::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(4);
-      pReturnVector[0] = w;
-      pReturnVector[1] = x;
-      pReturnVector[2] = y;
-      pReturnVector[3] = z;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Quaternion::toVector(void) const
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/alquattransform.h>
+#include <almath/tools/altransformhelpers.h>
+#include "../tools/trigonometry.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace AL {
+  namespace Math {
+
+    QuatTransform::QuatTransform()
+      : rotation()
+      , translation()
+    {}
+
+    QuatTransform::QuatTransform(
+      const Quaternion& pRotation,
+      const Position3D& pTranslation)
+      : rotation(pRotation)
+      , translation(pTranslation)
+    {}
+
+    QuatTransform& QuatTransform::operator*= (const QuatTransform& pQT2)
+    {
+      // copies first: pQT2 may be *this
+      const float w1 = rotation.w;
+      const float x1 = rotation.x;
+      const float y1 = rotation.y;
+      const float z1 = rotation.z;
+      const float w2 = pQT2.rotation.w;
+      const float x2 = pQT2.rotation.x;
+      const float y2 = pQT2.rotation.y;
+      const float z2 = pQT2.rotation.z;
+      const float px = pQT2.translation.x;
+      const float py = pQT2.translation.y;
+      const float pz = pQT2.translation.z;
+
+      // translation += rotation * pQT2.translation, see quatTransformRotate
+      const float tx = 2.0f*(y1*pz - z1*py);
+      const float ty = 2.0f*(z1*px - x1*pz);
+      const float tz = 2.0f*(x1*py - y1*px);
+      translation.x += px + w1*tx + (y1*tz - z1*ty);
+      translation.y += py + w1*ty + (z1*tx - x1*tz);
+      translation.z += pz + w1*tz + (x1*ty - y1*tx);
+
+      // summed in pairs: in a composition chain, the latency of the
+      // quaternion product is the critical path
+      rotation.w = (w1*w2 - x1*x2) - (y1*y2 + z1*z2);
+      rotation.x = (w1*x2 + x1*w2) + (y1*z2 - z1*y2);
+      rotation.y = (w1*y2 - x1*z2) + (y1*w2 + z1*x2);
+      rotation.z = (w1*z2 + x1*y2) + (z1*w2 - y1*x2);
+      return *this;
+    }
+
+    QuatTransform QuatTransform::operator* (const QuatTransform& pQT2) const
+    {
+      QuatTransform lQT = *this;
+      lQT *= pQT2;
+      return lQT;
+    }
+
+    Position3D QuatTransform::operator* (const Position3D& pPos) const
+    {
+      return quatTransformRotate(*this, pPos) + translation;
+    }
+
+    bool QuatTransform::isNear(
+      const QuatTransform& pQT2,
+      const float&         pEpsilon) const
+    {
+      return (rotation.isNear(pQT2.rotation, pEpsilon) &&
+              translation.isNear(pQT2.translation, pEpsilon));
+    }
+
+    QuatTransform QuatTransform::inverse() const
+    {
+      return quatTransformInverse(*this);
+    }
+
+    void QuatTransform::normalizeQuatTransform(void)
+    {
+      Math::normalizeQuatTransform(*this);
+    }
+
+    Position3D quatTransformRotate(
+      const QuatTransform& pQT,
+      const Position3D&    pPos)
+    {
+      const Quaternion& q = pQT.rotation;
+      // t = 2 v x p
+      const float tx = 2.0f*(q.y*pPos.z - q.z*pPos.y);
+      const float ty = 2.0f*(q.z*pPos.x - q.x*pPos.z);
+      const float tz = 2.0f*(q.x*pPos.y - q.y*pPos.x);
+      // p + w t + v x t
+      return Position3D(pPos.x + q.w*tx + (q.y*tz - q.z*ty),
+                        pPos.y + q.w*ty + (q.z*tx - q.x*tz),
+                        pPos.z + q.w*tz + (q.x*ty - q.y*tx));
+    }
+
+    void quatTransformInverse(
+      const QuatTransform& pQT,
+      QuatTransform&       pQTOut)
+    {
+      const QuatTransform lConjugate(
+            Quaternion(pQT.rotation.w, -pQT.rotation.x,
+                       -pQT.rotation.y, -pQT.rotation.z));
+      const Position3D lTranslation = quatTransformRotate(lConjugate,
+                                                          pQT.translation);
+      pQTOut.rotation = lConjugate.rotation;
+      pQTOut.translation = Position3D(-lTranslation.x, -lTranslation.y,
+                                      -lTranslation.z);
+    }
+
+    QuatTransform quatTransformInverse(const QuatTransform& pQT)
+    {
+      QuatTransform lQTOut;
+      quatTransformInverse(pQT, lQTOut);
+      return lQTOut;
+    }
+
+    void normalizeQuatTransform(QuatTransform& pQT)
+    {
+      const Quaternion& q = pQT.rotation;
+      const float lNorm = std::sqrt(q.w*q.w + q.x*q.x + q.y*q.y + q.z*q.z);
+      if (lNorm == 0.0f)
+      {
+        throw std::runtime_error(
+          "ALMath: normalizeQuatTransform with a null quaternion.");
+      }
+      pQT.rotation *= 1.0f / lNorm;
+    }
+
+    QuatTransform quatTransformFromTransform(const Transform& pT)
+    {
+      return QuatTransform(quaternionFromTransform(pT),
+                           Position3D(pT.r1_c4, pT.r2_c4, pT.r3_c4));
+    }
+
+    Transform transformFromQuatTransform(const QuatTransform& pQT)
+    {
+      Transform lT = transformFromQuaternion(pQT.rotation);
+      lT.r1_c4 = pQT.translation.x;
+      lT.r2_c4 = pQT.translation.y;
+      lT.r3_c4 = pQT.translation.z;
+      return lT;
+    }
+
+    QuatTransform quatTransformFromPosition6D(const Position6D& pPos)
+    {
+      float sx, cx;
+      detail::sinCos(0.5f*pPos.wx, sx, cx);
+      float sy, cy;
+      detail::sinCos(0.5f*pPos.wy, sy, cy);
+      float sz, cz;
+      detail::sinCos(0.5f*pPos.wz, sz, cz);
+      // qz(wz) * qy(wy) * qx(wx)
+      return QuatTransform(
+            Quaternion(cz*cy*cx + sz*sy*sx,
+                       cz*cy*sx - sz*sy*cx,
+                       cz*sy*cx + sz*cy*sx,
+                       sz*cy*cx - cz*sy*sx),
+            Position3D(pPos.x, pPos.y, pPos.z));
+    }
+
+    Position6D position6DFromQuatTransform(const QuatTransform& pQT)
+    {
+      return position6DFromTransform(transformFromQuatTransform(pQT));
+    }
+
+    QuatTransform quatTransformFromDisplacement(const Displacement& pDisp)
+    {
+      return QuatTransform(pDisp.Q, pDisp.P);
+    }
+
+    Displacement displacementFromQuatTransform(const QuatTransform& pQT)
+    {
+      return Displacement(pQT.translation, pQT.rotation);
+    }
+
+  } // end namespace Math
+} // end namespace AL
@@ -5,10 +5,12 @@
  */
 
 #include <almath/types/alrotation.h>
+#include "../kernels/transformkernels.h"
+#include "../tools/trigonometry.h"
+#include "../tools/errorpolicy.h"
 
 #include <stdexcept>
 # include <cmath>
-#include <iostream>
 
 namespace AL {
   namespace Math {
@@ -49,10 +51,9 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Rotation constructor call with a wrong size of vector. "
-                  << "Size expected: 9, 12 or 16. Size given: " << pFloats.size() << ". "
-                  << "Rotation is set to default identity." << std::endl;
+        detail::reportWrongSize("Rotation constructor", "9, 12 or 16",
+                                pFloats.size(),
+                                "Rotation is set to default identity.");
 
         r1_c1 = 1.0f;
         r1_c2 = 0.0f;
@@ -71,36 +72,9 @@ namespace AL {
 
     Rotation& Rotation::operator*= (const Rotation& pRot2)
     {
-      float c1 = r1_c1;
-      float c2 = r1_c2;
-      float c3 = r1_c3;
-
-      if (this == &pRot2)
-      {
-        // copy to manage case: a *= a
-        return *this *= Rotation(pRot2);
-      }
-
-      r1_c1 = (c1 * pRot2.r1_c1) + (c2 * pRot2.r2_c1) + (c3 * pRot2.r3_c1);
-      r1_c2 = (c1 * pRot2.r1_c2) + (c2 * pRot2.r2_c2) + (c3 * pRot2.r3_c2);
-      r1_c3 = (c1 * pRot2.r1_c3) + (c2 * pRot2.r2_c3) + (c3 * pRot2.r3_c3);
-
-      c1 = r2_c1;
-      c2 = r2_c2;
-      c3 = r2_c3;
-
-      r2_c1 = (c1 * pRot2.r1_c1) + (c2 * pRot2.r2_c1) + (c3 * pRot2.r3_c1);
-      r2_c2 = (c1 * pRot2.r1_c2) + (c2 * pRot2.r2_c2) + (c3 * pRot2.r3_c2);
-      r2_c3 = (c1 * pRot2.r1_c3) + (c2 * pRot2.r2_c3) + (c3 * pRot2.r3_c3);
-
-      c1 = r3_c1;
-      c2 = r3_c2;
-      c3 = r3_c3;
-
-      r3_c1 = (c1 * pRot2.r1_c1) + (c2 * pRot2.r2_c1) + (c3 * pRot2.r3_c1);
-      r3_c2 = (c1 * pRot2.r1_c2) + (c2 * pRot2.r2_c2) + (c3 * pRot2.r3_c2);
-      r3_c3 = (c1 * pRot2.r1_c3) + (c2 * pRot2.r2_c3) + (c3 * pRot2.r3_c3);
-
+      // the kernels manage the case: a *= a
+      detail::transformKernels().rotationMultiply(
+            &r1_c1, &pRot2.r1_c1, &r1_c1);
       return *this;
     }
 
@@ -257,20 +231,50 @@ namespace AL {
       return Math::rotationFrom3DRotation(pWX, pWY, pWZ);
     }
 
-    void Rotation::toVector(std::vector<float>& pReturnVector) const
+    Rotation::Rotation(const std::array<float, 9>& pFloats)
     {
-      pReturnVector.resize(9);
-      pReturnVector[0] = r1_c1;
-      pReturnVector[1] = r1_c2;
-      pReturnVector[2] = r1_c3;
+      readFrom(pFloats.begin());
+    }
 
-      pReturnVector[3] = r2_c1;
-      pReturnVector[4] = r2_c2;
-      pReturnVector[5] = r2_c3;
+    Rotation::Rotation(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize == 9u)
+      {
+        readFrom(pFloats);
+      }
+      else if ((pSize == 12u) || (pSize == 16u))
+      {
+        // the rotation part of a transform
+        r1_c1 = pFloats[0];
+        r1_c2 = pFloats[1];
+        r1_c3 = pFloats[2];
 
-      pReturnVector[6] = r3_c1;
-      pReturnVector[7] = r3_c2;
-      pReturnVector[8] = r3_c3;
+        r2_c1 = pFloats[4];
+        r2_c2 = pFloats[5];
+        r2_c3 = pFloats[6];
+
+        r3_c1 = pFloats[8];
+        r3_c2 = pFloats[9];
+        r3_c3 = pFloats[10];
+      }
+      else
+      {
+        throw std::runtime_error(
+          "ALMath: Rotation constructor expects 9, 12 or 16 floats.");
+      }
+    }
+
+    std::array<float, 9> Rotation::toArray(void) const
+    {
+      std::array<float, 9> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
+    void Rotation::toVector(std::vector<float>& pReturnVector) const
+    {
+      pReturnVector.resize(9);
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Rotation::toVector(void) const
@@ -356,12 +360,12 @@ namespace AL {
       }
 
       Rotation T = Rotation();
-      const float t1 =  std::cos(pAngle);
+      float t8, t1;
+      detail::sinCos(pAngle, t8, t1);
       const float t2 =  1.0f - t1;
       const float t3 =  pX*pX;
       const float t6 =  t2*pX;
       const float t7 =  t6*pY;
-      const float t8 =  std::sin(pAngle);
       const float t9 =  t8*pZ;
       const float t11=  t6*pZ;
       const float t12=  t8*pY;
@@ -399,8 +403,8 @@ namespace AL {
 
     Rotation rotationFromRotX(const float pRotX)
     {
-      const float c = std::cos(pRotX);
-      const float s = std::sin(pRotX);
+      float s, c;
+      detail::sinCos(pRotX, s, c);
       Rotation T;
       T.r2_c2 = c;
       T.r2_c3 = -s;
@@ -412,8 +416,8 @@ namespace AL {
 
     Rotation rotationFromRotY(const float pRotY)
     {
-      const float c = std::cos(pRotY);
-      const float s = std::sin(pRotY);
+      float s, c;
+      detail::sinCos(pRotY, s, c);
       Rotation T;
       T.r1_c1 = c;
       T.r1_c3 = s;
@@ -425,8 +429,8 @@ namespace AL {
 
     Rotation rotationFromRotZ(const float pRotZ)
     {
-      const float c = std::cos(pRotZ);
-      const float s = std::sin(pRotZ);
+      float s, c;
+      detail::sinCos(pRotZ, s, c);
       Rotation T;
       T.r1_c1 = c;
       T.r1_c2 = -s;
@@ -460,9 +464,9 @@ namespace AL {
 
       if (lNorm < lEpsilon)
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "normalizeRotation with null column. "
-                  << "Rotation part set to identity." << std::endl;
+        detail::reportError(ERROR_NOT_NORMALIZABLE,
+                            "normalizeRotation with null column. "
+                            "Rotation part set to identity.");
 
         pR.r1_c1 = 1.0f;
         pR.r1_c2 = 0.0f;
@@ -494,9 +498,9 @@ namespace AL {
 
       if (lNorm < lEpsilon)
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "normalizeRotation with null column. "
-                  << "Rotation part set to identity." << std::endl;
+        detail::reportError(ERROR_NOT_NORMALIZABLE,
+                            "normalizeRotation with null column. "
+                            "Rotation part set to identity.");
 
         pR.r1_c1 = 1.0f;
         pR.r1_c2 = 0.0f;
@@ -5,9 +5,9 @@
  */
 
 #include <almath/types/alrotation3d.h>
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
@@ -40,10 +40,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Rotation3D constructor call with a wrong size of vector. "
-                  << "Size expected: 3. Size given: " << pFloats.size() << ". "
-                  << "Rotation3D is set to default value." << std::endl;
+        detail::reportWrongSize("Rotation3D constructor", "3", pFloats.size(),
+                                "Rotation3D is set to default value.");
 
         wx = 0.0f;
         wy = 0.0f;
@@ -127,12 +125,32 @@ namespace AL {
     }
 
 
+    Rotation3D::Rotation3D(const std::array<float, 3>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    Rotation3D::Rotation3D(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 3u)
+      {
+        throw std::runtime_error(
+          "ALMath: Rotation3D constructor expects 3 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 3> Rotation3D::toArray(void) const
+    {
+      std::array<float, 3> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void Rotation3D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(3);
-      pReturnVector[0] = wx;
-      pReturnVector[1] = wy;
-      pReturnVector[2] = wz;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Rotation3D::toVector(void) const
@@ -4,17 +4,73 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/altransform.h
+#define ALMATH_BUILDING_OUT_OF_LINE
 #include <almath/types/altransform.h>
+#include <almath/inline/altransform.h>
+#include "../kernels/transformkernels.h"
+#include "../tools/trigonometry.h"
+#include "../tools/errorpolicy.h"
 #include <cmath>
-#include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace AL {
   namespace Math {
 
-    Transform::Transform():
-        r1_c1(1.0f), r1_c2(0.0f), r1_c3(0.0f), r1_c4(0.0f),
-        r2_c1(0.0f), r2_c2(1.0f), r2_c3(0.0f), r2_c4(0.0f),
-        r3_c1(0.0f), r3_c2(0.0f), r3_c3(1.0f), r3_c4(0.0f) {}
+    namespace {
+      void xDefaultRigidTransformCheck(const Transform& pT,
+                                       const char*      pFunction)
+      {
+        if (!pT.isTransform(0.0001f))
+        {
+          throw std::runtime_error(
+                std::string("ALMath: ") + pFunction +
+                ": the Transform is not a rigid motion.");
+        }
+      }
+
+      RigidTransformCheck gRigidTransformCheck = &xDefaultRigidTransformCheck;
+
+      inline void xCheckRigid(const Transform& pT, const char* pFunction)
+      {
+#ifndef NDEBUG
+        if (gRigidTransformCheck != NULL)
+        {
+          gRigidTransformCheck(pT, pFunction);
+        }
+#else
+        (void)pT;
+        (void)pFunction;
+#endif
+      }
+
+      // pOut = pT1^-1 * pT2, pOut must not alias pT1 or pT2
+      inline void xInverseRigidMultiply(const Transform& pT1,
+                                        const Transform& pT2,
+                                        Transform&       pOut)
+      {
+        const float x = pT2.r1_c4 - pT1.r1_c4;
+        const float y = pT2.r2_c4 - pT1.r2_c4;
+        const float z = pT2.r3_c4 - pT1.r3_c4;
+
+        pOut.r1_c1 = pT1.r1_c1*pT2.r1_c1 + pT1.r2_c1*pT2.r2_c1 + pT1.r3_c1*pT2.r3_c1;
+        pOut.r1_c2 = pT1.r1_c1*pT2.r1_c2 + pT1.r2_c1*pT2.r2_c2 + pT1.r3_c1*pT2.r3_c2;
+        pOut.r1_c3 = pT1.r1_c1*pT2.r1_c3 + pT1.r2_c1*pT2.r2_c3 + pT1.r3_c1*pT2.r3_c3;
+        pOut.r1_c4 = pT1.r1_c1*x + pT1.r2_c1*y + pT1.r3_c1*z;
+
+        pOut.r2_c1 = pT1.r1_c2*pT2.r1_c1 + pT1.r2_c2*pT2.r2_c1 + pT1.r3_c2*pT2.r3_c1;
+        pOut.r2_c2 = pT1.r1_c2*pT2.r1_c2 + pT1.r2_c2*pT2.r2_c2 + pT1.r3_c2*pT2.r3_c2;
+        pOut.r2_c3 = pT1.r1_c2*pT2.r1_c3 + pT1.r2_c2*pT2.r2_c3 + pT1.r3_c2*pT2.r3_c3;
+        pOut.r2_c4 = pT1.r1_c2*x + pT1.r2_c2*y + pT1.r3_c2*z;
+
+        pOut.r3_c1 = pT1.r1_c3*pT2.r1_c1 + pT1.r2_c3*pT2.r2_c1 + pT1.r3_c3*pT2.r3_c1;
+        pOut.r3_c2 = pT1.r1_c3*pT2.r1_c2 + pT1.r2_c3*pT2.r2_c2 + pT1.r3_c3*pT2.r3_c2;
+        pOut.r3_c3 = pT1.r1_c3*pT2.r1_c3 + pT1.r2_c3*pT2.r2_c3 + pT1.r3_c3*pT2.r3_c3;
+        pOut.r3_c4 = pT1.r1_c3*x + pT1.r2_c3*y + pT1.r3_c3*z;
+      }
+    }
 
     Transform::Transform(const std::vector<float>& pFloats)
     {
@@ -39,24 +95,25 @@ namespace AL {
         // todo: check it is a real transform
         if (!isTransform())
         {
+          detail::countError(ERROR_NORMALIZED);
           normalizeTransform();
 
           // strange case with nan data
           if (!isTransform())
           {
-            std::cerr << "ALMath: WARNING: "
-                      << "Transform constructor with wrong vector value. "
-                      << "Rotation part is normalized." << std::endl;
+            detail::reportError(
+                  ERROR_NOT_NORMALIZABLE,
+                  "Transform constructor with wrong vector value. "
+                  "Rotation part is normalized.");
           }
         }
 
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Transform constructor call with a wrong size of vector. "
-                  << "Size expected: 12 or 16. Size given: " << pFloats.size() << ". "
-                  << "Transform is set to identity." << std::endl;
+        detail::reportWrongSize("Transform constructor", "12 or 16",
+                                pFloats.size(),
+                                "Transform is set to identity.");
 
         r1_c1 = 1.0f;
         r1_c2 = 0.0f;
@@ -75,103 +132,20 @@ namespace AL {
       }
     }
 
-    Transform::Transform(
-      const float& pPosX,
-      const float& pPosY,
-      const float& pPosZ)
-    {
-      r1_c1 = 1.0f;
-      r1_c2 = 0.0f;
-      r1_c3 = 0.0f;
-
-      r2_c1 = 0.0f;
-      r2_c2 = 1.0f;
-      r2_c3 = 0.0f;
-
-      r3_c1 = 0.0f;
-      r3_c2 = 0.0f;
-      r3_c3 = 1.0f;
-
-      r1_c4 = pPosX;
-      r2_c4 = pPosY;
-      r3_c4 = pPosZ;
-    }
-
     Transform& Transform::operator*= (const Transform& pT2)
     {
-      if (this == &pT2)
-      {
-        // copy to manage case: a *= a
-        return *this *= Transform(pT2);
-      }
-
-      float c1 = r1_c1;
-      float c2 = r1_c2;
-      float c3 = r1_c3;
-
-      r1_c1 = (c1 * pT2.r1_c1) + (c2 * pT2.r2_c1) + (c3 * pT2.r3_c1);
-      r1_c2 = (c1 * pT2.r1_c2) + (c2 * pT2.r2_c2) + (c3 * pT2.r3_c2);
-      r1_c3 = (c1 * pT2.r1_c3) + (c2 * pT2.r2_c3) + (c3 * pT2.r3_c3);
-      r1_c4 = (c1 * pT2.r1_c4) + (c2 * pT2.r2_c4) + (c3 * pT2.r3_c4) + r1_c4;
-      c1 = r2_c1;
-      c2 = r2_c2;
-      c3 = r2_c3;
-      r2_c1 = (c1 * pT2.r1_c1) + (c2 * pT2.r2_c1) + (c3 * pT2.r3_c1);
-      r2_c2 = (c1 * pT2.r1_c2) + (c2 * pT2.r2_c2) + (c3 * pT2.r3_c2);
-      r2_c3 = (c1 * pT2.r1_c3) + (c2 * pT2.r2_c3) + (c3 * pT2.r3_c3);
-      r2_c4 = (c1 * pT2.r1_c4) + (c2 * pT2.r2_c4) + (c3 * pT2.r3_c4) + r2_c4;
-      c1 = r3_c1;
-      c2 = r3_c2;
-      c3 = r3_c3;
-      r3_c1 = (c1 * pT2.r1_c1) + (c2 * pT2.r2_c1) + (c3 * pT2.r3_c1);
-      r3_c2 = (c1 * pT2.r1_c2) + (c2 * pT2.r2_c2) + (c3 * pT2.r3_c2);
-      r3_c3 = (c1 * pT2.r1_c3) + (c2 * pT2.r2_c3) + (c3 * pT2.r3_c3);
-      r3_c4 = (c1 * pT2.r1_c4) + (c2 * pT2.r2_c4) + (c3 * pT2.r3_c4) + r3_c4;
+      // the kernels manage the case: a *= a
+      detail::transformKernels().transformMultiply(&r1_c1, &pT2.r1_c1, &r1_c1);
       return *this;
     }
 
     Transform Transform::operator* (const Transform& pT2) const
     {
       Transform t;
-      t.r1_c1 = (r1_c1 * pT2.r1_c1) + (r1_c2 * pT2.r2_c1) + (r1_c3 * pT2.r3_c1);
-      t.r1_c2 = (r1_c1 * pT2.r1_c2) + (r1_c2 * pT2.r2_c2) + (r1_c3 * pT2.r3_c2);
-      t.r1_c3 = (r1_c1 * pT2.r1_c3) + (r1_c2 * pT2.r2_c3) + (r1_c3 * pT2.r3_c3);
-      t.r1_c4 = (r1_c1 * pT2.r1_c4) + (r1_c2 * pT2.r2_c4) + (r1_c3 * pT2.r3_c4) + r1_c4;
-
-      t.r2_c1 = (r2_c1 * pT2.r1_c1) + (r2_c2 * pT2.r2_c1) + (r2_c3 * pT2.r3_c1);
-      t.r2_c2 = (r2_c1 * pT2.r1_c2) + (r2_c2 * pT2.r2_c2) + (r2_c3 * pT2.r3_c2);
-      t.r2_c3 = (r2_c1 * pT2.r1_c3) + (r2_c2 * pT2.r2_c3) + (r2_c3 * pT2.r3_c3);
-      t.r2_c4 = (r2_c1 * pT2.r1_c4) + (r2_c2 * pT2.r2_c4) + (r2_c3 * pT2.r3_c4) + r2_c4;
-
-      t.r3_c1 = (r3_c1 * pT2.r1_c1) + (r3_c2 * pT2.r2_c1) + (r3_c3 * pT2.r3_c1);
-      t.r3_c2 = (r3_c1 * pT2.r1_c2) + (r3_c2 * pT2.r2_c2) + (r3_c3 * pT2.r3_c2);
-      t.r3_c3 = (r3_c1 * pT2.r1_c3) + (r3_c2 * pT2.r2_c3) + (r3_c3 * pT2.r3_c3);
-      t.r3_c4 = (r3_c1 * pT2.r1_c4) + (r3_c2 * pT2.r2_c4) + (r3_c3 * pT2.r3_c4) + r3_c4;
+      detail::transformKernels().transformMultiply(&r1_c1, &pT2.r1_c1, &t.r1_c1);
       return t;
     }
 
-    bool Transform::operator==(const Transform& pT2) const
-    {
-      return (r1_c1 == pT2.r1_c1 &&
-              r1_c2 == pT2.r1_c2 &&
-              r1_c3 == pT2.r1_c3 &&
-              r1_c4 == pT2.r1_c4 &&
-              r2_c1 == pT2.r2_c1 &&
-              r2_c2 == pT2.r2_c2 &&
-              r2_c3 == pT2.r2_c3 &&
-              r2_c4 == pT2.r2_c4 &&
-              r3_c1 == pT2.r3_c1 &&
-              r3_c2 == pT2.r3_c2 &&
-              r3_c3 == pT2.r3_c3 &&
-              r3_c4 == pT2.r3_c4);
-    }
-
-    bool Transform::operator!=(const Transform& pT2) const
-    {
-      return !(*this==pT2);
-    }
-
-
     bool Transform::isNear(
         const Transform& pT2,
         const float&     pEpsilon)const
@@ -264,6 +238,11 @@ namespace AL {
       return Math::transformInverse(*this);
     }
 
+    Transform Transform::inverseRigid() const
+    {
+      return Math::transformInverseRigid(*this);
+    }
+
 
     Transform Transform::fromRotX(const float pRotX)
     {
@@ -324,29 +303,56 @@ namespace AL {
       return Math::transformDistance(*this, pT2);
     }
 
-    void Transform::toVector(std::vector<float>& pReturnVector) const
+    namespace {
+      // as the std::vector constructor, but throw instead of printing
+      void xReadNormalized(const float* pFloats, Transform& pT)
+      {
+        pT.readFrom(pFloats);
+        if (!pT.isTransform())
+        {
+          detail::countError(ERROR_NORMALIZED);
+          pT.normalizeTransform();
+          if (!pT.isTransform())
+          {
+            throw std::runtime_error(
+              "ALMath: Transform constructor: the rotation part can not be "
+              "normalized.");
+          }
+        }
+      }
+    }
+
+    Transform::Transform(const std::array<float, 12>& pFloats)
     {
-      pReturnVector.resize(16);
+      xReadNormalized(pFloats.data(), *this);
+    }
 
-      pReturnVector[0]  = r1_c1;
-      pReturnVector[1]  = r1_c2;
-      pReturnVector[2]  = r1_c3;
-      pReturnVector[3]  = r1_c4;
+    Transform::Transform(const std::array<float, 16>& pFloats)
+    {
+      xReadNormalized(pFloats.data(), *this);
+    }
 
-      pReturnVector[4]  = r2_c1;
-      pReturnVector[5]  = r2_c2;
-      pReturnVector[6]  = r2_c3;
-      pReturnVector[7]  = r2_c4;
+    Transform::Transform(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 12u && pSize != 16u)
+      {
+        throw std::runtime_error(
+          "ALMath: Transform constructor expects 12 or 16 floats.");
+      }
+      xReadNormalized(pFloats, *this);
+    }
 
-      pReturnVector[8]  = r3_c1;
-      pReturnVector[9]  = r3_c2;
-      pReturnVector[10] = r3_c3;
-      pReturnVector[11] = r3_c4;
+    std::array<float, 16> Transform::toArray(void) const
+    {
+      std::array<float, 16> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
 
-      pReturnVector[12] = 0.0f;
-      pReturnVector[13] = 0.0f;
-      pReturnVector[14] = 0.0f;
-      pReturnVector[15] = 1.0f;
+    void Transform::toVector(std::vector<float>& pReturnVector) const
+    {
+      pReturnVector.resize(16);
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Transform::toVector(void) const
@@ -358,54 +364,15 @@ namespace AL {
 
     void Transform::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = r1_c1;
-      *pIt++ = r1_c2;
-      *pIt++ = r1_c3;
-      *pIt++ = r1_c4;
-
-      *pIt++ = r2_c1;
-      *pIt++ = r2_c2;
-      *pIt++ = r2_c3;
-      *pIt++ = r2_c4;
-
-      *pIt++ = r3_c1;
-      *pIt++ = r3_c2;
-      *pIt++ = r3_c3;
-      *pIt++ = r3_c4;
-
-      *pIt++ = 0.0f;
-      *pIt++ = 0.0f;
-      *pIt++ = 0.0f;
-      *pIt++ = 1.0f;
+      pIt = writeTo(pIt);
     }
 
     void transformPreMultiply(
       const Transform& pT,
       Transform&       pTOut)
     {
-      float r1 = pTOut.r1_c1;
-      float r2 = pTOut.r2_c1;
-      pTOut.r1_c1 = (pT.r1_c1 * r1) + (pT.r1_c2 * r2) + (pT.r1_c3 * pTOut.r3_c1);
-      pTOut.r2_c1 = (pT.r2_c1 * r1) + (pT.r2_c2 * r2) + (pT.r2_c3 * pTOut.r3_c1);
-      pTOut.r3_c1 = (pT.r3_c1 * r1) + (pT.r3_c2 * r2) + (pT.r3_c3 * pTOut.r3_c1);
-
-      r1 = pTOut.r1_c2;
-      r2 = pTOut.r2_c2;
-      pTOut.r1_c2 = (pT.r1_c1 * r1) + (pT.r1_c2 * r2) + (pT.r1_c3 * pTOut.r3_c2);
-      pTOut.r2_c2 = (pT.r2_c1 * r1) + (pT.r2_c2 * r2) + (pT.r2_c3 * pTOut.r3_c2);
-      pTOut.r3_c2 = (pT.r3_c1 * r1) + (pT.r3_c2 * r2) + (pT.r3_c3 * pTOut.r3_c2);
-
-      r1 = pTOut.r1_c3;
-      r2 = pTOut.r2_c3;
-      pTOut.r1_c3 = (pT.r1_c1 * r1) + (pT.r1_c2 * r2) + (pT.r1_c3 * pTOut.r3_c3);
-      pTOut.r2_c3 = (pT.r2_c1 * r1) + (pT.r2_c2 * r2) + (pT.r2_c3 * pTOut.r3_c3);
-      pTOut.r3_c3 = (pT.r3_c1 * r1) + (pT.r3_c2 * r2) + (pT.r3_c3 * pTOut.r3_c3);
-
-      r1 = pTOut.r1_c4;
-      r2 = pTOut.r2_c4;
-      pTOut.r1_c4 = (pT.r1_c1 * r1) + (pT.r1_c2 * r2) + (pT.r1_c3 * pTOut.r3_c4) + pT.r1_c4;
-      pTOut.r2_c4 = (pT.r2_c1 * r1) + (pT.r2_c2 * r2) + (pT.r2_c3 * pTOut.r3_c4) + pT.r2_c4;
-      pTOut.r3_c4 = (pT.r3_c1 * r1) + (pT.r3_c2 * r2) + (pT.r3_c3 * pTOut.r3_c4) + pT.r3_c4;
+      detail::transformKernels().transformMultiply(
+            &pT.r1_c1, &pTOut.r1_c1, &pTOut.r1_c1);
     }
 
 
@@ -420,9 +387,9 @@ namespace AL {
                     std::pow(pT.r3_c3, 2));
       if (lNorm < lEpsilon)
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "normalizeTransform with null column. "
-                  << "Rotation part set to identity." << std::endl;
+        detail::reportError(ERROR_NOT_NORMALIZABLE,
+                            "normalizeTransform with null column. "
+                            "Rotation part set to identity.");
 
         pT.r1_c1 = 1.0f;
         pT.r1_c2 = 0.0f;
@@ -454,9 +421,9 @@ namespace AL {
 
       if (lNorm < lEpsilon)
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "normalizeTransform with null column. "
-                  << "Rotation part set to identity." << std::endl;
+        detail::reportError(ERROR_NOT_NORMALIZABLE,
+                            "normalizeTransform with null column. "
+                            "Rotation part set to identity.");
 
         pT.r1_c1 = 1.0f;
         pT.r1_c2 = 0.0f;
@@ -495,9 +462,9 @@ namespace AL {
       const Transform&    pT,
       std::vector<float>& pTOut)
     {
-      std::cerr << "ALMath: WARNING: "
-                << "transformToFloatVector is deprecated. "
-                << "Use toVector function." << std::endl;
+      detail::reportError(ERROR_DEPRECATED,
+                          "transformToFloatVector is deprecated. "
+                          "Use toVector function.");
 
       pTOut.resize(12);
       pTOut[0]  = pT.r1_c1;
@@ -538,10 +505,8 @@ namespace AL {
       if (pFloats.size() != 12u &&
           pFloats.size() != 16u)
       {
-        std::cout << "ALMath: WARNING: "
-                  << "determinant call with a wrong size of vector. "
-                  << "Size expected: 12 or 16. Size given: " << pFloats.size() << ". "
-                  << "Determinant is set to zero." << std::endl;
+        detail::reportWrongSize("determinant", "12 or 16", pFloats.size(),
+                                "Determinant is set to zero.");
         return 0.0f;
       }
 
@@ -558,21 +523,7 @@ namespace AL {
       const Transform& pT,
       Transform&       pTOut)
     {
-      // rotation Ri = R'
-      pTOut.r1_c1 = pT.r1_c1;
-      pTOut.r1_c2 = pT.r2_c1;
-      pTOut.r1_c3 = pT.r3_c1;
-      pTOut.r2_c1 = pT.r1_c2;
-      pTOut.r2_c2 = pT.r2_c2;
-      pTOut.r2_c3 = pT.r3_c2;
-      pTOut.r3_c1 = pT.r1_c3;
-      pTOut.r3_c2 = pT.r2_c3;
-      pTOut.r3_c3 = pT.r3_c3;
-
-      // translation ri = -R'*r
-      pTOut.r1_c4 = -( pT.r1_c1*pT.r1_c4 + pT.r2_c1*pT.r2_c4 + pT.r3_c1*pT.r3_c4 );
-      pTOut.r2_c4 = -( pT.r1_c2*pT.r1_c4 + pT.r2_c2*pT.r2_c4 + pT.r3_c2*pT.r3_c4 );
-      pTOut.r3_c4 = -( pT.r1_c3*pT.r1_c4 + pT.r2_c3*pT.r2_c4 + pT.r3_c3*pT.r3_c4 );
+      detail::transformKernels().transformInverse(&pT.r1_c1, &pTOut.r1_c1);
     }
 
 
@@ -584,10 +535,90 @@ namespace AL {
     }
 
 
+    void transformInverseRigid(
+      const Transform& pT,
+      Transform&       pTOut)
+    {
+      xCheckRigid(pT, "transformInverseRigid");
+      detail::transformKernels().transformInverse(&pT.r1_c1, &pTOut.r1_c1);
+    }
+
+
+    Transform transformInverseRigid(const Transform& pT)
+    {
+      Transform pTOut;
+      transformInverseRigid(pT, pTOut);
+      return pTOut;
+    }
+
+
+    void transformInverseRigid(
+      const Transform* pT,
+      Transform*       pTOut,
+      std::size_t      pSize)
+    {
+      const detail::TransformKernels& lKernels = detail::transformKernels();
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        xCheckRigid(pT[i], "transformInverseRigid");
+        lKernels.transformInverse(&pT[i].r1_c1, &pTOut[i].r1_c1);
+      }
+    }
+
+
+    void transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform& pT2,
+      Transform&       pTOut)
+    {
+      xCheckRigid(pT1, "transformInverseRigidMultiply");
+      Transform lOut;
+      xInverseRigidMultiply(pT1, pT2, lOut);
+      pTOut = lOut;
+    }
+
+
+    Transform transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform& pT2)
+    {
+      xCheckRigid(pT1, "transformInverseRigidMultiply");
+      Transform lOut;
+      xInverseRigidMultiply(pT1, pT2, lOut);
+      return lOut;
+    }
+
+
+    void transformInverseRigidMultiply(
+      const Transform& pT1,
+      const Transform* pT2,
+      Transform*       pTOut,
+      std::size_t      pSize)
+    {
+      xCheckRigid(pT1, "transformInverseRigidMultiply");
+      // pT1 may be an element of pTOut
+      const Transform lT1 = pT1;
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        Transform lOut;
+        xInverseRigidMultiply(lT1, pT2[i], lOut);
+        pTOut[i] = lOut;
+      }
+    }
+
+
+    RigidTransformCheck setRigidTransformCheck(RigidTransformCheck pCheck)
+    {
+      const RigidTransformCheck lPrevious = gRigidTransformCheck;
+      gRigidTransformCheck = pCheck;
+      return lPrevious;
+    }
+
+
     Transform transformFromRotX(const float pRotX)
     {
-      const float c = std::cos(pRotX);
-      const float s = std::sin(pRotX);
+      float s, c;
+      detail::sinCos(pRotX, s, c);
       Transform T;
       T.r2_c2 = c;
       T.r2_c3 = -s;
@@ -599,8 +630,8 @@ namespace AL {
 
     Transform transformFromRotY(const float pRotY)
     {
-      const float c = std::cos(pRotY);
-      const float s = std::sin(pRotY);
+      float s, c;
+      detail::sinCos(pRotY, s, c);
       Transform T;
       T.r1_c1 = c;
       T.r1_c3 = s;
@@ -612,8 +643,8 @@ namespace AL {
 
     Transform transformFromRotZ(const float pRotZ)
     {
-      const float c = std::cos(pRotZ);
-      const float s = std::sin(pRotZ);
+      float s, c;
+      detail::sinCos(pRotZ, s, c);
       Transform T;
       T.r1_c1 = c;
       T.r1_c2 = -s;
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/altransformbatch.h>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace AL {
+  namespace Math {
+
+    namespace {
+      const std::size_t LANES = TransformBatch::LANES;
+      const std::size_t COEFFICIENTS = TransformBatch::COEFFICIENTS;
+
+      // Number of floats in 4 KiB.
+      const std::size_t PAGE_FLOATS = 1024u;
+
+      // Return the stride of the coefficient arrays for pSize transforms.
+      // The stride is a multiple of LANES. When it is also a multiple of
+      // 4 KiB, the 12 arrays would map to the same L1 cache sets and evict
+      // each other: it is then shifted by two cache lines.
+      std::size_t xPaddedSize(std::size_t pSize)
+      {
+        std::size_t lStride = ((pSize + LANES - 1u) / LANES) * LANES;
+        if (lStride > 0u && lStride % PAGE_FLOATS == 0u)
+        {
+          lStride += 2u * 16u;
+        }
+        return lStride;
+      }
+
+      // A kernel operand: coefficient c of lane k is fData[c*fStride + k].
+      // A Transform is broadcast to all the lanes with a zero stride on k,
+      // see xBroadcast.
+      struct Operand
+      {
+        const float* fData;
+        std::size_t  fStride;
+        std::size_t  fLaneStep;
+      };
+
+      Operand xOperand(const TransformBatch& pT)
+      {
+        Operand lOp = {pT.data(TransformBatch::R1_C1), pT.stride(), 1u};
+        return lOp;
+      }
+
+      Operand xBroadcast(const Transform& pT)
+      {
+        Operand lOp = {&pT.r1_c1, 1u, 0u};
+        return lOp;
+      }
+
+      // The kernels compute a whole block of LANES transforms in a local
+      // buffer before storing it, so that the output may alias the inputs.
+      // The loops on k have a constant trip count of LANES and do not alias:
+      // the compiler turns each statement into LANES/4 (SSE) or LANES/8 (AVX)
+      // vector instructions.
+      // The operations are done in the same order as in
+      // Transform::operator*, so that results are identical.
+      template <std::size_t A, std::size_t B>
+      inline void xMultiplyBlock(
+        const float* pA,
+        std::size_t  pStrideA,
+        const float* pB,
+        std::size_t  pStrideB,
+        float*       pOut,
+        std::size_t  pStrideOut)
+      {
+        float lOut[TransformBatch::COEFFICIENTS][TransformBatch::LANES];
+#define ALMATH_A(c) pA[(c)*pStrideA + A*k]
+#define ALMATH_B(c) pB[(c)*pStrideB + B*k]
+        for (std::size_t k = 0u; k < LANES; ++k)
+        {
+          lOut[0u][k] = (ALMATH_A(0u) * ALMATH_B(0u)) +
+              (ALMATH_A(1u) * ALMATH_B(4u)) +
+              (ALMATH_A(2u) * ALMATH_B(8u));
+          lOut[1u][k] = (ALMATH_A(0u) * ALMATH_B(1u)) +
+              (ALMATH_A(1u) * ALMATH_B(5u)) +
+              (ALMATH_A(2u) * ALMATH_B(9u));
+          lOut[2u][k] = (ALMATH_A(0u) * ALMATH_B(2u)) +
+              (ALMATH_A(1u) * ALMATH_B(6u)) +
+              (ALMATH_A(2u) * ALMATH_B(10u));
+          lOut[3u][k] = (ALMATH_A(0u) * ALMATH_B(3u)) +
+              (ALMATH_A(1u) * ALMATH_B(7u)) +
+              (ALMATH_A(2u) * ALMATH_B(11u)) + ALMATH_A(3u);
+          lOut[4u][k] = (ALMATH_A(4u) * ALMATH_B(0u)) +
+              (ALMATH_A(5u) * ALMATH_B(4u)) +
+              (ALMATH_A(6u) * ALMATH_B(8u));
+          lOut[5u][k] = (ALMATH_A(4u) * ALMATH_B(1u)) +
+              (ALMATH_A(5u) * ALMATH_B(5u)) +
+              (ALMATH_A(6u) * ALMATH_B(9u));
+          lOut[6u][k] = (ALMATH_A(4u) * ALMATH_B(2u)) +
+              (ALMATH_A(5u) * ALMATH_B(6u)) +
+              (ALMATH_A(6u) * ALMATH_B(10u));
+          lOut[7u][k] = (ALMATH_A(4u) * ALMATH_B(3u)) +
+              (ALMATH_A(5u) * ALMATH_B(7u)) +
+              (ALMATH_A(6u) * ALMATH_B(11u)) + ALMATH_A(7u);
+          lOut[8u][k] = (ALMATH_A(8u) * ALMATH_B(0u)) +
+              (ALMATH_A(9u) * ALMATH_B(4u)) +
+              (ALMATH_A(10u) * ALMATH_B(8u));
+          lOut[9u][k] = (ALMATH_A(8u) * ALMATH_B(1u)) +
+              (ALMATH_A(9u) * ALMATH_B(5u)) +
+              (ALMATH_A(10u) * ALMATH_B(9u));
+          lOut[10u][k] = (ALMATH_A(8u) * ALMATH_B(2u)) +
+              (ALMATH_A(9u) * ALMATH_B(6u)) +
+              (ALMATH_A(10u) * ALMATH_B(10u));
+          lOut[11u][k] = (ALMATH_A(8u) * ALMATH_B(3u)) +
+              (ALMATH_A(9u) * ALMATH_B(7u)) +
+              (ALMATH_A(10u) * ALMATH_B(11u)) + ALMATH_A(11u);
+        }
+#undef ALMATH_A
+#undef ALMATH_B
+        for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+        {
+          std::memcpy(pOut + c*pStrideOut, lOut[c], sizeof(lOut[c]));
+        }
+      }
+
+      template <std::size_t A, std::size_t B>
+      void xMultiply(
+        const Operand&  pA,
+        const Operand&  pB,
+        std::size_t     pSize,
+        TransformBatch& pOut)
+      {
+        float* lOut = pOut.data(TransformBatch::R1_C1);
+        for (std::size_t i = 0u; i < pSize; i += LANES)
+        {
+          xMultiplyBlock<A, B>(pA.fData + A*i, pA.fStride,
+                               pB.fData + B*i, pB.fStride,
+                               lOut + i, pOut.stride());
+        }
+      }
+
+      void xMultiply(
+        const Operand&  pA,
+        const Operand&  pB,
+        std::size_t     pSize,
+        TransformBatch& pOut)
+      {
+        pOut.resize(pSize);
+        if (pA.fLaneStep == 0u)
+        {
+          xMultiply<0u, 1u>(pA, pB, pSize, pOut);
+        }
+        else if (pB.fLaneStep == 0u)
+        {
+          xMultiply<1u, 0u>(pA, pB, pSize, pOut);
+        }
+        else
+        {
+          xMultiply<1u, 1u>(pA, pB, pSize, pOut);
+        }
+      }
+
+      inline void xInverseBlock(
+        const float* pT,
+        std::size_t  pStrideT,
+        float*       pOut,
+        std::size_t  pStrideOut)
+      {
+        float lOut[TransformBatch::COEFFICIENTS][TransformBatch::LANES];
+#define ALMATH_T(c) pT[(c)*pStrideT + k]
+        for (std::size_t k = 0u; k < LANES; ++k)
+        {
+          // rotation Ri = R'
+          lOut[0u][k]  = ALMATH_T(0u);
+          lOut[1u][k]  = ALMATH_T(4u);
+          lOut[2u][k]  = ALMATH_T(8u);
+          lOut[4u][k]  = ALMATH_T(1u);
+          lOut[5u][k]  = ALMATH_T(5u);
+          lOut[6u][k]  = ALMATH_T(9u);
+          lOut[8u][k]  = ALMATH_T(2u);
+          lOut[9u][k]  = ALMATH_T(6u);
+          lOut[10u][k] = ALMATH_T(10u);
+          // translation ri = -R'*r
+          lOut[3u][k] = -(ALMATH_T(0u)*ALMATH_T(3u) + ALMATH_T(4u)*ALMATH_T(7u) +
+                          ALMATH_T(8u)*ALMATH_T(11u));
+          lOut[7u][k] = -(ALMATH_T(1u)*ALMATH_T(3u) + ALMATH_T(5u)*ALMATH_T(7u) +
+                          ALMATH_T(9u)*ALMATH_T(11u));
+          lOut[11u][k] = -(ALMATH_T(2u)*ALMATH_T(3u) + ALMATH_T(6u)*ALMATH_T(7u) +
+                           ALMATH_T(10u)*ALMATH_T(11u));
+        }
+#undef ALMATH_T
+        for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+        {
+          std::memcpy(pOut + c*pStrideOut, lOut[c], sizeof(lOut[c]));
+        }
+      }
+
+      void xCheckSameSize(
+        const TransformBatch& pT1,
+        const TransformBatch& pT2,
+        const char*           pFunctionName)
+      {
+        if (pT1.size() != pT2.size())
+        {
+          throw std::runtime_error(
+            std::string("ALMath: ") + pFunctionName +
+            " TransformBatch sizes do not match.");
+        }
+      }
+    } // anonymous namespace
+
+    const std::size_t TransformBatch::LANES;
+    const std::size_t TransformBatch::COEFFICIENTS;
+
+    TransformBatch::TransformBatch():
+      fSize(0u),
+      fStride(0u)
+    {}
+
+    TransformBatch::TransformBatch(std::size_t pSize):
+      fSize(0u),
+      fStride(0u)
+    {
+      resize(pSize);
+    }
+
+    TransformBatch::TransformBatch(const std::vector<Transform>& pTransforms):
+      fSize(0u),
+      fStride(0u)
+    {
+      assign(pTransforms);
+    }
+
+    void TransformBatch::resize(std::size_t pSize)
+    {
+      const std::size_t lStride = xPaddedSize(pSize);
+      if (lStride > fStride)
+      {
+        std::vector<float> lData(COEFFICIENTS * lStride);
+        for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+        {
+          if (fSize > 0u)
+          {
+            std::memcpy(&lData[c * lStride], &fData[c * fStride],
+                        fSize * sizeof(float));
+          }
+        }
+        fData.swap(lData);
+        fStride = lStride;
+      }
+      if (pSize > fSize)
+      {
+        xSetIdentity(fSize, fStride);
+      }
+      fSize = pSize;
+    }
+
+    Transform TransformBatch::get(std::size_t pIndex) const
+    {
+      Transform lT;
+      float* lOut = &lT.r1_c1;
+      for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+      {
+        lOut[c] = fData[c * fStride + pIndex];
+      }
+      return lT;
+    }
+
+    void TransformBatch::set(std::size_t pIndex, const Transform& pT)
+    {
+      const float* lIn = &pT.r1_c1;
+      for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+      {
+        fData[c * fStride + pIndex] = lIn[c];
+      }
+    }
+
+    void TransformBatch::assign(const Transform* pTransforms, std::size_t pSize)
+    {
+      resize(pSize);
+      for (std::size_t i = 0u; i < pSize; ++i)
+      {
+        set(i, pTransforms[i]);
+      }
+    }
+
+    void TransformBatch::assign(const std::vector<Transform>& pTransforms)
+    {
+      assign(pTransforms.empty() ? 0 : &pTransforms[0], pTransforms.size());
+    }
+
+    void TransformBatch::copyTo(Transform* pTransforms) const
+    {
+      for (std::size_t i = 0u; i < fSize; ++i)
+      {
+        float* lOut = &pTransforms[i].r1_c1;
+        for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+        {
+          lOut[c] = fData[c * fStride + i];
+        }
+      }
+    }
+
+    void TransformBatch::toVector(std::vector<Transform>& pTransforms) const
+    {
+      pTransforms.resize(fSize);
+      if (fSize > 0u)
+      {
+        copyTo(&pTransforms[0]);
+      }
+    }
+
+    std::vector<Transform> TransformBatch::toVector(void) const
+    {
+      std::vector<Transform> lTransforms;
+      toVector(lTransforms);
+      return lTransforms;
+    }
+
+    void TransformBatch::xSetIdentity(std::size_t pBegin, std::size_t pEnd)
+    {
+      for (std::size_t c = 0u; c < COEFFICIENTS; ++c)
+      {
+        const float lValue = (c == R1_C1 || c == R2_C2 || c == R3_C3) ?
+            1.0f : 0.0f;
+        for (std::size_t i = pBegin; i < pEnd; ++i)
+        {
+          fData[c * fStride + i] = lValue;
+        }
+      }
+    }
+
+
+    void transformMultiply(
+      const TransformBatch& pT1,
+      const TransformBatch& pT2,
+      TransformBatch&       pTOut)
+    {
+      xCheckSameSize(pT1, pT2, "transformMultiply");
+      xMultiply(xOperand(pT1), xOperand(pT2), pT1.size(), pTOut);
+    }
+
+    void transformMultiply(
+      const Transform&      pT1,
+      const TransformBatch& pT2,
+      TransformBatch&       pTOut)
+    {
+      xMultiply(xBroadcast(pT1), xOperand(pT2), pT2.size(), pTOut);
+    }
+
+    void transformMultiply(
+      const TransformBatch& pT1,
+      const Transform&      pT2,
+      TransformBatch&       pTOut)
+    {
+      xMultiply(xOperand(pT1), xBroadcast(pT2), pT1.size(), pTOut);
+    }
+
+    void transformPreMultiply(
+      const TransformBatch& pT,
+      TransformBatch&       pTOut)
+    {
+      xCheckSameSize(pT, pTOut, "transformPreMultiply");
+      transformMultiply(pT, pTOut, pTOut);
+    }
+
+    void transformPreMultiply(
+      const Transform& pT,
+      TransformBatch&  pTOut)
+    {
+      transformMultiply(pT, pTOut, pTOut);
+    }
+
+    void transformInverse(
+      const TransformBatch& pT,
+      TransformBatch&       pTOut)
+    {
+      pTOut.resize(pT.size());
+      const float* lT = pT.data(TransformBatch::R1_C1);
+      float* lOut = pTOut.data(TransformBatch::R1_C1);
+      for (std::size_t i = 0u; i < pT.size(); i += LANES)
+      {
+        xInverseBlock(lT + i, pT.stride(), lOut + i, pTOut.stride());
+      }
+    }
+
+  } // end namespace Math
+} // end namespace AL
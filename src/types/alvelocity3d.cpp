@@ -5,9 +5,9 @@
  */
 
 #include <almath/types/alvelocity3d.h>
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
@@ -38,10 +38,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Velocity3D constructor call with a wrong size of vector. "
-                  << "Size expected: 3. Size given: " << pFloats.size() << ". "
-                  << "Velocity3D is set to default value." << std::endl;
+        detail::reportWrongSize("Velocity3D constructor", "3", pFloats.size(),
+                                "Velocity3D is set to default value.");
 
         xd = 0.0f;
         yd = 0.0f;
@@ -138,12 +136,32 @@ namespace AL {
       return Math::normalize(*this);
     }
 
+    Velocity3D::Velocity3D(const std::array<float, 3>& pFloats)
+    {
+      readFrom(pFloats.begin());
+    }
+
+    Velocity3D::Velocity3D(const float* pFloats, std::size_t pSize)
+    {
+      if (pSize != 3u)
+      {
+        throw std::runtime_error(
+          "ALMath: Velocity3D constructor expects 3 floats.");
+      }
+      readFrom(pFloats);
+    }
+
+    std::array<float, 3> Velocity3D::toArray(void) const
+    {
+      std::array<float, 3> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
+
     void Velocity3D::toVector(std::vector<float>& pReturnVector) const
     {
       pReturnVector.resize(3);
-      pReturnVector[0] = xd;
-      pReturnVector[1] = yd;
-      pReturnVector[2] = zd;
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Velocity3D::toVector(void) const
@@ -155,9 +173,7 @@ namespace AL {
 
     void Velocity3D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = xd;
-      *pIt++ = yd;
-      *pIt++ = zd;
+      pIt = writeTo(pIt);
     }
 
     float norm (const Velocity3D& pVel)
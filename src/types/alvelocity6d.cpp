@@ -4,44 +4,18 @@
  * found in the COPYING file.
  */
 
+// this translation unit exports the out of line symbols of
+// almath/inline/alvelocity6d.h
+#define ALMATH_BUILDING_OUT_OF_LINE
 #include <almath/types/alvelocity6d.h>
+#include <almath/inline/alvelocity6d.h>
+#include "../tools/errorpolicy.h"
 #include <cmath>
 #include <stdexcept>
-#include <iostream>
 
 namespace AL {
   namespace Math {
 
-    Velocity6D::Velocity6D():
-      xd(0.0f),
-      yd(0.0f),
-      zd(0.0f),
-      wxd(0.0f),
-      wyd(0.0f),
-      wzd(0.0f) {}
-
-    Velocity6D::Velocity6D(float pInit):
-      xd(pInit),
-      yd(pInit),
-      zd(pInit),
-      wxd(pInit),
-      wyd(pInit),
-      wzd(pInit) {}
-
-    Velocity6D::Velocity6D(
-        float pXd,
-        float pYd,
-        float pZd,
-        float pWxd,
-        float pWyd,
-        float pWzd):
-      xd(pXd),
-      yd(pYd),
-      zd(pZd),
-      wxd(pWxd),
-      wyd(pWyd),
-      wzd(pWzd) {}
-
     Velocity6D::Velocity6D(const std::vector<float>& pFloats)
     {
       if (pFloats.size() == 6u)
@@ -55,10 +29,8 @@ namespace AL {
       }
       else
       {
-        std::cerr << "ALMath: WARNING: "
-                  << "Velocity6D constructor call with a wrong size of vector. "
-                  << "Size expected: 6. Size given: " << pFloats.size() << ". "
-                  << "Velocity6D is set to default value." << std::endl;
+        detail::reportWrongSize("Velocity6D constructor", "6", pFloats.size(),
+                                "Velocity6D is set to default value.");
 
         xd  = 0.0f;
         yd  = 0.0f;
@@ -80,36 +52,6 @@ namespace AL {
     }
 
 
-    bool Velocity6D::operator== (const Velocity6D& pVel2) const
-    {
-      return (xd == pVel2.xd &&
-              yd == pVel2.yd &&
-              zd == pVel2.zd &&
-              wxd == pVel2.wxd &&
-              wyd == pVel2.wyd &&
-              wzd == pVel2.wzd);
-    }
-
-
-    bool Velocity6D::operator!= (const Velocity6D& pVel2) const
-    {
-      return !(*this==pVel2);
-    }
-
-
-    Velocity6D& Velocity6D::operator*= (const float pVal)
-    {
-      xd  *= pVal;
-      yd  *= pVal;
-      zd  *= pVal;
-      wxd *= pVal;
-      wyd *= pVal;
-      wzd *= pVal;
-
-      return *this;
-    }
-
-
     Velocity6D& Velocity6D::operator/= (const float pVal)
     {
       if (pVal == 0.0f)
@@ -133,27 +75,37 @@ namespace AL {
               std::abs(wzd - pVel2.wzd) <= pEpsilon);
     }
 
-    float Velocity6D::norm() const
+    Velocity6D Velocity6D::normalize() const
     {
-      return Math::norm(*this);
+      return Math::normalize(*this);
     }
 
-    Velocity6D Velocity6D::normalize() const
+    Velocity6D::Velocity6D(const std::array<float, 6>& pFloats)
     {
-      return Math::normalize(*this);
+      readFrom(pFloats.begin());
     }
 
-    void Velocity6D::toVector(std::vector<float>& pReturnVector) const
+    Velocity6D::Velocity6D(const float* pFloats, std::size_t pSize)
     {
-      pReturnVector.resize(6);
+      if (pSize != 6u)
+      {
+        throw std::runtime_error(
+          "ALMath: Velocity6D constructor expects 6 floats.");
+      }
+      readFrom(pFloats);
+    }
 
-      pReturnVector[0] = xd;
-      pReturnVector[1] = yd;
-      pReturnVector[2] = zd;
+    std::array<float, 6> Velocity6D::toArray(void) const
+    {
+      std::array<float, 6> lFloats;
+      writeTo(lFloats.begin());
+      return lFloats;
+    }
 
-      pReturnVector[3] = wxd;
-      pReturnVector[4] = wyd;
-      pReturnVector[5] = wzd;
+    void Velocity6D::toVector(std::vector<float>& pReturnVector) const
+    {
+      pReturnVector.resize(6);
+      writeTo(pReturnVector.begin());
     }
 
     std::vector<float> Velocity6D::toVector(void) const
@@ -165,34 +117,9 @@ namespace AL {
 
     void Velocity6D::writeToVector(std::vector<float>::iterator& pIt) const
     {
-      *pIt++ = xd;
-      *pIt++ = yd;
-      *pIt++ = zd;
-      *pIt++ = wxd;
-      *pIt++ = wyd;
-      *pIt++ = wzd;
+      pIt = writeTo(pIt);
     }
 
-    Velocity6D operator* (
-        const float       pVal,
-        const Velocity6D& pVel)
-    {
-      return pVel * pVal;
-    }
-
-
-    float norm(const Velocity6D& pVel)
-    {
-      // norm of a 6 component vector
-      return std::sqrt(pVel.xd*pVel.xd +
-                       pVel.yd*pVel.yd +
-                       pVel.zd*pVel.zd +
-                       pVel.wxd*pVel.wxd +
-                       pVel.wyd*pVel.wyd +
-                       pVel.wzd*pVel.wzd);
-    }
-
-
     Velocity6D normalize(const Velocity6D& pVel)
     {
       const float tmpNorm = norm(pVel);
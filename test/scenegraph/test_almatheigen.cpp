@@ -4,6 +4,8 @@
  */
 
 #include <almath/scenegraph/almatheigen.h>
+#include <almath/tools/altransformhelpers.h>
+#include <almath/tools/altrigonometry.h>
 #include <gtest/gtest.h>
 
 using namespace AL;
@@ -171,3 +173,61 @@ TEST(ALMathEigen, velocity6d_eigen_to_almath) {
   // Math::toALMathVelocity6D(v6.head(6), v6d);
   // Math::toALMathVelocity6D(v6.block(0, 6, 0, 1), v6d);
 }
+
+TEST(ALMathEigen, average_transforms_accumulator) {
+  std::vector<Math::Transform> transforms;
+  for (int i = 0; i < 200; ++i) {
+    const float t = 0.05f * static_cast<float>(i);
+    Math::Transform tf = Math::transformFromRotZ(0.5f * std::sin(t)) *
+                         Math::transformFromRotY(0.4f * std::cos(0.9f * t)) *
+                         Math::transformFromRotX(2.8f + 0.3f * std::sin(t));
+    tf.r1_c4 = std::sin(t);
+    tf.r2_c4 = -1.f + t;
+    tf.r3_c4 = 0.5f;
+    transforms.push_back(tf);
+  }
+
+  // a window of 10 transforms, slid over the samples
+  const std::size_t window = 10u;
+  Math::TransformMeanAccumulator accumulator;
+  for (std::size_t i = 0u; i < transforms.size(); ++i) {
+    accumulator.add(transforms[i]);
+    if (i >= window) {
+      accumulator.remove(transforms[i - window]);
+    }
+    const std::size_t first = (i >= window) ? i + 1u - window : 0u;
+    const std::vector<Math::Transform> range(transforms.begin() + first,
+                                             transforms.begin() + i + 1u);
+    EXPECT_TRUE(Math::averageTransforms(range).isNear(accumulator.mean(),
+                                                      1e-5f))
+        << i;
+  }
+}
+
+TEST(ALMathEigen, average_transforms_accumulator_drift) {
+  // 1 degree per frame about a tilted axis, for more than a full turn: the
+  // window ends up far from its first samples
+  const float step = Math::PI / 180.0f;
+  std::vector<Math::Transform> transforms;
+  for (int i = 0; i < 400; ++i) {
+    Math::Transform tf = Math::transformFromRotX(0.3f) *
+                         Math::transformFromRotZ(step * static_cast<float>(i));
+    tf.r1_c4 = 0.01f * static_cast<float>(i);
+    transforms.push_back(tf);
+  }
+
+  const std::size_t window = 10u;
+  Math::TransformMeanAccumulator accumulator;
+  for (std::size_t i = 0u; i < transforms.size(); ++i) {
+    accumulator.add(transforms[i]);
+    if (i >= window) {
+      accumulator.remove(transforms[i - window]);
+    }
+    const std::size_t first = (i >= window) ? i + 1u - window : 0u;
+    const std::vector<Math::Transform> range(transforms.begin() + first,
+                                             transforms.begin() + i + 1u);
+    EXPECT_TRUE(Math::averageTransforms(range).isNear(accumulator.mean(),
+                                                      1e-5f))
+        << i;
+  }
+}
@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/scenegraph/inversekinematics.h>
+#include <almath/scenegraph/kinematicmodel.h>
+#include <almath/scenegraph/kinematicstate.h>
+#include <almath/tools/altransformhelpers.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <boost/property_tree/xml_parser.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace AL;
+using AL::Math::Transform;
+
+namespace {
+
+// base -z-> l1 -(-x)-> l2 -y-> l3 -axis-> l4 -prismatic-> l5 -fixed-> tool
+//   +-mimic of j1-> m1
+const char *const kUrdf =
+    "<robot name='test'>"
+    " <link name='base'/>"
+    " <link name='l1'/> <link name='l2'/> <link name='l3'/>"
+    " <link name='l4'/> <link name='l5'/> <link name='tool'/>"
+    " <link name='m1'/>"
+    " <joint name='j1' type='revolute'>"
+    "  <parent link='base'/> <child link='l1'/>"
+    "  <origin xyz='0 0 0.1' rpy='0 0 0'/> <axis xyz='0 0 1'/>"
+    "  <limit lower='-2' upper='2'/>"
+    " </joint>"
+    " <joint name='j2' type='continuous'>"
+    "  <parent link='l1'/> <child link='l2'/>"
+    "  <origin xyz='0.1 0 0.2' rpy='0.1 0.2 0.3'/> <axis xyz='-1 0 0'/>"
+    " </joint>"
+    " <joint name='j3' type='revolute'>"
+    "  <parent link='l2'/> <child link='l3'/>"
+    "  <origin xyz='0 0.3 0' rpy='0 0 1.5707963'/> <axis xyz='0 1 0'/>"
+    "  <limit lower='-1.2' upper='1.2'/>"
+    " </joint>"
+    " <joint name='j4' type='revolute'>"
+    "  <parent link='l3'/> <child link='l4'/>"
+    "  <origin xyz='0 0 0.15' rpy='0 0 0'/> <axis xyz='0 0.6 0.8'/>"
+    " </joint>"
+    " <joint name='j5' type='prismatic'>"
+    "  <parent link='l4'/> <child link='l5'/>"
+    "  <origin xyz='0.05 0 0' rpy='0 -0.4 0'/> <axis xyz='1 0 0'/>"
+    " </joint>"
+    " <joint name='j6' type='fixed'>"
+    "  <parent link='l5'/> <child link='tool'/>"
+    "  <origin xyz='0 0 0.05' rpy='0 0 0'/>"
+    " </joint>"
+    " <joint name='jm' type='revolute'>"
+    "  <parent link='base'/> <child link='m1'/>"
+    "  <origin xyz='0 0.2 0' rpy='0 0 0'/> <axis xyz='0 0 1'/>"
+    "  <mimic joint='j1' multiplier='-2' offset='0.5'/>"
+    " </joint>"
+    "</robot>";
+
+Math::KinematicModel makeModel(const std::string &xml) {
+  std::istringstream is(xml);
+  urdf::ptree pt;
+  boost::property_tree::xml_parser::read_xml(is, pt);
+  urdf::RobotTree tree(pt.get_child("robot"));
+  return Math::KinematicModel(tree);
+}
+}
+
+TEST(KinematicModel, structure) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  ASSERT_EQ(8u, model.linkCount());
+  ASSERT_EQ(5u, model.variableCount());
+  EXPECT_EQ("base", model.linkName(0));
+  EXPECT_EQ(-1, model.parent(0));
+  EXPECT_EQ("", model.jointName(0));
+  for (std::size_t i = 1u; i < model.linkCount(); ++i) {
+    EXPECT_LT(model.parent(i), static_cast<int>(i));
+  }
+  EXPECT_EQ(model.linkIndex("l4"),
+            static_cast<std::size_t>(model.parent(model.linkIndex("l5"))));
+  EXPECT_THROW(model.linkIndex("nope"), std::runtime_error);
+
+  const std::size_t l1 = model.linkIndex("l1");
+  const std::size_t l2 = model.linkIndex("l2");
+  EXPECT_EQ("j1", model.jointName(l1));
+  EXPECT_EQ(Math::KinematicModel::JOINT_RZ, model.jointType(l1));
+  EXPECT_EQ(Math::KinematicModel::JOINT_RX, model.jointType(l2));
+  EXPECT_EQ(-1.0f, model.jointMultiplier(l2));
+  EXPECT_EQ(Math::KinematicModel::JOINT_RY,
+            model.jointType(model.linkIndex("l3")));
+  EXPECT_EQ(Math::KinematicModel::JOINT_REVOLUTE,
+            model.jointType(model.linkIndex("l4")));
+  EXPECT_EQ(Math::KinematicModel::JOINT_PRISMATIC,
+            model.jointType(model.linkIndex("l5")));
+  EXPECT_EQ(Math::KinematicModel::JOINT_FIXED,
+            model.jointType(model.linkIndex("tool")));
+  EXPECT_EQ(-1, model.jointVariable(model.linkIndex("tool")));
+
+  const std::size_t m1 = model.linkIndex("m1");
+  EXPECT_EQ(model.jointVariable(l1), model.jointVariable(m1));
+  EXPECT_EQ(-2.0f, model.jointMultiplier(m1));
+  EXPECT_EQ(0.5f, model.jointOffset(m1));
+  EXPECT_EQ(0u, model.variableIndex("j1"));
+  EXPECT_EQ("j5", model.variableName(4u));
+  EXPECT_THROW(model.variableIndex("jm"), std::runtime_error);
+  EXPECT_THROW(model.variableIndex("j6"), std::runtime_error);
+
+  EXPECT_EQ(-2.0f, model.variableLower(0u));
+  EXPECT_EQ(2.0f, model.variableUpper(0u));
+  EXPECT_EQ(-1.2f, model.variableLower(model.variableIndex("j3")));
+  EXPECT_TRUE(std::isinf(model.variableLower(model.variableIndex("j2"))));
+  EXPECT_TRUE(std::isinf(model.variableUpper(model.variableIndex("j4"))));
+}
+
+TEST(KinematicModel, forwardKinematics) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  const std::vector<float> q = {0.3f, -0.7f, 1.1f, 0.4f, 0.02f};
+  std::vector<Transform> poses;
+  model.forwardKinematics(q, poses);
+  ASSERT_EQ(model.linkCount(), poses.size());
+  EXPECT_TRUE(poses[0] == Transform());
+
+  // the same with the eager products of Transform
+  const Transform t1 =
+      Transform(0.0f, 0.0f, 0.1f) * Transform::fromRotZ(q[0]);
+  const Transform t2 = t1 *
+                       Transform::fromPosition(0.1f, 0.0f, 0.2f, 0.1f, 0.2f,
+                                               0.3f) *
+                       Transform::fromRotX(-q[1]);
+  const Transform t3 = t2 *
+                       Transform::fromPosition(0.0f, 0.3f, 0.0f, 0.0f, 0.0f,
+                                               1.5707963f) *
+                       Transform::fromRotY(q[2]);
+  const Transform t4 =
+      t3 * Transform(0.0f, 0.0f, 0.15f) *
+      Math::transformFromRotation(
+          Math::Rotation::fromAngleDirection(q[3], 0.0f, 0.6f, 0.8f));
+  const Transform t5 =
+      t4 *
+      Transform::fromPosition(0.05f, 0.0f, 0.0f, 0.0f, -0.4f, 0.0f) *
+      Transform(q[4], 0.0f, 0.0f);
+  const Transform tool = t5 * Transform(0.0f, 0.0f, 0.05f);
+  const Transform m1 =
+      Transform(0.0f, 0.2f, 0.0f) * Transform::fromRotZ(-2.0f * q[0] + 0.5f);
+
+  EXPECT_TRUE(poses[model.linkIndex("l1")].isNear(t1, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("l2")].isNear(t2, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("l3")].isNear(t3, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("l4")].isNear(t4, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("l5")].isNear(t5, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("tool")].isNear(tool, 1e-5f));
+  EXPECT_TRUE(poses[model.linkIndex("m1")].isNear(m1, 1e-5f));
+
+  EXPECT_THROW(model.forwardKinematics(std::vector<float>(4u, 0.0f), poses),
+               std::runtime_error);
+}
+
+TEST(KinematicModel, subtrees) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  EXPECT_EQ(model.linkCount(), model.subtreeEnd(0));
+  for (std::size_t link = 0u; link < model.linkCount(); ++link) {
+    for (std::size_t other = 0u; other < model.linkCount(); ++other) {
+      // other is in the subtree of link iff link is one of its ancestors
+      bool descendant = false;
+      for (int i = static_cast<int>(other); i >= 0; i = model.parent(i)) {
+        descendant = descendant || (i == static_cast<int>(link));
+      }
+      EXPECT_EQ(descendant, link <= other && other < model.subtreeEnd(link));
+    }
+  }
+}
+
+TEST(KinematicState, incremental) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  Math::KinematicState state(model);
+  EXPECT_FALSE(state.dirty());
+
+  std::vector<float> q(model.variableCount(), 0.0f);
+  std::vector<Transform> poses;
+  model.forwardKinematics(q, poses);
+  for (std::size_t link = 0u; link < model.linkCount(); ++link) {
+    EXPECT_TRUE(poses[link] == state.pose(link));
+  }
+
+  // the prismatic joint only moves l5 and the tool
+  state.setVariable(model.variableIndex("j5"), 0.1f);
+  EXPECT_TRUE(state.dirty());
+  const Transform l3 = state.pose(model.linkIndex("l3"));
+  EXPECT_TRUE(state.dirty());
+  EXPECT_EQ(2u, state.update());
+  EXPECT_FALSE(state.dirty());
+  EXPECT_TRUE(l3 == state.pose(model.linkIndex("l3")));
+  EXPECT_EQ(0u, state.update());
+
+  // setting the same value does nothing
+  state.setVariable(model.variableIndex("j5"), 0.1f);
+  EXPECT_FALSE(state.dirty());
+
+  // j1 drives l1 and its subtree, and m1 which mimics it
+  state.setVariable(model.variableIndex("j1"), 0.2f);
+  state.setVariable(model.variableIndex("j3"), -0.4f);
+  EXPECT_EQ(model.linkCount() - 1u, state.update());
+
+  // any sequence of updates gives the poses of a full computation
+  const float values[] = {0.3f, -1.2f, 0.7f, 0.05f, 2.1f, -0.3f};
+  for (int step = 0; step < 40; ++step) {
+    const std::size_t v = (7u * step + step / 3) % model.variableCount();
+    state.setVariable(v, values[step % 6] + 0.01f * step);
+    if (step % 3 == 0) {
+      state.pose(model.linkIndex("tool"));
+    }
+    if (step % 5 == 0) {
+      state.update();
+    }
+  }
+  model.forwardKinematics(state.variables(), poses);
+  for (std::size_t link = 0u; link < model.linkCount(); ++link) {
+    EXPECT_TRUE(poses[link] == state.pose(link));
+  }
+  EXPECT_TRUE(poses == state.poses());
+
+  EXPECT_THROW(state.setVariables(std::vector<float>(2u, 0.0f)),
+               std::runtime_error);
+  state.setVariables(q);
+  model.forwardKinematics(q, poses);
+  EXPECT_TRUE(poses == state.poses());
+}
+
+TEST(KinematicModel, batchForwardKinematics) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  const std::size_t n = model.variableCount();
+  // 1543 configurations are 7 blocks of 256, for 3 threads of 2 blocks or
+  // more, the last block not a multiple of the lanes of TransformBatch
+  for (std::size_t count : {0u, 21u, 300u, 1543u}) {
+    std::vector<float> q(count * n);
+    for (std::size_t i = 0u; i < q.size(); ++i) {
+      q[i] = 1.5f * std::sin(0.37f * i);
+    }
+    std::vector<std::vector<Transform>> expected(count);
+    for (std::size_t k = 0u; k < count; ++k) {
+      expected[k].resize(model.linkCount());
+      model.forwardKinematics(q.data() + k * n, expected[k].data());
+    }
+    // a reused vector, whose first batch is larger than the others
+    std::vector<Math::TransformBatch> poses(1u, Math::TransformBatch(5000u));
+    std::vector<std::vector<Transform>> single;
+    for (unsigned int threads : {1u, 3u}) {
+      model.forwardKinematics(q.data(), count, poses, threads);
+      ASSERT_EQ(model.linkCount(), poses.size());
+      for (std::size_t link = 0u; link < model.linkCount(); ++link) {
+        ASSERT_EQ(count, poses[link].size());
+        for (std::size_t k = 0u; k < count; ++k) {
+          // the Transform kernels may fuse the multiply-adds
+          EXPECT_TRUE(expected[k][link].isNear(poses[link].get(k), 1e-5f));
+        }
+      }
+      // the very same poses with any number of threads
+      std::vector<std::vector<Transform>> result(poses.size());
+      for (std::size_t link = 0u; link < poses.size(); ++link) {
+        result[link] = poses[link].toVector();
+      }
+      if (single.empty()) {
+        single = result;
+      }
+      ASSERT_EQ(single.size(), result.size());
+      for (std::size_t link = 0u; link < result.size(); ++link) {
+        for (std::size_t k = 0u; k < count; ++k) {
+          EXPECT_EQ(0, std::memcmp(&single[link][k], &result[link][k],
+                                   sizeof(Transform)))
+              << link << " " << k << " " << threads;
+        }
+      }
+    }
+  }
+}
+
+TEST(KinematicModel, jacobian) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  const std::size_t n = model.variableCount();
+  const std::vector<float> q = {0.3f, -0.7f, 1.1f, 0.4f, 0.02f};
+  std::vector<Transform> poses;
+  model.forwardKinematics(q, poses);
+
+  const Math::KinematicModel::JacobianFrame frames[] = {
+      Math::KinematicModel::JACOBIAN_WORLD,
+      Math::KinematicModel::JACOBIAN_LOCAL,
+      Math::KinematicModel::JACOBIAN_MIXED};
+  for (std::size_t link = 0u; link < model.linkCount(); ++link) {
+    const Transform &t = poses[link];
+    for (Math::KinematicModel::JacobianFrame frame : frames) {
+      std::vector<float> jacobian(6u * n, 1.0f);
+      model.jacobian(poses.data(), link, frame, jacobian.data());
+      for (std::size_t v = 0u; v < n; ++v) {
+        // central differences of the pose
+        const float eps = 1e-3f;
+        std::vector<float> qp = q, qm = q;
+        qp[v] += eps;
+        qm[v] -= eps;
+        std::vector<Transform> pp, pm;
+        model.forwardKinematics(qp, pp);
+        model.forwardKinematics(qm, pm);
+        const std::vector<float> a = pp[link].toVector();
+        const std::vector<float> b = pm[link].toVector();
+        const std::vector<float> r = t.toVector();
+        float d[12];
+        for (int k = 0; k < 12; ++k) d[k] = a[k] - b[k];
+        const float dp[3] = {d[3] / (2 * eps), d[7] / (2 * eps),
+                             d[11] / (2 * eps)};
+        // the angular velocity in the root frame, from dR * R^T
+        float w[3][3];
+        for (int i = 0; i < 3; ++i) {
+          for (int j = 0; j < 3; ++j) {
+            w[i][j] = d[4 * i] * r[4 * j] + d[4 * i + 1] * r[4 * j + 1] +
+                      d[4 * i + 2] * r[4 * j + 2];
+          }
+        }
+        const float dw[3] = {(w[2][1] - w[1][2]) / (4 * eps),
+                             (w[0][2] - w[2][0]) / (4 * eps),
+                             (w[1][0] - w[0][1]) / (4 * eps)};
+        float expected[6] = {dp[0], dp[1], dp[2], dw[0], dw[1], dw[2]};
+        if (frame == Math::KinematicModel::JACOBIAN_WORLD) {
+          // the velocity of the point at the origin: dp - w x p
+          expected[0] -= dw[1] * t.r3_c4 - dw[2] * t.r2_c4;
+          expected[1] -= dw[2] * t.r1_c4 - dw[0] * t.r3_c4;
+          expected[2] -= dw[0] * t.r2_c4 - dw[1] * t.r1_c4;
+        } else if (frame == Math::KinematicModel::JACOBIAN_LOCAL) {
+          const float l[6] = {
+              t.r1_c1 * dp[0] + t.r2_c1 * dp[1] + t.r3_c1 * dp[2],
+              t.r1_c2 * dp[0] + t.r2_c2 * dp[1] + t.r3_c2 * dp[2],
+              t.r1_c3 * dp[0] + t.r2_c3 * dp[1] + t.r3_c3 * dp[2],
+              t.r1_c1 * dw[0] + t.r2_c1 * dw[1] + t.r3_c1 * dw[2],
+              t.r1_c2 * dw[0] + t.r2_c2 * dw[1] + t.r3_c2 * dw[2],
+              t.r1_c3 * dw[0] + t.r2_c3 * dw[1] + t.r3_c3 * dw[2]};
+          std::copy(l, l + 6, expected);
+        }
+        for (int k = 0; k < 6; ++k) {
+          EXPECT_NEAR(expected[k], jacobian[6u * v + k], 2e-3f)
+              << model.linkName(link) << " frame " << frame << " variable "
+              << v << " row " << k;
+        }
+      }
+    }
+  }
+
+  // the mimic joint adds up to the column of j1
+  std::vector<float> jacobian(6u * n);
+  model.jacobian(poses.data(), model.linkIndex("m1"),
+                 Math::KinematicModel::JACOBIAN_MIXED, jacobian.data());
+  EXPECT_FLOAT_EQ(-2.0f, jacobian[6u * model.variableIndex("j1") + 5u]);
+
+  // batches of configurations
+  const std::size_t count = 3u;
+  std::vector<float> qs;
+  for (std::size_t k = 0u; k < count; ++k) {
+    for (std::size_t v = 0u; v < n; ++v) qs.push_back(q[v] + 0.1f * k);
+  }
+  std::vector<Transform> batchPoses(count * model.linkCount());
+  std::vector<float> jacobians(count * 6u * n);
+  const std::size_t tool = model.linkIndex("tool");
+  model.jacobians(qs.data(), count, tool,
+                  Math::KinematicModel::JACOBIAN_LOCAL, batchPoses.data(),
+                  jacobians.data());
+  for (std::size_t k = 0u; k < count; ++k) {
+    model.forwardKinematics(qs.data() + k * n, poses.data());
+    model.jacobian(poses.data(), tool, Math::KinematicModel::JACOBIAN_LOCAL,
+                   jacobian.data());
+    EXPECT_TRUE(std::equal(poses.begin(), poses.end(),
+                           batchPoses.begin() + k * model.linkCount()));
+    EXPECT_TRUE(std::equal(jacobian.begin(), jacobian.end(),
+                           jacobians.begin() + k * 6u * n));
+  }
+
+  // from the cached poses of a state
+  Math::KinematicState state(model);
+  state.setVariables(q);
+  state.jacobian(tool, Math::KinematicModel::JACOBIAN_WORLD, jacobian.data());
+  std::vector<float> expected(6u * n);
+  model.forwardKinematics(q, poses);
+  model.jacobian(poses.data(), tool, Math::KinematicModel::JACOBIAN_WORLD,
+                 expected.data());
+  EXPECT_TRUE(jacobian == expected);
+}
+
+TEST(InverseKinematics, solve) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  const std::size_t n = model.variableCount();
+  const std::size_t tool = model.linkIndex("tool");
+  Math::InverseKinematics ik(model);
+
+  // a reachable target, from a guess nearby
+  const std::vector<float> solution = {0.3f, -0.7f, 1.1f, 0.4f, 0.02f};
+  std::vector<Transform> poses;
+  model.forwardKinematics(solution, poses);
+  const Transform target = poses[tool];
+  std::vector<float> q = {0.1f, -0.4f, 0.8f, 0.6f, 0.0f};
+  Math::InverseKinematics::Result result = ik.solve(target, tool, q);
+  EXPECT_TRUE(result.converged);
+  EXPECT_GT(result.iterations, 0);
+  EXPECT_LE(result.error, ik.options().tolerance);
+  model.forwardKinematics(q, poses);
+  EXPECT_TRUE(poses[tool].isNear(target, 1e-3f));
+
+  // a warm start from the solution converges at once
+  result = ik.solve(target, tool, q);
+  EXPECT_TRUE(result.converged);
+  EXPECT_EQ(0, result.iterations);
+
+  // the position only, for a target with another orientation
+  Math::InverseKinematics::Options options;
+  options.rotationWeight = 0.0f;
+  ik.setOptions(options);
+  const Transform rotated =
+      target * Math::velocityExponential(
+                   Math::Velocity6D(0.0f, 0.0f, 0.0f, 0.4f, -0.3f, 0.2f));
+  q.assign(n, 0.0f);
+  result = ik.solve(rotated, tool, q);
+  EXPECT_TRUE(result.converged);
+  model.forwardKinematics(q, poses);
+  EXPECT_NEAR(target.r1_c4, poses[tool].r1_c4, 1e-3f);
+  EXPECT_NEAR(target.r2_c4, poses[tool].r2_c4, 1e-3f);
+  EXPECT_NEAR(target.r3_c4, poses[tool].r3_c4, 1e-3f);
+
+  // a target out of the limits of j3: the variables stay in their limits
+  ik.setOptions(Math::InverseKinematics::Options());
+  const std::vector<float> outside = {0.3f, -0.7f, 1.6f, 0.4f, 0.02f};
+  model.forwardKinematics(outside, poses);
+  q = solution;
+  result = ik.solve(poses[tool], tool, q);
+  EXPECT_FALSE(result.converged);
+  EXPECT_EQ(ik.options().maxIterations, result.iterations);
+  for (std::size_t v = 0u; v < n; ++v) {
+    EXPECT_LE(model.variableLower(v), q[v]);
+    EXPECT_GE(model.variableUpper(v), q[v]);
+  }
+
+  std::vector<float> wrong(2u, 0.0f);
+  EXPECT_THROW(ik.solve(target, tool, wrong), std::runtime_error);
+  EXPECT_THROW(ik.solve(target, model.linkCount(), q), std::runtime_error);
+  EXPECT_THROW(ik.solve(target, model.linkCount(), q.data()),
+               std::runtime_error);
+  Math::InverseKinematics::Result batchResult;
+  EXPECT_THROW(ik.solve(&target, 1u, model.linkCount(), q.data(),
+                        &batchResult),
+               std::runtime_error);
+}
+
+TEST(InverseKinematics, undamped) {
+  // 3 variables: J J^T is singular, and more so for the position only
+  const std::string arm =
+      "<robot name='arm'>"
+      " <link name='a'/> <link name='b'/> <link name='c'/> <link name='d'/>"
+      " <joint name='j1' type='continuous'>"
+      "  <parent link='a'/> <child link='b'/>"
+      "  <origin xyz='0 0 0.1' rpy='0 0 0'/> <axis xyz='0 0 1'/>"
+      " </joint>"
+      " <joint name='j2' type='continuous'>"
+      "  <parent link='b'/> <child link='c'/>"
+      "  <origin xyz='0 0 0.2' rpy='0 0 0'/> <axis xyz='0 1 0'/>"
+      " </joint>"
+      " <joint name='j3' type='continuous'>"
+      "  <parent link='c'/> <child link='d'/>"
+      "  <origin xyz='0.3 0 0' rpy='0 0 0'/> <axis xyz='0 1 0'/>"
+      " </joint>"
+      "</robot>";
+  const Math::KinematicModel model = makeModel(arm);
+  const std::size_t tip = model.linkIndex("d");
+  const std::vector<float> solution = {0.4f, -0.6f, 0.9f};
+  std::vector<Transform> poses;
+  model.forwardKinematics(solution, poses);
+  const Transform target = poses[tip];
+
+  Math::InverseKinematics::Options options;
+  options.damping = 0.0f;
+  for (float weight : {0.0f, 1.0f}) {
+    options.rotationWeight = weight;
+    Math::InverseKinematics ik(model, options);
+    std::vector<float> q = {0.2f, -0.3f, 0.6f};
+    const Math::InverseKinematics::Result result = ik.solve(target, tip, q);
+    EXPECT_TRUE(result.converged) << weight;
+    EXPECT_TRUE(std::isfinite(result.error)) << weight;
+    for (float v : q) EXPECT_TRUE(std::isfinite(v)) << weight;
+    model.forwardKinematics(q, poses);
+    EXPECT_NEAR(target.r1_c4, poses[tip].r1_c4, 1e-3f) << weight;
+    EXPECT_NEAR(target.r2_c4, poses[tip].r2_c4, 1e-3f) << weight;
+    EXPECT_NEAR(target.r3_c4, poses[tip].r3_c4, 1e-3f) << weight;
+  }
+}
+
+TEST(InverseKinematics, batch) {
+  const Math::KinematicModel model = makeModel(kUrdf);
+  const std::size_t n = model.variableCount();
+  const std::size_t tool = model.linkIndex("tool");
+  const std::size_t count = 100u;
+  std::vector<Transform> targets(count);
+  std::vector<float> guesses(count * n);
+  std::vector<Transform> poses;
+  for (std::size_t k = 0u; k < count; ++k) {
+    std::vector<float> q(n);
+    for (std::size_t v = 0u; v < n; ++v) {
+      q[v] = 0.5f * std::sin(0.7f * k + 1.3f * v);
+      guesses[k * n + v] = q[v] + 0.2f * std::cos(1.1f * k + v);
+    }
+    q[4] *= 0.1f;
+    model.forwardKinematics(q, poses);
+    targets[k] = poses[tool];
+  }
+
+  // the same results as the single solves, with any number of threads
+  std::vector<float> expected = guesses;
+  std::vector<Math::InverseKinematics::Result> expectedResults(count);
+  Math::InverseKinematics ik(model);
+  for (std::size_t k = 0u; k < count; ++k) {
+    expectedResults[k] = ik.solve(targets[k], tool, &expected[k * n]);
+  }
+  for (unsigned int threads : {1u, 4u}) {
+    std::vector<float> q = guesses;
+    std::vector<Math::InverseKinematics::Result> results(count);
+    ik.solve(targets.data(), count, tool, q.data(), results.data(), threads);
+    EXPECT_TRUE(q == expected);
+    for (std::size_t k = 0u; k < count; ++k) {
+      EXPECT_EQ(expectedResults[k].converged, results[k].converged);
+      EXPECT_EQ(expectedResults[k].iterations, results[k].iterations);
+    }
+  }
+}
+
+TEST(KinematicModel, mimicLimits) {
+  // the position of m is -2 * q + 0.5, of n 4 * q - 0.9
+  const std::string head =
+      "<robot name='test'>"
+      " <link name='a'/> <link name='b'/> <link name='m'/> <link name='n'/>"
+      " <joint name='j' type='revolute'>"
+      "  <parent link='a'/> <child link='b'/> <axis xyz='0 0 1'/>"
+      "  <limit lower='-2' upper='2'/>"
+      " </joint>"
+      " <joint name='jm' type='revolute'>"
+      "  <parent link='a'/> <child link='m'/> <axis xyz='0 0 1'/>"
+      "  <mimic joint='j' multiplier='-2' offset='0.5'/>";
+  const std::string tail =
+      " </joint>"
+      " <joint name='jn' type='prismatic'>"
+      "  <parent link='a'/> <child link='n'/> <axis xyz='1 0 0'/>"
+      "  <mimic joint='jm' multiplier='-2' offset='0.1'/>"
+      "  <limit lower='-3' upper='0.7'/>"
+      " </joint>"
+      "</robot>";
+
+  // jm restricts j to [-0.5, 1], then jn to [-0.5, 0.4]
+  Math::KinematicModel model =
+      makeModel(head + "  <limit lower='-1.5' upper='1.5'/>" + tail);
+  ASSERT_EQ(1u, model.variableCount());
+  EXPECT_FLOAT_EQ(-0.5f, model.variableLower(0u));
+  EXPECT_FLOAT_EQ(0.4f, model.variableUpper(0u));
+
+  // without limit, jm leaves j to jn: [-0.525, 0.4]
+  model = makeModel(head + tail);
+  EXPECT_FLOAT_EQ(-0.525f, model.variableLower(0u));
+  EXPECT_FLOAT_EQ(0.4f, model.variableUpper(0u));
+
+  // the inverse kinematics keep the mimic joints in their limits
+  std::vector<Transform> poses;
+  model.forwardKinematics(std::vector<float>(1u, 1.5f), poses);
+  Math::InverseKinematics ik(model);
+  std::vector<float> q(1u, 0.0f);
+  ik.solve(poses[model.linkIndex("n")], model.linkIndex("n"), q);
+  EXPECT_FLOAT_EQ(0.4f, q[0]);
+
+  // limits which leave no value
+  EXPECT_THROW(
+      makeModel(head + "  <limit lower='2' upper='3'/>" + tail),
+      std::runtime_error);
+}
+
+TEST(KinematicModel, unsupported) {
+  const std::string floating =
+      "<robot name='test'>"
+      " <link name='a'/> <link name='b'/>"
+      " <joint name='j' type='floating'>"
+      "  <parent link='a'/> <child link='b'/>"
+      " </joint>"
+      "</robot>";
+  EXPECT_THROW(makeModel(floating), std::runtime_error);
+  const std::string nullAxis =
+      "<robot name='test'>"
+      " <link name='a'/> <link name='b'/>"
+      " <joint name='j' type='revolute'>"
+      "  <parent link='a'/> <child link='b'/> <axis xyz='0 0 0'/>"
+      " </joint>"
+      "</robot>";
+  EXPECT_THROW(makeModel(nullAxis), std::runtime_error);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/tools/alerrorpolicy.h>
+#include <almath/types/alposition3d.h>
+#include <almath/types/alrotation.h>
+#include <almath/types/altransform.h>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  std::vector<AL::Math::ErrorKind> gKinds;
+  std::vector<std::string> gMessages;
+
+  void recordError(AL::Math::ErrorKind pKind, const char* pMessage)
+  {
+    gKinds.push_back(pKind);
+    gMessages.push_back(pMessage);
+  }
+
+  // restore the default policies after each test
+  class ALErrorPolicyTest : public ::testing::Test
+  {
+  protected:
+    void SetUp()
+    {
+      AL::Math::resetErrorCounts();
+      gKinds.clear();
+      gMessages.clear();
+    }
+
+    void TearDown()
+    {
+      AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_WARN);
+      AL::Math::setThreadErrorPolicy(AL::Math::ERROR_POLICY_GLOBAL);
+      AL::Math::setErrorCallback(NULL);
+    }
+  };
+
+  // the standard error output written while calling pFunction
+  template <class F>
+  std::string captureCerr(F pFunction)
+  {
+    std::ostringstream lStream;
+    std::streambuf* lPrevious = std::cerr.rdbuf(lStream.rdbuf());
+    pFunction();
+    std::cerr.rdbuf(lPrevious);
+    return lStream.str();
+  }
+}
+
+TEST_F(ALErrorPolicyTest, warn)
+{
+  EXPECT_EQ(AL::Math::ERROR_POLICY_WARN, AL::Math::errorPolicy());
+  const std::string lOutput = captureCerr([]()
+  {
+    EXPECT_EQ(AL::Math::Position3D(),
+              AL::Math::Position3D(std::vector<float>(2, 1.0f)));
+  });
+  EXPECT_EQ("ALMath: WARNING: Position3D constructor call with a wrong size "
+            "of vector. Size expected: 3. Size given: 2. Position3D is set to "
+            "default value.\n", lOutput);
+  EXPECT_EQ(1u, AL::Math::errorCount(AL::Math::ERROR_WRONG_SIZE));
+  EXPECT_EQ(0u, AL::Math::errorCount(AL::Math::ERROR_NOT_NORMALIZABLE));
+}
+
+TEST_F(ALErrorPolicyTest, ignore)
+{
+  EXPECT_EQ(AL::Math::ERROR_POLICY_WARN,
+            AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_IGNORE));
+  const std::string lOutput = captureCerr([]()
+  {
+    AL::Math::Transform(std::vector<float>(5, 1.0f));
+    AL::Math::Rotation(std::vector<float>(4, 1.0f));
+    AL::Math::Transform lT =
+        AL::Math::Transform::fromPosition(1.0f, 2.0f, 3.0f);
+    lT.r1_c1 = 0.0f;
+    lT.r2_c1 = 0.0f;
+    lT.r3_c3 = 0.0f;
+    AL::Math::normalizeTransform(lT);
+  });
+  EXPECT_EQ("", lOutput);
+  EXPECT_EQ(2u, AL::Math::errorCount(AL::Math::ERROR_WRONG_SIZE));
+  EXPECT_EQ(1u, AL::Math::errorCount(AL::Math::ERROR_NOT_NORMALIZABLE));
+
+  AL::Math::resetErrorCounts();
+  EXPECT_EQ(0u, AL::Math::errorCount(AL::Math::ERROR_WRONG_SIZE));
+  EXPECT_EQ(0u, AL::Math::errorCount(AL::Math::ERROR_NOT_NORMALIZABLE));
+  EXPECT_THROW(AL::Math::errorCount(AL::Math::ERROR_KIND_COUNT),
+               std::runtime_error);
+}
+
+TEST_F(ALErrorPolicyTest, callback)
+{
+  AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_CALLBACK);
+  // no callback: ignored
+  AL::Math::Position3D(std::vector<float>(2, 1.0f));
+  EXPECT_EQ(NULL, AL::Math::setErrorCallback(&recordError));
+
+  AL::Math::Transform(std::vector<float>(5, 1.0f));
+  std::vector<float> lTransform;
+  AL::Math::transformToFloatVector(AL::Math::Transform(), lTransform);
+  ASSERT_EQ(2u, gKinds.size());
+  EXPECT_EQ(AL::Math::ERROR_WRONG_SIZE, gKinds[0]);
+  EXPECT_EQ("Transform constructor call with a wrong size of vector. "
+            "Size expected: 12 or 16. Size given: 5. "
+            "Transform is set to identity.", gMessages[0]);
+  EXPECT_EQ(AL::Math::ERROR_DEPRECATED, gKinds[1]);
+  EXPECT_EQ(2u, AL::Math::errorCount(AL::Math::ERROR_WRONG_SIZE));
+  EXPECT_EQ(1u, AL::Math::errorCount(AL::Math::ERROR_DEPRECATED));
+}
+
+TEST_F(ALErrorPolicyTest, throwAndThread)
+{
+  EXPECT_THROW(AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_GLOBAL),
+               std::runtime_error);
+  AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_THROW);
+  EXPECT_THROW(AL::Math::Position3D(std::vector<float>(4, 1.0f)),
+               std::runtime_error);
+  EXPECT_FLOAT_EQ(1.0f, AL::Math::determinant(AL::Math::Transform()));
+  EXPECT_THROW(AL::Math::determinant(std::vector<float>(3, 1.0f)),
+               std::runtime_error);
+
+  // the policy of the thread takes precedence
+  EXPECT_EQ(AL::Math::ERROR_POLICY_GLOBAL,
+            AL::Math::setThreadErrorPolicy(AL::Math::ERROR_POLICY_IGNORE));
+  EXPECT_EQ(AL::Math::ERROR_POLICY_IGNORE, AL::Math::errorPolicy());
+  EXPECT_NO_THROW(AL::Math::Position3D(std::vector<float>(4, 1.0f)));
+
+  // other threads keep the global policy, and share the counters
+  bool lThrown = false;
+  std::thread lThread([&lThrown]()
+  {
+    try
+    {
+      AL::Math::Position3D(std::vector<float>(4, 1.0f));
+    }
+    catch (const std::runtime_error&)
+    {
+      lThrown = true;
+    }
+  });
+  lThread.join();
+  EXPECT_TRUE(lThrown);
+  EXPECT_EQ(4u, AL::Math::errorCount(AL::Math::ERROR_WRONG_SIZE));
+
+  EXPECT_EQ(AL::Math::ERROR_POLICY_IGNORE,
+            AL::Math::setThreadErrorPolicy(AL::Math::ERROR_POLICY_GLOBAL));
+  EXPECT_EQ(AL::Math::ERROR_POLICY_THROW, AL::Math::errorPolicy());
+}
+
+TEST_F(ALErrorPolicyTest, normalized)
+{
+  // the normalizations are counted, never reported
+  AL::Math::setErrorPolicy(AL::Math::ERROR_POLICY_THROW);
+  std::vector<float> lFloats = AL::Math::Transform::fromRotZ(0.3f).toVector();
+  EXPECT_TRUE(AL::Math::Transform(lFloats).isNear(
+                AL::Math::Transform::fromRotZ(0.3f), 1e-6f));
+  EXPECT_EQ(0u, AL::Math::errorCount(AL::Math::ERROR_NORMALIZED));
+
+  lFloats[0] *= 1.1f;
+  const AL::Math::Transform lNormalized(lFloats);
+  EXPECT_TRUE(lNormalized.isTransform());
+  EXPECT_EQ(1u, AL::Math::errorCount(AL::Math::ERROR_NORMALIZED));
+
+  // the unchecked construction keeps the floats as they are
+  const AL::Math::Transform lUnchecked =
+      AL::Math::Transform::fromFloatsUnchecked(lFloats.data());
+  EXPECT_EQ(lFloats[0], lUnchecked.r1_c1);
+  EXPECT_EQ(lFloats[11], lUnchecked.r3_c4);
+  EXPECT_FALSE(lUnchecked.isTransform());
+  EXPECT_EQ(1u, AL::Math::errorCount(AL::Math::ERROR_NORMALIZED));
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/tools/alfastmath.h>
+#include <almath/tools/alsimd.h>
+#include <almath/tools/altrigonometry.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  // angles in [-pMax, pMax], denser around 0
+  std::vector<float> makeAngles(float pMax)
+  {
+    std::vector<float> lAngles;
+    for (int i = -100000; i <= 100000; ++i)
+    {
+      const float f = static_cast<float>(i) * 1e-5f;
+      lAngles.push_back(pMax * f * std::abs(f));
+    }
+    return lAngles;
+  }
+
+  // points on circles of several radii
+  void makePoints(std::vector<float>& pY, std::vector<float>& pX)
+  {
+    const float lRadii[4] = {1e-30f, 1e-3f, 1.0f, 1e20f};
+    for (int r = 0; r < 4; ++r)
+    {
+      for (int i = 0; i < 20000; ++i)
+      {
+        const double lAngle = -AL::Math::PI + 1e-4*AL::Math::PI*i;
+        pY.push_back(lRadii[r] * static_cast<float>(std::sin(lAngle)));
+        pX.push_back(lRadii[r] * static_cast<float>(std::cos(lAngle)));
+      }
+    }
+  }
+}
+
+TEST(ALFastMathTest, sinCos)
+{
+  const std::vector<float> lAngles = makeAngles(8192.0f);
+  double lMaxError = 0.0;
+  for (std::size_t i = 0u; i < lAngles.size(); ++i)
+  {
+    float lSin, lCos;
+    AL::Math::fastSinCos(lAngles[i], lSin, lCos);
+    const double lAngle = static_cast<double>(lAngles[i]);
+    lMaxError = std::max(lMaxError, std::abs(lSin - std::sin(lAngle)));
+    lMaxError = std::max(lMaxError, std::abs(lCos - std::cos(lAngle)));
+    EXPECT_EQ(lSin, AL::Math::fastSin(lAngles[i]));
+    EXPECT_EQ(lCos, AL::Math::fastCos(lAngles[i]));
+  }
+  EXPECT_LT(lMaxError, 1.2e-7);
+
+  // outside of the range of the polynomial
+  float lSin, lCos;
+  AL::Math::fastSinCos(1e6f, lSin, lCos);
+  EXPECT_EQ(std::sin(1e6f), lSin);
+  EXPECT_EQ(std::cos(1e6f), lCos);
+  AL::Math::fastSinCos(std::numeric_limits<float>::infinity(), lSin, lCos);
+  EXPECT_TRUE(std::isnan(lSin));
+  EXPECT_TRUE(std::isnan(lCos));
+}
+
+TEST(ALFastMathTest, atan2)
+{
+  std::vector<float> lY;
+  std::vector<float> lX;
+  makePoints(lY, lX);
+  double lMaxError = 0.0;
+  double lMaxApproxError = 0.0;
+  for (std::size_t i = 0u; i < lY.size(); ++i)
+  {
+    const double lExpected = std::atan2(static_cast<double>(lY[i]),
+                                        static_cast<double>(lX[i]));
+    lMaxError = std::max(lMaxError, std::abs(
+                           AL::Math::fastAtan2(lY[i], lX[i]) - lExpected));
+    lMaxApproxError = std::max(lMaxApproxError, std::abs(
+                                 AL::Math::approxAtan2(lY[i], lX[i]) -
+                                 lExpected));
+  }
+  EXPECT_LT(lMaxError, 3.5e-7);
+  EXPECT_LT(lMaxApproxError, 1.2e-5);
+
+  // signed zeros and infinities, as std::atan2
+  const float lInf = std::numeric_limits<float>::infinity();
+  const float lSpecial[5] = {0.0f, -0.0f, 1.0f, lInf, -lInf};
+  for (int i = 0; i < 5; ++i)
+  {
+    for (int j = 0; j < 5; ++j)
+    {
+      const float lExpected = std::atan2(lSpecial[i], lSpecial[j]);
+      const float lFast = AL::Math::fastAtan2(lSpecial[i], lSpecial[j]);
+      EXPECT_NEAR(lExpected, lFast, 3.5e-7f) << i << " " << j;
+      EXPECT_EQ(std::signbit(lExpected), std::signbit(lFast)) << i << " " << j;
+      EXPECT_NEAR(lExpected, AL::Math::approxAtan2(lSpecial[i], lSpecial[j]),
+                  1.2e-5f);
+    }
+  }
+  EXPECT_TRUE(std::isnan(AL::Math::fastAtan2(
+                           std::numeric_limits<float>::quiet_NaN(), 1.0f)));
+}
+
+TEST(ALFastMathTest, arrays)
+{
+  const AL::Math::SimdLevel lInitial = AL::Math::simdLevel();
+
+  // odd sizes, to cover the scalar tails of the kernels
+  std::vector<float> lAngles = makeAngles(9000.0f);
+  lAngles.push_back(std::numeric_limits<float>::quiet_NaN());
+  std::vector<float> lY;
+  std::vector<float> lX;
+  makePoints(lY, lX);
+  lY.push_back(std::numeric_limits<float>::infinity());
+  lX.push_back(-0.0f);
+
+  for (int l = AL::Math::SIMD_GENERIC;
+       l <= AL::Math::simdLevelSupported(); ++l)
+  {
+    const AL::Math::SimdLevel lLevel = static_cast<AL::Math::SimdLevel>(l);
+    ASSERT_EQ(lLevel, AL::Math::setSimdLevel(lLevel));
+    // the generic and SSE2 kernels give the scalar results
+    const float lEpsilon = (lLevel == AL::Math::SIMD_AVX2) ? 2.5e-7f : 0.0f;
+
+    std::vector<float> lSin(lAngles.size());
+    std::vector<float> lCos(lAngles.size());
+    AL::Math::fastSinCos(lAngles.data(), lSin.data(), lCos.data(),
+                         lAngles.size());
+    for (std::size_t i = 0u; i + 1u < lAngles.size(); ++i)
+    {
+      float lExpectedSin, lExpectedCos;
+      AL::Math::fastSinCos(lAngles[i], lExpectedSin, lExpectedCos);
+      EXPECT_NEAR(lExpectedSin, lSin[i], lEpsilon) << l << " " << lAngles[i];
+      EXPECT_NEAR(lExpectedCos, lCos[i], lEpsilon) << l << " " << lAngles[i];
+    }
+    EXPECT_TRUE(std::isnan(lSin.back()));
+
+    // in place
+    std::vector<float> lAtan2 = lY;
+    AL::Math::fastAtan2(lAtan2.data(), lX.data(), lAtan2.data(), lY.size());
+    for (std::size_t i = 0u; i < lY.size(); ++i)
+    {
+      EXPECT_NEAR(AL::Math::fastAtan2(lY[i], lX[i]), lAtan2[i], lEpsilon)
+          << l << " " << lY[i] << " " << lX[i];
+    }
+  }
+
+  AL::Math::setSimdLevel(lInitial);
+}
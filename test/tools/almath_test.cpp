@@ -7,9 +7,11 @@
 
 #include <almath/tools/altrigonometry.h>
 #include <almath/tools/almathio.h>
+#include <almath/tools/alsimd.h>
 #include <almath/tools/altransformhelpers.h>
 #include <boost/math/constants/constants.hpp>
 #include <gtest/gtest.h>
+#include <limits>
 #include <stdexcept>
 
 TEST(ALMathTest, moduloPI)
@@ -117,6 +119,154 @@ TEST(ALMathTest, mean) {
                std::runtime_error);
 }
 
+TEST(ALMathTest, meanArrays) {
+  std::vector<float> angles;
+  std::vector<float> weights;
+  for (int i = 0; i < 1001; ++i)
+  {
+    angles.push_back(3.0f + 0.4f*std::sin(0.1f*static_cast<float>(i)));
+    weights.push_back(1.0f + 0.5f*std::cos(0.3f*static_cast<float>(i)));
+  }
+  // the vector versions use the array ones: compare with a double sum
+  double lSumCos = 0.0;
+  double lSumSin = 0.0;
+  double lWeightedSumCos = 0.0;
+  double lWeightedSumSin = 0.0;
+  for (std::size_t i = 0u; i < angles.size(); ++i)
+  {
+    lSumCos += std::cos(static_cast<double>(angles[i]));
+    lSumSin += std::sin(static_cast<double>(angles[i]));
+    lWeightedSumCos += weights[i]*std::cos(static_cast<double>(angles[i]));
+    lWeightedSumSin += weights[i]*std::sin(static_cast<double>(angles[i]));
+  }
+  const float lMean = static_cast<float>(std::atan2(lSumSin, lSumCos));
+  const float lWeightedMean = static_cast<float>(
+        std::atan2(lWeightedSumSin, lWeightedSumCos));
+  EXPECT_NEAR(AL::Math::modulo2PI(
+                AL::Math::meanAngle(angles.data(), angles.size()) - lMean),
+              0.f, 1e-5f);
+  EXPECT_EQ(AL::Math::meanAngle(angles.data(), angles.size()),
+            AL::Math::meanAngle(angles));
+  EXPECT_NEAR(AL::Math::modulo2PI(
+                AL::Math::weightedMeanAngle(angles.data(), weights.data(),
+                                            angles.size()) - lWeightedMean),
+              0.f, 1e-5f);
+  EXPECT_EQ(AL::Math::weightedMeanAngle(angles.data(), weights.data(),
+                                        angles.size()),
+            AL::Math::weightedMeanAngle(angles, weights));
+
+  EXPECT_THROW(AL::Math::meanAngle(angles.data(), 0u), std::runtime_error);
+  weights[700] = 0.f;
+  EXPECT_THROW(AL::Math::weightedMeanAngle(angles.data(), weights.data(),
+                                           angles.size()),
+               std::runtime_error);
+  const float lOpposite[2] = {0.f, AL::Math::PI};
+  EXPECT_THROW(AL::Math::meanAngle(lOpposite, 2u), std::runtime_error);
+}
+
+// test/CMakeLists.txt passes the option of the library
+#ifndef ALMATH_FAST_TRIGONOMETRY
+TEST(ALMathTest, meanStdTrigonometry) {
+  // by default, the means are those of std::sin, std::cos and std::atan2,
+  // as before the fast trigonometry: below 4 angles, the sums are in order
+  const float lAngles[3][3] = {{0.3f, 1.7f, -2.9f},
+                               {3.1f, -3.05f, 2.2f},
+                               {-0.123f, 0.456f, 0.789f}};
+  const float lWeights[3] = {0.7f, 1.3f, 2.1f};
+  for (int k = 0; k < 3; ++k)
+  {
+    const std::vector<float> angles(lAngles[k], lAngles[k] + 3);
+    const std::vector<float> weights(lWeights, lWeights + 3);
+    AL::Math::Position2D lSum;
+    AL::Math::Position2D lWeightedSum;
+    for (std::size_t i = 0u; i < 3u; ++i)
+    {
+      lSum += AL::Math::Position2D(std::cos(angles[i]), std::sin(angles[i]));
+      lWeightedSum += weights[i]*AL::Math::Position2D(std::cos(angles[i]),
+                                                      std::sin(angles[i]));
+    }
+    EXPECT_EQ(AL::Math::modulo2PI(std::atan2(lSum.y, lSum.x)),
+              AL::Math::meanAngle(angles));
+    EXPECT_EQ(AL::Math::modulo2PI(std::atan2(lWeightedSum.y,
+                                             lWeightedSum.x)),
+              AL::Math::weightedMeanAngle(angles, weights));
+  }
+}
+#endif
+
+TEST(ALMathTest, circularMeanAccumulator) {
+  AL::Math::CircularMeanAccumulator lAccumulator;
+  EXPECT_EQ(0u, lAccumulator.count());
+  EXPECT_FALSE(lAccumulator.hasMean());
+  EXPECT_THROW(lAccumulator.mean(), std::runtime_error);
+  EXPECT_THROW(lAccumulator.remove(0.f), std::runtime_error);
+  EXPECT_THROW(lAccumulator.add(0.f, 0.f), std::runtime_error);
+  EXPECT_EQ(0.f, lAccumulator.resultantLength());
+  EXPECT_EQ(1.f, lAccumulator.circularVariance());
+
+  lAccumulator.add(0.5f);
+  EXPECT_NEAR(0.5f, lAccumulator.mean(), 1e-6f);
+  EXPECT_NEAR(1.f, lAccumulator.resultantLength(), 1e-6f);
+  EXPECT_NEAR(0.f, lAccumulator.circularVariance(), 1e-6f);
+  lAccumulator.add(0.5f + AL::Math::PI);
+  EXPECT_FALSE(lAccumulator.hasMean());
+  EXPECT_NEAR(0.f, lAccumulator.resultantLength(), 1e-6f);
+  lAccumulator.reset();
+
+  // sliding window of 50 samples over a slowly turning heading, around PI
+  std::vector<float> angles;
+  std::vector<float> weights;
+  for (int i = 0; i < 20000; ++i)
+  {
+    angles.push_back(AL::Math::modulo2PI(
+                       3.0f + 0.002f*static_cast<float>(i) +
+                       0.3f*std::sin(1.7f*static_cast<float>(i))));
+    weights.push_back(1.0f + 0.5f*std::cos(0.9f*static_cast<float>(i)));
+  }
+  const std::size_t lWindow = 50u;
+  for (std::size_t i = 0u; i < angles.size(); ++i)
+  {
+    lAccumulator.add(angles[i], weights[i]);
+    if (i >= lWindow)
+    {
+      lAccumulator.remove(angles[i - lWindow], weights[i - lWindow]);
+    }
+    if (i % 997u == 0u || i + 1u == angles.size())
+    {
+      const std::size_t lBegin = (i >= lWindow) ? i + 1u - lWindow : 0u;
+      const std::size_t lSize = i + 1u - lBegin;
+      ASSERT_EQ(lSize, lAccumulator.count());
+      EXPECT_NEAR(AL::Math::modulo2PI(
+                    lAccumulator.mean() -
+                    AL::Math::weightedMeanAngle(&angles[lBegin],
+                                                &weights[lBegin], lSize)),
+                  0.f, 1e-5f);
+      double lSumCos = 0.0;
+      double lSumSin = 0.0;
+      double lWeightSum = 0.0;
+      for (std::size_t j = lBegin; j <= i; ++j)
+      {
+        lSumCos += weights[j]*std::cos(static_cast<double>(angles[j]));
+        lSumSin += weights[j]*std::sin(static_cast<double>(angles[j]));
+        lWeightSum += weights[j];
+      }
+      const double lLength = std::sqrt(lSumCos*lSumCos + lSumSin*lSumSin) /
+          lWeightSum;
+      EXPECT_NEAR(lLength, lAccumulator.resultantLength(), 1e-6);
+      EXPECT_NEAR(1.0 - lLength, lAccumulator.circularVariance(), 1e-6);
+      EXPECT_NEAR(lWeightSum, lAccumulator.weightSum(), 1e-4);
+    }
+  }
+
+  while (lAccumulator.count() > 0u)
+  {
+    const std::size_t i = angles.size() - lAccumulator.count();
+    lAccumulator.remove(angles[i], weights[i]);
+  }
+  EXPECT_EQ(0.f, lAccumulator.weightSum());
+  EXPECT_EQ(0.f, lAccumulator.resultantLength());
+}
+
 TEST(ALMathTest, clipData)
 {
   float pMin  = -0.2f;
@@ -210,6 +360,71 @@ TEST(ALMathTest, clipDataVectorVector)
   }
 }
 
+TEST(ALMathTest, clipDataArrays)
+{
+  const AL::Math::SimdLevel lInitial = AL::Math::simdLevel();
+  // 4 joints of 9 robots, and a NaN
+  std::vector<float> lMin;
+  std::vector<float> lMax;
+  std::vector<float> lData;
+  for (int i = 0; i < 37; ++i)
+  {
+    const float f = static_cast<float>(i);
+    lMin.push_back(-1.0f - 0.1f*static_cast<float>(i % 4));
+    lMax.push_back(0.5f + 0.2f*static_cast<float>(i % 4));
+    lData.push_back(2.0f*std::sin(1.3f*f));
+  }
+  lData[36] = std::numeric_limits<float>::quiet_NaN();
+
+  for (int l = AL::Math::SIMD_GENERIC;
+       l <= AL::Math::simdLevelSupported(); ++l)
+  {
+    AL::Math::setSimdLevel(static_cast<AL::Math::SimdLevel>(l));
+
+    std::vector<float> lClipped = lData;
+    std::size_t lExpectedCount = 0u;
+    std::vector<float> lExpected = lData;
+    for (std::size_t i = 0u; i + 1u < lData.size(); ++i)
+    {
+      if (AL::Math::clipData(lMin[i], lMax[i], lExpected[i]))
+      {
+        ++lExpectedCount;
+      }
+    }
+    EXPECT_EQ(lExpectedCount, AL::Math::clipData(lMin.data(), lMax.data(),
+                                                 lClipped.data(),
+                                                 lClipped.size())) << l;
+    for (std::size_t i = 0u; i + 1u < lData.size(); ++i)
+    {
+      EXPECT_EQ(lExpected[i], lClipped[i]) << l << " " << i;
+    }
+    EXPECT_TRUE(std::isnan(lClipped[36]));
+    EXPECT_EQ(0u, AL::Math::clipData(lMin.data(), lMax.data(),
+                                     lClipped.data(), lClipped.size()));
+
+    lClipped = lData;
+    lExpectedCount = 0u;
+    lExpected = lData;
+    for (std::size_t i = 0u; i + 1u < lData.size(); ++i)
+    {
+      if (AL::Math::clipData(-0.2f, 0.5f, lExpected[i]))
+      {
+        ++lExpectedCount;
+      }
+    }
+    EXPECT_EQ(lExpectedCount, AL::Math::clipData(-0.2f, 0.5f,
+                                                 lClipped.data(),
+                                                 lClipped.size())) << l;
+    for (std::size_t i = 0u; i + 1u < lData.size(); ++i)
+    {
+      EXPECT_EQ(lExpected[i], lClipped[i]) << l << " " << i;
+    }
+    EXPECT_EQ(0u, AL::Math::clipData(-0.2f, 0.5f, lClipped.data(), 0u));
+  }
+
+  AL::Math::setSimdLevel(lInitial);
+}
+
 TEST(ALMathTest, changeReferencePose2D)
 {
   float pTheta = 90.0f*AL::Math::TO_RAD;
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/tools/alquaternioninterpolation.h>
+#include <almath/tools/altrigonometry.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  AL::Math::Quaternion makeQuaternion(float pAngle, float pX, float pY,
+                                      float pZ)
+  {
+    const float lNorm = std::sqrt(pX*pX + pY*pY + pZ*pZ);
+    return AL::Math::quaternionFromAngleAndAxisRotation(
+          pAngle, pX/lNorm, pY/lNorm, pZ/lNorm);
+  }
+
+  // the rotation angle between two unit quaternions
+  float angleBetween(const AL::Math::Quaternion& pQua1,
+                     const AL::Math::Quaternion& pQua2)
+  {
+    const float lDot = std::abs(pQua1.w*pQua2.w + pQua1.x*pQua2.x +
+                                pQua1.y*pQua2.y + pQua1.z*pQua2.z);
+    return 2.0f*std::acos(lDot > 1.0f ? 1.0f : lDot);
+  }
+
+  // |pQua1 - pQua2|, with pQua2 in the hemisphere of pQua1: accurate for
+  // close quaternions, unlike angleBetween
+  float chordLength(const AL::Math::Quaternion& pQua1,
+                    const AL::Math::Quaternion& pQua2)
+  {
+    const float lSign = (pQua1.w*pQua2.w + pQua1.x*pQua2.x +
+                         pQua1.y*pQua2.y + pQua1.z*pQua2.z) < 0.0f ?
+          -1.0f : 1.0f;
+    const float lW = pQua1.w - lSign*pQua2.w;
+    const float lX = pQua1.x - lSign*pQua2.x;
+    const float lY = pQua1.y - lSign*pQua2.y;
+    const float lZ = pQua1.z - lSign*pQua2.z;
+    return std::sqrt(lW*lW + lX*lX + lY*lY + lZ*lZ);
+  }
+
+  // true if pQua1 and pQua2 are the same rotation
+  bool isNearRotation(const AL::Math::Quaternion& pQua1,
+                      const AL::Math::Quaternion& pQua2,
+                      float pEpsilon)
+  {
+    return angleBetween(pQua1, pQua2) <= pEpsilon;
+  }
+
+  const AL::Math::Quaternion kQua1 = makeQuaternion(0.3f, 1.0f, 0.2f, -0.1f);
+  const AL::Math::Quaternion kQua2 = makeQuaternion(1.7f, -0.2f, 1.0f, 0.4f);
+}
+
+TEST(ALQuaternionInterpolationTest, slerp)
+{
+  EXPECT_TRUE(isNearRotation(kQua1,
+                             AL::Math::quaternionSlerp(kQua1, kQua2, 0.0f),
+                             2e-3f));
+  EXPECT_TRUE(isNearRotation(kQua2,
+                             AL::Math::quaternionSlerp(kQua1, kQua2, 1.0f),
+                             2e-3f));
+
+  // constant angular velocity along the shortest path
+  const float lAngle = angleBetween(kQua1, kQua2);
+  for (int i = 1; i < 10; ++i)
+  {
+    const float lT = 0.1f*static_cast<float>(i);
+    const AL::Math::Quaternion lQua =
+        AL::Math::quaternionSlerp(kQua1, kQua2, lT);
+    EXPECT_NEAR(1.0f, AL::Math::norm(lQua), 1e-5f);
+    EXPECT_NEAR(lT*lAngle, angleBetween(kQua1, lQua), 1e-3f);
+    EXPECT_NEAR((1.0f - lT)*lAngle, angleBetween(lQua, kQua2), 1e-3f);
+  }
+
+  // -kQua2 is the same rotation
+  EXPECT_TRUE(isNearRotation(AL::Math::quaternionSlerp(kQua1, kQua2, 0.3f),
+                             AL::Math::quaternionSlerp(kQua1, kQua2*-1.0f,
+                                                       0.3f),
+                             2e-3f));
+
+  // nearly equal quaternions
+  const AL::Math::Quaternion lClose = makeQuaternion(0.3001f, 1.0f, 0.2f,
+                                                     -0.1f);
+  const AL::Math::Quaternion lQua =
+      AL::Math::quaternionSlerp(kQua1, lClose, 0.5f);
+  EXPECT_NEAR(1.0f, AL::Math::norm(lQua), 1e-5f);
+  EXPECT_TRUE(isNearRotation(kQua1, lQua, 2e-3f));
+}
+
+TEST(ALQuaternionInterpolationTest, nlerp)
+{
+  const AL::Math::Quaternion lHalf =
+      AL::Math::quaternionNlerp(kQua1, kQua2, 0.5f);
+  EXPECT_NEAR(1.0f, AL::Math::norm(lHalf), 1e-5f);
+  // at t = 0.5, nlerp and slerp agree
+  EXPECT_TRUE(isNearRotation(lHalf,
+                             AL::Math::quaternionSlerp(kQua1, kQua2, 0.5f),
+                             2e-3f));
+  EXPECT_TRUE(isNearRotation(AL::Math::quaternionNlerp(kQua1, kQua2, 0.3f),
+                             AL::Math::quaternionNlerp(kQua1, kQua2*-1.0f,
+                                                       0.3f),
+                             2e-3f));
+}
+
+TEST(ALQuaternionInterpolationTest, arrays)
+{
+  const AL::Math::Quaternion lQua1[3] = {kQua1, kQua2, kQua1};
+  const AL::Math::Quaternion lQua2[3] = {kQua2, kQua1, kQua2*-1.0f};
+  const float lT[3] = {0.2f, 0.5f, 0.9f};
+  AL::Math::Quaternion lSlerp[3];
+  AL::Math::Quaternion lNlerp[3];
+  AL::Math::quaternionSlerp(lQua1, lQua2, lT, lSlerp, 3u);
+  AL::Math::quaternionNlerp(lQua1, lQua2, lT, lNlerp, 3u);
+  for (std::size_t i = 0u; i < 3u; ++i)
+  {
+    EXPECT_TRUE(lSlerp[i].isNear(
+                  AL::Math::quaternionSlerp(lQua1[i], lQua2[i], lT[i]), 1e-7f));
+    EXPECT_TRUE(lNlerp[i].isNear(
+                  AL::Math::quaternionNlerp(lQua1[i], lQua2[i], lT[i]), 1e-7f));
+  }
+}
+
+TEST(ALQuaternionInterpolationTest, slerpSegments)
+{
+  const AL::Math::Quaternion lKeys[4] = {
+    kQua1, kQua2, makeQuaternion(-0.8f, 0.0f, 0.3f, 1.0f) * -1.0f, kQua1};
+  AL::Math::QuaternionSlerpSegment lSegments[3];
+  AL::Math::quaternionSlerpSegments(lKeys, 4u, lSegments);
+  for (std::size_t s = 0u; s < 3u; ++s)
+  {
+    for (int i = 0; i <= 10; ++i)
+    {
+      const float lT = 0.1f*static_cast<float>(i);
+      EXPECT_TRUE(lSegments[s].interpolate(lT).isNear(
+                    AL::Math::quaternionSlerp(lKeys[s], lKeys[s+1u], lT),
+                    1e-6f));
+    }
+  }
+
+  // uniform sampling with the recurrence, over many samples
+  const std::size_t lCount = 1001u;
+  std::vector<AL::Math::Quaternion> lSamples(lCount);
+  AL::Math::quaternionSlerpUniform(lSegments[1], 0.0f, 0.001f, lCount,
+                                   lSamples.data());
+  for (std::size_t i = 0u; i < lCount; ++i)
+  {
+    const float lT = 0.001f*static_cast<float>(i);
+    EXPECT_TRUE(lSamples[i].isNear(lSegments[1].interpolate(lT), 1e-5f));
+  }
+
+  // a segment interpolated linearly
+  const AL::Math::QuaternionSlerpSegment lClose(kQua1, kQua1);
+  EXPECT_EQ(0.0f, lClose.inverseSinAngle);
+  AL::Math::quaternionSlerpUniform(lClose, 0.0f, 0.1f, 11u, lSamples.data());
+  EXPECT_TRUE(lSamples[5].isNear(kQua1, 1e-6f));
+}
+
+TEST(ALQuaternionInterpolationTest, squad)
+{
+  const AL::Math::Quaternion lKeys[4] = {
+    kQua1, kQua2, makeQuaternion(-0.8f, 0.0f, 0.3f, 1.0f) * -1.0f,
+    makeQuaternion(0.4f, 0.5f, 0.5f, 0.0f)};
+  AL::Math::QuaternionSquadSegment lSegments[3];
+  AL::Math::quaternionSquadSegments(lKeys, 4u, lSegments);
+
+  // the path goes through the keys
+  for (std::size_t s = 0u; s < 3u; ++s)
+  {
+    EXPECT_TRUE(isNearRotation(lKeys[s], lSegments[s].interpolate(0.0f),
+                               2e-3f));
+    EXPECT_TRUE(isNearRotation(lKeys[s+1u], lSegments[s].interpolate(1.0f),
+                               2e-3f));
+    EXPECT_TRUE(lSegments[s].interpolate(0.4f).isNear(
+                  AL::Math::quaternionSquad(
+                    lSegments[s].keys.q1, lSegments[s].controls.q1,
+                    lSegments[s].controls.q2, lSegments[s].keys.q2, 0.4f),
+                  1e-6f));
+  }
+
+  // the angular velocity is continuous at the inner keys
+  const float lDt = 1e-3f;
+  for (std::size_t s = 0u; s + 1u < 3u; ++s)
+  {
+    const float lBefore = chordLength(lSegments[s].interpolate(1.0f - lDt),
+                                      lSegments[s].interpolate(1.0f));
+    const float lAfter = chordLength(lSegments[s+1u].interpolate(0.0f),
+                                     lSegments[s+1u].interpolate(lDt));
+    EXPECT_NEAR(lBefore, lAfter, 0.1f*lBefore);
+  }
+
+  // uniform sampling
+  AL::Math::Quaternion lSamples[101];
+  AL::Math::quaternionSquadUniform(lSegments[1], 0.0f, 0.01f, 101u, lSamples);
+  for (std::size_t i = 0u; i < 101u; ++i)
+  {
+    const float lT = 0.01f*static_cast<float>(i);
+    EXPECT_TRUE(lSamples[i].isNear(lSegments[1].interpolate(lT), 1e-5f));
+  }
+
+  // with two keys, squad is a slerp
+  AL::Math::QuaternionSquadSegment lSegment;
+  AL::Math::quaternionSquadSegments(lKeys, 2u, &lSegment);
+  EXPECT_TRUE(isNearRotation(lSegment.interpolate(0.3f),
+                             AL::Math::quaternionSlerp(kQua1, kQua2, 0.3f),
+                             2e-3f));
+}
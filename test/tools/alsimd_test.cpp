@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/tools/alsimd.h>
+
+#include <almath/tools/almath.h>
+#include <almath/tools/almathio.h>
+#include <almath/tools/altransformhelpers.h>
+#include <almath/types/altransform.h>
+#include <almath/types/alpose2d.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  std::vector<AL::Math::Transform> makeTransforms()
+  {
+    std::vector<AL::Math::Transform> lTransforms;
+    for (int i = 0; i < 20; ++i)
+    {
+      const float f = static_cast<float>(i);
+      lTransforms.push_back(AL::Math::Transform::fromPosition(
+                              0.7f*f - 3.0f, 2.0f - 0.3f*f, 0.11f*f,
+                              0.41f*f, -0.27f*f, 0.5f - 0.13f*f));
+    }
+    return lTransforms;
+  }
+
+  AL::Math::Rotation toRotation(const AL::Math::Transform& pT)
+  {
+    return AL::Math::rotationFromQuaternion(
+          AL::Math::quaternionFromTransform(pT));
+  }
+
+  // all the dispatched operations, for every pair of transforms
+  struct Results
+  {
+    std::vector<AL::Math::Transform>  fTransforms;
+    std::vector<AL::Math::Rotation>   fRotations;
+    std::vector<AL::Math::Position3D> fPositions;
+  };
+
+  Results compute(const std::vector<AL::Math::Transform>& pIn)
+  {
+    Results lResults;
+    for (std::size_t i = 0u; i < pIn.size(); ++i)
+    {
+      for (std::size_t j = 0u; j < pIn.size(); ++j)
+      {
+        lResults.fTransforms.push_back(pIn[i] * pIn[j]);
+        AL::Math::Transform lT = pIn[i];
+        lT *= pIn[j];
+        lResults.fTransforms.push_back(lT);
+        lT = pIn[j];
+        AL::Math::transformPreMultiply(pIn[i], lT);
+        lResults.fTransforms.push_back(lT);
+
+        const AL::Math::Rotation lR1 = toRotation(pIn[i]);
+        const AL::Math::Rotation lR2 = toRotation(pIn[j]);
+        lResults.fRotations.push_back(lR1 * lR2);
+        lResults.fPositions.push_back(
+              lR1 * AL::Math::position3DFromTransform(pIn[j]));
+      }
+      lResults.fTransforms.push_back(pIn[i].inverse());
+      AL::Math::Transform lT = pIn[i];
+      AL::Math::transformInverse(lT, lT);
+      lResults.fTransforms.push_back(lT);
+      lT *= lT;
+      lResults.fTransforms.push_back(lT);
+      AL::Math::Rotation lR = toRotation(pIn[i]);
+      lR *= lR;
+      lResults.fRotations.push_back(lR);
+    }
+    return lResults;
+  }
+}
+
+TEST(ALSimdTest, level)
+{
+  const AL::Math::SimdLevel lInitial = AL::Math::simdLevel();
+  EXPECT_LE(lInitial, AL::Math::simdLevelSupported());
+
+  EXPECT_EQ(AL::Math::SIMD_GENERIC,
+            AL::Math::setSimdLevel(AL::Math::SIMD_GENERIC));
+  EXPECT_EQ(AL::Math::SIMD_GENERIC, AL::Math::simdLevel());
+  EXPECT_EQ(AL::Math::simdLevelSupported(),
+            AL::Math::setSimdLevel(AL::Math::SIMD_AVX2));
+
+  AL::Math::setSimdLevel(lInitial);
+}
+
+TEST(ALSimdTest, kernels)
+{
+  const AL::Math::SimdLevel lInitial = AL::Math::simdLevel();
+  const std::vector<AL::Math::Transform> lIn = makeTransforms();
+
+  AL::Math::setSimdLevel(AL::Math::SIMD_GENERIC);
+  const Results lExpected = compute(lIn);
+
+  for (int l = AL::Math::SIMD_SSE2;
+       l <= AL::Math::simdLevelSupported(); ++l)
+  {
+    const AL::Math::SimdLevel lLevel = static_cast<AL::Math::SimdLevel>(l);
+    ASSERT_EQ(lLevel, AL::Math::setSimdLevel(lLevel));
+    const Results lResults = compute(lIn);
+    ASSERT_EQ(lExpected.fTransforms.size(), lResults.fTransforms.size());
+
+    // SSE2 kernels are bit-exact, AVX2 ones use fused multiply-add
+    const float lEpsilon = (lLevel == AL::Math::SIMD_SSE2) ? 0.0f : 1e-5f;
+    for (std::size_t i = 0u; i < lResults.fTransforms.size(); ++i)
+    {
+      EXPECT_TRUE(lResults.fTransforms[i].isNear(
+                    lExpected.fTransforms[i], lEpsilon))
+          << "level " << l << "\n" << lResults.fTransforms[i]
+          << "\n" << lExpected.fTransforms[i];
+    }
+    for (std::size_t i = 0u; i < lResults.fRotations.size(); ++i)
+    {
+      EXPECT_TRUE(lResults.fRotations[i].isNear(
+                    lExpected.fRotations[i], lEpsilon))
+          << "level " << l;
+    }
+    for (std::size_t i = 0u; i < lResults.fPositions.size(); ++i)
+    {
+      EXPECT_TRUE(lResults.fPositions[i].isNear(
+                    lExpected.fPositions[i], lEpsilon))
+          << "level " << l;
+    }
+  }
+
+  AL::Math::setSimdLevel(lInitial);
+}
+
+TEST(ALSimdTest, sinCos)
+{
+  const AL::Math::SimdLevel lInitial = AL::Math::simdLevel();
+
+  // the inverse of (1, 0, theta) is (-cos(theta), sin(theta), -theta)
+  std::vector<AL::Math::Pose2D> lPoses;
+  for (int i = -20000; i <= 20000; ++i)
+  {
+    lPoses.push_back(AL::Math::Pose2D(1.0f, 0.0f, 0.0013f*i*std::abs(i)));
+  }
+  lPoses.push_back(AL::Math::Pose2D(1.0f, 0.0f, 1.0e30f));
+  lPoses.push_back(AL::Math::Pose2D(1.0f, 0.0f, -0.0f));
+  std::vector<AL::Math::Pose2D> lExpected(lPoses.size());
+  AL::Math::setSimdLevel(AL::Math::SIMD_GENERIC);
+  AL::Math::pose2DInverse(lPoses.data(), lExpected.data(), lPoses.size());
+  for (std::size_t i = 0u; i < lPoses.size(); ++i)
+  {
+    const float lTheta = lPoses[i].theta;
+    EXPECT_NEAR(std::cos(lTheta), -lExpected[i].x, 2.5e-7f) << lTheta;
+    EXPECT_NEAR(std::sin(lTheta), lExpected[i].y, 2.5e-7f) << lTheta;
+  }
+
+  for (int l = AL::Math::SIMD_SSE2;
+       l <= AL::Math::simdLevelSupported(); ++l)
+  {
+    const AL::Math::SimdLevel lLevel = static_cast<AL::Math::SimdLevel>(l);
+    ASSERT_EQ(lLevel, AL::Math::setSimdLevel(lLevel));
+    std::vector<AL::Math::Pose2D> lResults(lPoses.size());
+    AL::Math::pose2DInverse(lPoses.data(), lResults.data(), lPoses.size());
+    const float lEpsilon = (lLevel == AL::Math::SIMD_SSE2) ? 0.0f : 2.5e-7f;
+    for (std::size_t i = 0u; i < lPoses.size(); ++i)
+    {
+      EXPECT_TRUE(lResults[i].isNear(lExpected[i], lEpsilon))
+          << "level " << l << " angle " << lPoses[i].theta;
+    }
+  }
+
+  AL::Math::setSimdLevel(lInitial);
+}
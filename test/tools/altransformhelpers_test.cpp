@@ -5,13 +5,16 @@
  */
 
 #include <almath/tools/altransformhelpers.h>
+#include <almath/tools/altransformhelperst.h>
 #include <almath/tools/almath.h> // for Velocity6D = float * Position6D
 #include <almath/tools/almathio.h>
 #include <almath/tools/altrigonometry.h>
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <stdexcept>
 #include <cmath>
+#include <vector>
 
 using namespace AL;
 
@@ -716,6 +719,239 @@ TEST(ALTransformHelpersTest, changeRepereTransposePosition3D)
 
 }
 
+TEST(ALTransformHelpersTest, changeReperePosition3DArray)
+{
+  const AL::Math::Transform pTransf =
+      AL::Math::Transform::fromPosition(1.0f, 2.0f, 3.0f, 0.3f, -0.5f, 1.2f);
+  const std::size_t sizes[] = {0u, 1u, 3u, 4u, 7u, 1029u, 100003u};
+  for (std::size_t s = 0u; s < sizeof(sizes)/sizeof(sizes[0]); ++s)
+  {
+    const std::size_t size = sizes[s];
+    std::vector<AL::Math::Position3D> pIn(size);
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      const float f = static_cast<float>(i % 1000u);
+      pIn[i] = AL::Math::Position3D(0.01f*f, 2.0f - 0.02f*f, -0.5f + 0.003f*f);
+    }
+    std::vector<AL::Math::Position3D> pOut(size);
+    std::vector<AL::Math::Position3D> pOutT(size);
+    AL::Math::changeReferencePosition3D(pTransf, pIn.data(), pOut.data(), size);
+    AL::Math::changeReferenceTransposePosition3D(pTransf, pIn.data(),
+                                                 pOutT.data(), size);
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      AL::Math::Position3D pExpected;
+      AL::Math::changeReferencePosition3D(pTransf, pIn[i], pExpected);
+      EXPECT_TRUE(pOut[i].isNear(pExpected, 1e-5f)) << i;
+      AL::Math::changeReferenceTransposePosition3D(pTransf, pIn[i], pExpected);
+      EXPECT_TRUE(pOutT[i].isNear(pExpected, 1e-5f)) << i;
+    }
+
+    // in place, raw floats and several threads give the same results
+    std::vector<AL::Math::Position3D> pInPlace = pIn;
+    AL::Math::changeReferencePosition3DInPlace(pTransf, pInPlace.data(), size, 4u);
+    EXPECT_TRUE(pInPlace == pOut);
+
+    std::vector<float> pXYZ(3u*size);
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      pXYZ[3u*i] = pIn[i].x;
+      pXYZ[3u*i + 1u] = pIn[i].y;
+      pXYZ[3u*i + 2u] = pIn[i].z;
+    }
+    std::vector<float> pXYZOut(3u*size);
+    AL::Math::changeReferenceTransposePosition3D(pTransf, pXYZ.data(),
+                                                 pXYZOut.data(), size, 0u);
+    AL::Math::changeReferenceTransposePosition3DInPlace(pTransf, pXYZ.data(),
+                                                        size);
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      EXPECT_EQ(pOutT[i].x, pXYZ[3u*i]);
+      EXPECT_EQ(pOutT[i].y, pXYZ[3u*i + 1u]);
+      EXPECT_EQ(pOutT[i].z, pXYZ[3u*i + 2u]);
+      EXPECT_EQ(pOutT[i].x, pXYZOut[3u*i]);
+    }
+  }
+}
+
+namespace
+{
+  // twists with rotation angles from 0 to pi, about several axes,
+  // around the thresholds of the series (0.5) and of the symmetric
+  // logarithm (2pi/3)
+  std::vector<AL::Math::Velocity6D> makeTwists()
+  {
+    const float lAngles[] = {0.0f, 1e-6f, 1e-3f, 0.2f, 0.49f, 0.51f, 1.0f,
+                             2.09f, 2.1f, 2.8f, 3.1f, 3.14f};
+    const float lAxes[][3] = {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f},
+                              {0.6f, -0.8f, 0.0f}, {0.48f, 0.6f, -0.64f}};
+    std::vector<AL::Math::Velocity6D> lTwists;
+    for (std::size_t a = 0u; a < sizeof(lAngles)/sizeof(lAngles[0]); ++a)
+    {
+      for (std::size_t x = 0u; x < sizeof(lAxes)/sizeof(lAxes[0]); ++x)
+      {
+        const float f = static_cast<float>(lTwists.size());
+        lTwists.push_back(AL::Math::Velocity6D(
+                            std::sin(f), 0.5f*std::cos(2.0f*f), -0.3f,
+                            lAngles[a]*lAxes[x][0], lAngles[a]*lAxes[x][1],
+                            lAngles[a]*lAxes[x][2]));
+      }
+    }
+    return lTwists;
+  }
+
+  double maxDifference(const AL::Math::Transformd& pT1,
+                       const AL::Math::Transformd& pT2)
+  {
+    const double lT1[12] = {pT1.r1_c1, pT1.r1_c2, pT1.r1_c3, pT1.r1_c4,
+                            pT1.r2_c1, pT1.r2_c2, pT1.r2_c3, pT1.r2_c4,
+                            pT1.r3_c1, pT1.r3_c2, pT1.r3_c3, pT1.r3_c4};
+    const double lT2[12] = {pT2.r1_c1, pT2.r1_c2, pT2.r1_c3, pT2.r1_c4,
+                            pT2.r2_c1, pT2.r2_c2, pT2.r2_c3, pT2.r2_c4,
+                            pT2.r3_c1, pT2.r3_c2, pT2.r3_c3, pT2.r3_c4};
+    double lMax = 0.0;
+    for (int i = 0; i < 12; ++i)
+    {
+      lMax = std::max(lMax, std::abs(lT1[i] - lT2[i]));
+    }
+    return lMax;
+  }
+
+  AL::Math::Velocity6Dd multiply(const float* pJacobian,
+                                 const AL::Math::Velocity6Dd& pVel)
+  {
+    const double lVel[6] = {pVel.xd, pVel.yd, pVel.zd,
+                            pVel.wxd, pVel.wyd, pVel.wzd};
+    double lOut[6];
+    for (int r = 0; r < 6; ++r)
+    {
+      lOut[r] = 0.0;
+      for (int c = 0; c < 6; ++c)
+      {
+        lOut[r] += pJacobian[6*r + c]*lVel[c];
+      }
+    }
+    return AL::Math::Velocity6Dd(lOut[0], lOut[1], lOut[2],
+                                 lOut[3], lOut[4], lOut[5]);
+  }
+}
+
+TEST(ALTransformHelpersTest, logarithmExponentialArrays)
+{
+  const std::vector<AL::Math::Velocity6D> lTwists = makeTwists();
+  const std::size_t lSize = lTwists.size();
+  std::vector<AL::Math::Transform> lExp(lSize);
+  AL::Math::velocityExponential(lTwists.data(), lExp.data(), lSize);
+
+  std::vector<AL::Math::Transform> lExpected(lSize);
+  for (std::size_t i = 0u; i < lSize; ++i)
+  {
+    lExpected[i] = AL::Math::velocityExponential(
+          AL::Math::Velocity6Dd(lTwists[i])).toTransform();
+    EXPECT_TRUE(lExp[i].isNear(lExpected[i], 1e-6f)) << i;
+  }
+
+  // any angle up to pi, about any axis
+  std::vector<AL::Math::Velocity6D> lLog(lSize);
+  AL::Math::transformLogarithm(lExpected.data(), lLog.data(), lSize);
+  for (std::size_t i = 0u; i < lSize; ++i)
+  {
+    EXPECT_TRUE(lLog[i].isNear(lTwists[i], 2e-5f)) << i << " " << lLog[i];
+  }
+
+  // the scalar logarithm where it is accurate
+  const AL::Math::Transform lT =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  AL::Math::Velocity6D lVel;
+  AL::Math::transformLogarithm(&lT, &lVel, 1u);
+  EXPECT_TRUE(lVel.isNear(AL::Math::transformLogarithm(lT), 1e-5f));
+
+  // threads
+  std::vector<AL::Math::Velocity6D> lMany;
+  for (std::size_t i = 0u; i < 20000u; ++i)
+  {
+    lMany.push_back(lTwists[i % lSize]);
+  }
+  std::vector<AL::Math::Transform> lManyExp(lMany.size());
+  std::vector<AL::Math::Transform> lManyExpThreads(lMany.size());
+  AL::Math::velocityExponential(lMany.data(), lManyExp.data(), lMany.size());
+  AL::Math::velocityExponential(lMany.data(), lManyExpThreads.data(),
+                                lMany.size(), 0u);
+  std::vector<AL::Math::Velocity6D> lManyLog(lMany.size());
+  AL::Math::transformLogarithm(lManyExp.data(), lManyLog.data(), lMany.size(),
+                               4u);
+  for (std::size_t i = 0u; i < lMany.size(); ++i)
+  {
+    EXPECT_TRUE(lManyExp[i] == lManyExpThreads[i]) << i;
+    EXPECT_TRUE(lManyLog[i] == lLog[i % lSize] ||
+                lManyLog[i].isNear(lLog[i % lSize], 1e-6f)) << i;
+  }
+}
+
+TEST(ALTransformHelpersTest, logarithmExponentialJacobians)
+{
+  const std::vector<AL::Math::Velocity6D> lTwists = makeTwists();
+  const std::size_t lSize = lTwists.size();
+  std::vector<float> lLeft(36u*lSize);
+  std::vector<float> lRight(36u*lSize);
+  std::vector<float> lLeftInverse(36u*lSize);
+  std::vector<float> lRightInverse(36u*lSize);
+  AL::Math::velocityExponentialLeftJacobian(lTwists.data(), lLeft.data(),
+                                            lSize);
+  AL::Math::velocityExponentialRightJacobian(lTwists.data(), lRight.data(),
+                                             lSize);
+  AL::Math::transformLogarithmLeftJacobian(lTwists.data(),
+                                           lLeftInverse.data(), lSize);
+  AL::Math::transformLogarithmRightJacobian(lTwists.data(),
+                                            lRightInverse.data(), lSize);
+
+  // exp(v + d) = exp(Jl d) exp(v) = exp(v) exp(Jr d), up to O(|d|^2)
+  const double lStep = 1e-4;
+  for (std::size_t i = 0u; i < lSize; ++i)
+  {
+    const AL::Math::Velocity6Dd lVel(lTwists[i]);
+    const AL::Math::Transformd lExp = AL::Math::velocityExponential(lVel);
+    for (int k = 0; k < 6; ++k)
+    {
+      double lDelta[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      lDelta[k] = lStep;
+      const AL::Math::Velocity6Dd d(lDelta[0], lDelta[1], lDelta[2],
+                                    lDelta[3], lDelta[4], lDelta[5]);
+      const AL::Math::Transformd lExpected =
+          AL::Math::velocityExponential(lVel + d);
+      EXPECT_LT(maxDifference(
+                  lExpected,
+                  AL::Math::velocityExponential(
+                    multiply(&lLeft[36u*i], d))*lExp)/lStep, 2e-3)
+          << i << " " << k;
+      EXPECT_LT(maxDifference(
+                  lExpected,
+                  lExp*AL::Math::velocityExponential(
+                    multiply(&lRight[36u*i], d)))/lStep, 2e-3)
+          << i << " " << k;
+    }
+
+    // the Jacobians of the logarithm are the inverses
+    for (int r = 0; r < 6; ++r)
+    {
+      for (int c = 0; c < 6; ++c)
+      {
+        float lLeftProduct = 0.0f;
+        float lRightProduct = 0.0f;
+        for (int j = 0; j < 6; ++j)
+        {
+          lLeftProduct += lLeftInverse[36u*i + 6*r + j]*lLeft[36u*i + 6*j + c];
+          lRightProduct += lRightInverse[36u*i + 6*r + j]*
+              lRight[36u*i + 6*j + c];
+        }
+        const float lIdentity = (r == c) ? 1.0f : 0.0f;
+        EXPECT_NEAR(lIdentity, lLeftProduct, 2e-5f) << i << " " << r << c;
+        EXPECT_NEAR(lIdentity, lRightProduct, 2e-5f) << i << " " << r << c;
+      }
+    }
+  }
+}
+
 TEST(ALTransformHelpersTest, changeRepereTransform)
 {
 }
@@ -776,6 +1012,198 @@ TEST(ALTransformHelpersTest, transformMeanInPlace)
                std::runtime_error);
 } // end transformMean
 
+TEST(ALTransformHelpersTest, transformMeanAccumulator)
+{
+  AL::Math::TransformMeanAccumulator lAcc;
+  EXPECT_EQ(0u, lAcc.count());
+  EXPECT_THROW(lAcc.mean(), std::runtime_error);
+  EXPECT_THROW(lAcc.remove(AL::Math::Transform()), std::runtime_error);
+  EXPECT_THROW(lAcc.add(AL::Math::Transform(), 0.0f), std::runtime_error);
+  EXPECT_THROW(lAcc.add(AL::Math::Transform(), -1.0f), std::runtime_error);
+  EXPECT_EQ(0u, lAcc.count());
+
+  // the mean of two rotations about the same axis is the half angle
+  AL::Math::Transform lT1 = AL::Math::transformFromRotZ(0.2f);
+  lT1.r1_c4 = 1.0f;
+  AL::Math::Transform lT2 = AL::Math::transformFromRotZ(0.8f);
+  lT2.r2_c4 = 2.0f;
+  lAcc.add(lT1);
+  EXPECT_TRUE(lAcc.mean().isNear(lT1, 1e-6f));
+  lAcc.add(lT2);
+  AL::Math::Transform lExpected = AL::Math::transformFromRotZ(0.5f);
+  lExpected.r1_c4 = 0.5f;
+  lExpected.r2_c4 = 1.0f;
+  EXPECT_TRUE(lAcc.mean().isNear(lExpected, 1e-6f));
+
+  // weights: a weight of 3 counts as three samples
+  lAcc.remove(lT1);
+  lAcc.remove(lT2);
+  lAcc.add(lT1);
+  lAcc.add(lT2, 3.0f);
+  EXPECT_EQ(2u, lAcc.count());
+  EXPECT_FLOAT_EQ(4.0f, lAcc.weightSum());
+  AL::Math::TransformMeanAccumulator lRepeated;
+  lRepeated.add(lT1);
+  for (int i = 0; i < 3; ++i)
+  {
+    lRepeated.add(lT2);
+  }
+  EXPECT_TRUE(lAcc.mean().isNear(lRepeated.mean(), 1e-6f));
+
+  // the sign of the quaternion does not matter: rotations about the same
+  // axis by a and a - 2 pi are the same
+  AL::Math::TransformMeanAccumulator lWrapped;
+  lWrapped.add(AL::Math::transformFromRotX(3.0f));
+  lWrapped.add(AL::Math::transformFromRotX(-3.0f));
+  EXPECT_TRUE(lWrapped.mean().isNear(
+                AL::Math::transformFromRotX(AL::Math::PI), 1e-6f));
+
+  // emptied, the accumulator takes a new reference
+  lAcc.remove(lT1);
+  lAcc.remove(lT2, 3.0f);
+  EXPECT_EQ(0u, lAcc.count());
+  EXPECT_THROW(lAcc.mean(), std::runtime_error);
+  lAcc.add(lT2);
+  EXPECT_TRUE(lAcc.mean().isNear(lT2, 1e-6f));
+  lAcc.reset();
+  EXPECT_EQ(0u, lAcc.count());
+  EXPECT_EQ(0.0f, lAcc.weightSum());
+
+  // removing anything but the oldest sample throws and changes nothing
+  lAcc.add(lT1);
+  lAcc.add(lT2, 3.0f);
+  const AL::Math::Transform lMean = lAcc.mean();
+  EXPECT_THROW(lAcc.remove(lT2, 3.0f), std::runtime_error);
+  EXPECT_THROW(lAcc.remove(lT1, 2.0f), std::runtime_error);
+  EXPECT_EQ(2u, lAcc.count());
+  EXPECT_FLOAT_EQ(4.0f, lAcc.weightSum());
+  EXPECT_TRUE(lAcc.mean().isNear(lMean, 0.0f));
+  lAcc.remove();
+  EXPECT_TRUE(lAcc.mean().isNear(lT2, 1e-6f));
+  lAcc.remove(lT2, 3.0f);
+  EXPECT_EQ(0u, lAcc.count());
+  EXPECT_THROW(lAcc.remove(), std::runtime_error);
+
+  // a sliding window gives the mean of the samples in the window
+  const std::size_t lWindow = 16u;
+  std::vector<AL::Math::Transform> lSamples;
+  for (int i = 0; i < 2000; ++i)
+  {
+    const float t = 0.01f*static_cast<float>(i);
+    AL::Math::Transform lT = AL::Math::transformFromRotZ(0.4f*std::sin(t)) *
+        AL::Math::transformFromRotY(0.3f*std::cos(1.3f*t)) *
+        AL::Math::transformFromRotX(0.2f*std::sin(0.7f*t));
+    lT.r1_c4 = std::cos(t);
+    lT.r2_c4 = 10.0f + std::sin(t);
+    lT.r3_c4 = 0.001f*t;
+    lSamples.push_back(lT);
+  }
+  AL::Math::TransformMeanAccumulator lSliding;
+  float lMaxError = 0.0f;
+  for (std::size_t i = 0u; i < lSamples.size(); ++i)
+  {
+    lSliding.add(lSamples[i]);
+    if (i >= lWindow)
+    {
+      lSliding.remove(lSamples[i - lWindow]);
+    }
+    ASSERT_EQ(std::min(i + 1u, lWindow), lSliding.count());
+
+    AL::Math::TransformMeanAccumulator lFresh;
+    for (std::size_t j = (i >= lWindow) ? i + 1u - lWindow : 0u; j <= i; ++j)
+    {
+      lFresh.add(lSamples[j]);
+    }
+    const AL::Math::Transform lSlidingMean = lSliding.mean();
+    const AL::Math::Transform lFreshMean = lFresh.mean();
+    for (int k = 0; k < 12; ++k)
+    {
+      lMaxError = std::max(lMaxError, std::abs(
+                             (&lSlidingMean.r1_c1)[k] - (&lFreshMean.r1_c1)[k]));
+    }
+  }
+  EXPECT_LT(lMaxError, 1e-5f);
+}
+
+TEST(ALTransformHelpersTest, transformRobustMean)
+{
+  EXPECT_THROW(AL::Math::transformRobustMean(NULL, 0u, 0.1f),
+               std::runtime_error);
+  const AL::Math::Transform lIdentity;
+  EXPECT_THROW(AL::Math::transformRobustMean(&lIdentity, 1u, -0.1f),
+               std::runtime_error);
+  EXPECT_TRUE(AL::Math::transformRobustMean(&lIdentity, 1u, 0.1f).isNear(
+                lIdentity, 1e-6f));
+
+  // noisy samples around lTruth, one in five replaced by an outlier
+  AL::Math::Transform lTruth = AL::Math::transformFromRotZ(0.7f) *
+      AL::Math::transformFromRotX(-0.4f);
+  lTruth.r1_c4 = 0.3f;
+  lTruth.r2_c4 = -0.2f;
+  lTruth.r3_c4 = 1.1f;
+  std::vector<AL::Math::Transform> lSamples;
+  AL::Math::TransformMeanAccumulator lPlain;
+  for (int i = 0; i < 12500; ++i)
+  {
+    const float n = static_cast<float>(i);
+    AL::Math::Transform lNoise;
+    if (i % 5 == 4)
+    {
+      lNoise = AL::Math::transformFromRotY(1.5f + 0.1f*std::sin(n));
+      lNoise.r1_c4 = 0.5f;
+    }
+    else
+    {
+      lNoise = AL::Math::transformFromRotX(0.01f*std::sin(1.7f*n)) *
+          AL::Math::transformFromRotY(0.01f*std::cos(2.3f*n)) *
+          AL::Math::transformFromRotZ(0.01f*std::sin(3.1f*n));
+      lNoise.r1_c4 = 0.002f*std::cos(1.1f*n);
+      lNoise.r2_c4 = 0.002f*std::sin(0.9f*n);
+    }
+    lSamples.push_back(lTruth*lNoise);
+    lPlain.add(lSamples.back());
+  }
+  EXPECT_FALSE(lPlain.mean().isNear(lTruth, 0.05f));
+
+  std::vector<float> lWeights(lSamples.size());
+  const AL::Math::Transform lHuber = AL::Math::transformRobustMean(
+        lSamples.data(), lSamples.size(), 0.02f, 1.0f, 100u, 1e-7f,
+        lWeights.data());
+  EXPECT_TRUE(lHuber.isNear(lTruth, 0.01f));
+  for (std::size_t i = 0u; i < lSamples.size(); ++i)
+  {
+    if (i % 5u == 4u)
+    {
+      EXPECT_LT(lWeights[i], 0.05f) << i;
+    }
+    else
+    {
+      EXPECT_EQ(1.0f, lWeights[i]) << i;
+    }
+  }
+
+  // the geometric median
+  const AL::Math::Transform lMedian = AL::Math::transformRobustMean(
+        lSamples.data(), lSamples.size(), 0.0f, 1.0f, 100u, 1e-7f,
+        lWeights.data());
+  EXPECT_TRUE(lMedian.isNear(lTruth, 0.01f));
+  EXPECT_LE(*std::max_element(lWeights.begin(), lWeights.end()), 1.0f);
+
+  // the threads share the reduction by blocks (13 blocks, 3 threads):
+  // same result
+  EXPECT_TRUE(lHuber.isNear(AL::Math::transformRobustMean(
+                              lSamples.data(), lSamples.size(), 0.02f, 1.0f,
+                              100u, 1e-7f, NULL, 3u), 0.0f));
+
+  // no iteration: the plain mean; a large threshold keeps it
+  EXPECT_TRUE(lPlain.mean().isNear(AL::Math::transformRobustMean(
+                                     lSamples.data(), lSamples.size(), 0.02f,
+                                     1.0f, 0u), 1e-6f));
+  EXPECT_TRUE(lPlain.mean().isNear(AL::Math::transformRobustMean(
+                                     lSamples.data(), lSamples.size(), 1e3f),
+                                   1e-6f));
+}
+
 TEST(ALTransformHelpersTest, transformFromPosition3DInPlace)
 {
 }
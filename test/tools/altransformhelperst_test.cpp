@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/tools/altransformhelperst.h>
+#include <almath/tools/altransformhelpers.h>
+#include <almath/tools/altrigonometry.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+  const AL::Math::Transform kT1 =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::Transform kT2 =
+      AL::Math::Transform::fromPosition(-0.5f, 0.0f, 0.7f, -1.2f, 0.6f, 0.2f);
+
+  // a rigid transform computed in double precision
+  AL::Math::Transformd makeTransformd(double pX, double pY, double pZ,
+                                      double pWX, double pWY, double pWZ)
+  {
+    return AL::Math::Transformd(pX, pY, pZ)*
+        AL::Math::Transformd::fromRotZ(pWZ)*
+        AL::Math::Transformd::fromRotY(pWY)*
+        AL::Math::Transformd::fromRotX(pWX);
+  }
+}
+
+// the float instantiations agree with the float functions for generic
+// angles; they have no float-tuned thresholds
+TEST(ALTransformHelpersTTest, LogarithmExponentialFloat)
+{
+  const AL::Math::TransformT<float> lT(kT1);
+  EXPECT_TRUE(AL::Math::transformLogarithm(lT).toVelocity6D().isNear(
+                AL::Math::transformLogarithm(kT1), 1e-5f));
+  const AL::Math::Velocity6D lVel(0.1f, -0.2f, 0.3f, 0.5f, -0.4f, 0.2f);
+  EXPECT_TRUE(AL::Math::velocityExponential(
+                AL::Math::Velocity6DT<float>(lVel)).toTransform().isNear(
+                AL::Math::velocityExponential(lVel), 1e-6f));
+}
+
+TEST(ALTransformHelpersTTest, LogarithmExponentialDouble)
+{
+  EXPECT_TRUE(AL::Math::transformLogarithm(
+                AL::Math::Transformd(kT1)).toVelocity6D().isNear(
+                AL::Math::transformLogarithm(kT1), 1e-5f));
+
+  // the double round trip is much more accurate than the float one
+  const AL::Math::Transformd lT = makeTransformd(0.1, 0.2, 0.3, 0.4, -0.3, 1.1);
+  const AL::Math::Velocity6Dd lVel = AL::Math::transformLogarithm(lT);
+  EXPECT_TRUE(AL::Math::velocityExponential(lVel).isNear(lT, 1e-12));
+}
+
+TEST(ALTransformHelpersTTest, LogarithmExponentialDoubleSmallAngles)
+{
+  // about z, with a translation along z: the logarithm is (0, 0, z, 0, 0, a)
+  const double lAngles[] = {0.0, 1e-9, 1e-5, 1e-4, 5e-4, 1e-3, 1e-2, 0.1};
+  for (double a : lAngles)
+  {
+    const AL::Math::Transformd lT =
+        AL::Math::Transformd(0.0, 0.0, 0.3)*AL::Math::Transformd::fromRotZ(a);
+    const AL::Math::Velocity6Dd lVel = AL::Math::transformLogarithm(lT);
+    EXPECT_NEAR(a, lVel.wzd, 1e-15) << a;
+    EXPECT_NEAR(0.0, lVel.wxd, 1e-15) << a;
+    EXPECT_NEAR(0.0, lVel.wyd, 1e-15) << a;
+    EXPECT_NEAR(0.0, lVel.xd, 1e-15) << a;
+    EXPECT_NEAR(0.0, lVel.yd, 1e-15) << a;
+    EXPECT_NEAR(0.3, lVel.zd, 1e-15) << a;
+    EXPECT_TRUE(AL::Math::velocityExponential(
+                  AL::Math::Velocity6Dd(0.0, 0.0, 0.0, 0.0, 0.0, a)).isNear(
+                  AL::Math::Transformd::fromRotZ(a), 1e-15)) << a;
+
+    // about a tilted axis, with any translation
+    const AL::Math::Velocity6Dd lTwist(0.1, -0.2, 0.3, a, -2.0*a, 0.5*a);
+    const AL::Math::Transformd lExp = AL::Math::velocityExponential(lTwist);
+    EXPECT_TRUE(AL::Math::transformLogarithm(lExp).isNear(lTwist, 1e-12))
+        << a;
+  }
+}
+
+TEST(ALTransformHelpersTTest, LogarithmExponentialDoubleHalfTurn)
+{
+  // a half turn about x: w = (+-pi, 0, 0), and for p = (0.1, 0.2, 0.3),
+  // v = p - w x p / 2 + w x (w x p) / pi^2 = (0.1, 0.15*wx, -0.1*wx)
+  const double lPi = 3.14159265358979323846;
+  const AL::Math::Transformd lHalfTurn =
+      AL::Math::Transformd(0.1, 0.2, 0.3)*
+      AL::Math::Transformd::fromRotX(lPi);
+  const AL::Math::Velocity6Dd lVel = AL::Math::transformLogarithm(lHalfTurn);
+  EXPECT_NEAR(lPi, std::abs(lVel.wxd), 1e-12);
+  EXPECT_NEAR(0.0, lVel.wyd, 1e-12);
+  EXPECT_NEAR(0.0, lVel.wzd, 1e-12);
+  EXPECT_NEAR(0.1, lVel.xd, 1e-12);
+  EXPECT_NEAR(0.15*lVel.wxd, lVel.yd, 1e-12);
+  EXPECT_NEAR(-0.1*lVel.wxd, lVel.zd, 1e-12);
+  EXPECT_TRUE(AL::Math::velocityExponential(lVel).isNear(lHalfTurn, 1e-12));
+
+  // close to a half turn about a tilted axis
+  const double lNorm = std::sqrt(14.0);
+  const double lOffsets[] = {0.0, 1e-9, 1e-6, 1e-3, 0.1};
+  for (double d : lOffsets)
+  {
+    const double lAngle = lPi - d;
+    const AL::Math::Velocity6Dd lTwist(0.1, -0.2, 0.3,
+                                       lAngle/lNorm, 2.0*lAngle/lNorm,
+                                       -3.0*lAngle/lNorm);
+    const AL::Math::Transformd lExp = AL::Math::velocityExponential(lTwist);
+    const AL::Math::Velocity6Dd lLog = AL::Math::transformLogarithm(lExp);
+    EXPECT_TRUE(AL::Math::velocityExponential(lLog).isNear(lExp, 1e-12))
+        << d;
+    if (d > 0.0)
+    {
+      EXPECT_TRUE(lLog.isNear(lTwist, 1e-9)) << d;
+    }
+  }
+}
+
+TEST(ALTransformHelpersTTest, TransformMean)
+{
+  EXPECT_TRUE(AL::Math::transformMean(
+                AL::Math::Transformd(kT1),
+                AL::Math::Transformd(kT2)).toTransform().isNear(
+                AL::Math::transformMean(kT1, kT2), 1e-5f));
+
+  const AL::Math::Transformd lT1 =
+      makeTransformd(0.1, 0.2, 0.3, 0.4, -0.3, 1.1);
+  const AL::Math::Transformd lT2 =
+      makeTransformd(-0.5, 0.0, 0.7, -1.2, 0.6, 0.2);
+  EXPECT_TRUE(AL::Math::transformMean(lT1, lT2, 0.0).isNear(lT1, 1e-12));
+  EXPECT_TRUE(AL::Math::transformMean(lT1, lT2, 1.0).isNear(lT2, 1e-12));
+  EXPECT_THROW(AL::Math::transformMean(lT1, lT2, 1.5), std::runtime_error);
+}
+
+TEST(ALTransformHelpersTTest, ChangeReference)
+{
+  const AL::Math::Transformd lT1(kT1);
+  const AL::Math::Transformd lT2(kT2);
+
+  const AL::Math::Position3D lPos(0.5f, -1.0f, 2.0f);
+  AL::Math::Position3D lPosOut;
+  AL::Math::Position3Dd lPosd(lPos);
+  AL::Math::Position3Dd lPosOutd;
+
+  AL::Math::changeReferencePosition3D(kT1, lPos, lPosOut);
+  AL::Math::changeReferencePosition3D(lT1, lPosd, lPosOutd);
+  EXPECT_TRUE(lPosOutd.toPosition3D().isNear(lPosOut, 1e-6f));
+  AL::Math::changeReferencePosition3DInPlace(lT1, lPosd);
+  EXPECT_TRUE(lPosd == lPosOutd);
+
+  AL::Math::changeReferenceTransposePosition3D(kT1, lPos, lPosOut);
+  AL::Math::changeReferenceTransposePosition3D(
+        lT1, AL::Math::Position3Dd(lPos), lPosOutd);
+  EXPECT_TRUE(lPosOutd.toPosition3D().isNear(lPosOut, 1e-6f));
+  lPosd = AL::Math::Position3Dd(lPos);
+  AL::Math::changeReferenceTransposePosition3DInPlace(lT1, lPosd);
+  EXPECT_TRUE(lPosd == lPosOutd);
+
+  const AL::Math::Velocity6D lVel(0.1f, -0.2f, 0.3f, 0.5f, -0.4f, 0.2f);
+  AL::Math::Velocity6D lVelOut;
+  AL::Math::Velocity6Dd lVelOutd;
+  AL::Math::changeReferenceVelocity6D(kT1, lVel, lVelOut);
+  AL::Math::changeReferenceVelocity6D(lT1, AL::Math::Velocity6Dd(lVel),
+                                      lVelOutd);
+  EXPECT_TRUE(lVelOutd.toVelocity6D().isNear(lVelOut, 1e-6f));
+  AL::Math::changeReferenceTransposeVelocity6D(kT1, lVel, lVelOut);
+  AL::Math::changeReferenceTransposeVelocity6D(
+        lT1, AL::Math::Velocity6Dd(lVel), lVelOutd);
+  EXPECT_TRUE(lVelOutd.toVelocity6D().isNear(lVelOut, 1e-6f));
+
+  AL::Math::Transform lTOut;
+  AL::Math::Transformd lTOutd;
+  AL::Math::changeReferenceTransform(kT1, kT2, lTOut);
+  AL::Math::changeReferenceTransform(lT1, lT2, lTOutd);
+  EXPECT_TRUE(lTOutd.toTransform().isNear(lTOut, 1e-6f));
+  AL::Math::changeReferenceTransposeTransform(kT1, kT2, lTOut);
+  AL::Math::changeReferenceTransposeTransform(lT1, lT2, lTOutd);
+  EXPECT_TRUE(lTOutd.toTransform().isNear(lTOut, 1e-6f));
+}
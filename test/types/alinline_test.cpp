@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+// The test_almath_inline target defines ALMATH_INLINE_OPERATORS for all its
+// translation units.
+#include <almath/tools/altransformhelpers.h>
+
+#include <gtest/gtest.h>
+
+#ifndef ALMATH_INLINE_HEADERS
+# error "almath/inline headers are not included"
+#endif
+
+TEST(ALInlineTest, Position3D)
+{
+  const AL::Math::Position3D lPos1(1.0f, 2.0f, 3.0f);
+  const AL::Math::Position3D lPos2(-2.0f, 0.5f, 4.0f);
+  AL::Math::Position3D lPos3(lPos1);
+  lPos3 += lPos2;
+  lPos3 -= lPos1;
+  EXPECT_TRUE(lPos3 == lPos2);
+  lPos3 *= 2.0f;
+  EXPECT_TRUE(lPos3 != lPos2);
+  EXPECT_TRUE(lPos3 == lPos2*2.0f);
+  EXPECT_FLOAT_EQ(lPos1.dotProduct(lPos2), 11.0f);
+  EXPECT_FLOAT_EQ(lPos1.norm(), std::sqrt(14.0f));
+  EXPECT_FLOAT_EQ(lPos1.distanceSquared(lPos2), 12.25f);
+  EXPECT_FLOAT_EQ(AL::Math::distance(lPos1, lPos2), std::sqrt(12.25f));
+  EXPECT_TRUE(lPos1.crossProduct(lPos2) ==
+              AL::Math::Position3D(6.5f, -10.0f, 4.5f));
+  EXPECT_TRUE(AL::Math::Position3D(0.5f) ==
+              AL::Math::Position3D(0.5f, 0.5f, 0.5f));
+}
+
+TEST(ALInlineTest, Position2D)
+{
+  const AL::Math::Position2D lPos1(1.0f, 2.0f);
+  const AL::Math::Position2D lPos2(-2.0f, 0.5f);
+  AL::Math::Position2D lPos3(lPos1);
+  lPos3 += lPos2;
+  lPos3 -= lPos1;
+  EXPECT_TRUE(lPos3 == lPos2);
+  EXPECT_TRUE(2.0f*lPos2 != lPos2);
+  EXPECT_FLOAT_EQ(lPos1.dotProduct(lPos2), -1.0f);
+  EXPECT_FLOAT_EQ(lPos1.crossProduct(lPos2), 4.5f);
+  EXPECT_FLOAT_EQ(lPos1.distanceSquared(lPos2), 11.25f);
+  EXPECT_FLOAT_EQ(AL::Math::norm(lPos1), std::sqrt(5.0f));
+}
+
+TEST(ALInlineTest, Pose2D)
+{
+  AL::Math::Pose2D lPose(1.0f, 2.0f, 0.5f);
+  const AL::Math::Pose2D lStep(0.1f, -0.2f, 0.3f);
+  const AL::Math::Pose2D lExpected(
+        1.0f + std::cos(0.5f)*0.1f + std::sin(0.5f)*0.2f,
+        2.0f + std::sin(0.5f)*0.1f - std::cos(0.5f)*0.2f,
+        0.8f);
+  lPose *= lStep;
+  EXPECT_TRUE(lPose.isNear(lExpected, 1e-6f));
+  EXPECT_FLOAT_EQ(lStep.distance(AL::Math::Pose2D()), std::sqrt(0.05f));
+}
+
+TEST(ALInlineTest, Velocity6D)
+{
+  AL::Math::Velocity6D lVel(1.0f, 2.0f, 2.0f, 0.0f, 4.0f, 0.0f);
+  EXPECT_FLOAT_EQ(lVel.norm(), 5.0f);
+  lVel *= 2.0f;
+  EXPECT_TRUE(lVel == 2.0f*AL::Math::Velocity6D(1.0f, 2.0f, 2.0f,
+                                                 0.0f, 4.0f, 0.0f));
+  EXPECT_TRUE(lVel != AL::Math::Velocity6D());
+}
+
+TEST(ALInlineTest, TransformPosition)
+{
+  const AL::Math::Transform lT =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::Position3D lPos(0.5f, -1.0f, 2.0f);
+  const AL::Math::Position3D lOut = lT * lPos;
+  const AL::Math::Transform lProduct =
+      lT * AL::Math::Transform(lPos.x, lPos.y, lPos.z);
+  const AL::Math::Position3D lExpected(
+        lProduct.r1_c4, lProduct.r2_c4, lProduct.r3_c4);
+  EXPECT_TRUE(lOut.isNear(lExpected, 1e-6f));
+  EXPECT_TRUE(AL::Math::Transform(1.0f, 2.0f, 3.0f) * AL::Math::Position3D() ==
+              AL::Math::Position3D(1.0f, 2.0f, 3.0f));
+  EXPECT_TRUE(AL::Math::Transform() == AL::Math::Transform());
+}
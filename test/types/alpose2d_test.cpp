@@ -4,7 +4,9 @@
  * found in the COPYING file.
  */
 #include <gtest/gtest.h>
+#include <cmath>
 #include <stdexcept>
+#include <vector>
 
 #include <almath/types/alpose2d.h>
 #include <almath/tools/altrigonometry.h>
@@ -323,3 +325,90 @@ TEST(ALPose2DTest, writeToVector)
   EXPECT_FLOAT_EQ(pos.y, vec[4]);
   EXPECT_FLOAT_EQ(pos.theta, vec[5]);
 }
+
+namespace
+{
+  std::vector<AL::Math::Pose2D> makePoses(std::size_t pSize, float pAngleScale)
+  {
+    std::vector<AL::Math::Pose2D> lPoses(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = static_cast<float>(i);
+      lPoses[i] = AL::Math::Pose2D(3.0f*std::sin(0.37f*f), 2.0f - 0.01f*f,
+                                   pAngleScale*(0.731f*f - 0.5f*pSize));
+    }
+    return lPoses;
+  }
+}
+
+TEST(ALPose2DTest, arrays)
+{
+  // angles up to 1e4, beyond the range of the polynomial sine and cosine
+  const float lScales[2] = {0.01f, 30.0f};
+  for (int s = 0; s < 2; ++s)
+  {
+    const std::vector<AL::Math::Pose2D> lPos1 = makePoses(1001u, lScales[s]);
+    std::vector<AL::Math::Pose2D> lPos2 = makePoses(1001u, -0.7f*lScales[s]);
+    const AL::Math::Pose2D lPose(0.3f, -1.2f, 2.5f);
+    const std::size_t lSize = lPos1.size();
+    std::vector<AL::Math::Pose2D> lOut(lSize);
+
+    AL::Math::pose2DMultiply(lPose, lPos1.data(), lOut.data(), lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      EXPECT_TRUE(lOut[i].isNear(lPose*lPos1[i], 1e-5f));
+    }
+    AL::Math::pose2DMultiply(lPos1.data(), lPose, lOut.data(), lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      EXPECT_TRUE(lOut[i].isNear(lPos1[i]*lPose, 1e-5f));
+    }
+    AL::Math::pose2DMultiply(lPos1.data(), lPos2.data(), lOut.data(), lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      EXPECT_TRUE(lOut[i].isNear(lPos1[i]*lPos2[i], 1e-5f));
+    }
+    AL::Math::pose2DInverse(lPos1.data(), lOut.data(), lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      EXPECT_TRUE(lOut[i].isNear(AL::Math::pose2DInverse(lPos1[i]), 1e-5f));
+    }
+    AL::Math::pose2dDiff(lPos1.data(), lPos2.data(), lOut.data(), lSize);
+    for (std::size_t i = 0u; i < lSize; ++i)
+    {
+      EXPECT_TRUE(lOut[i].isNear(AL::Math::pose2dDiff(lPos1[i], lPos2[i]),
+                                 1e-5f));
+    }
+
+    // in place
+    const std::vector<AL::Math::Pose2D> lExpected = lOut;
+    AL::Math::pose2dDiff(lPos1.data(), lPos2.data(), lPos2.data(), lSize);
+    EXPECT_TRUE(lPos2 == lExpected);
+  }
+
+  // the steps of a path
+  const std::vector<AL::Math::Pose2D> lPath = makePoses(11u, 0.1f);
+  std::vector<AL::Math::Pose2D> lSteps(10u);
+  AL::Math::pose2dDiff(lPath.data(), lPath.data() + 1, lSteps.data(), 10u);
+  for (std::size_t i = 0u; i < 10u; ++i)
+  {
+    EXPECT_TRUE((lPath[i]*lSteps[i]).isNear(lPath[i+1u], 1e-5f));
+  }
+}
+
+TEST(ALPose2DTest, arraysThreads)
+{
+  const std::vector<AL::Math::Pose2D> lPos1 = makePoses(70000u, 0.001f);
+  const std::vector<AL::Math::Pose2D> lPos2 = makePoses(70000u, -0.002f);
+  const std::size_t lSize = lPos1.size();
+  std::vector<AL::Math::Pose2D> lExpected(lSize);
+  std::vector<AL::Math::Pose2D> lOut(lSize);
+
+  AL::Math::pose2dDiff(lPos1.data(), lPos2.data(), lExpected.data(), lSize);
+  AL::Math::pose2dDiff(lPos1.data(), lPos2.data(), lOut.data(), lSize, 4u);
+  EXPECT_TRUE(lOut == lExpected);
+
+  AL::Math::pose2DMultiply(lPos1[7], lPos2.data(), lExpected.data(), lSize);
+  AL::Math::pose2DMultiply(lPos1[7], lPos2.data(), lOut.data(), lSize, 0u);
+  EXPECT_TRUE(lOut == lExpected);
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <stdexcept>
 
 
@@ -217,3 +218,29 @@ TEST(ALPosition3DTest, isOrthogonal)
   EXPECT_FALSE(posY.isOrthogonal(posYZ));
   EXPECT_FALSE(posZ.isOrthogonal(posYZ));
 }
+
+TEST(ALPosition3DTest, arrayConversions)
+{
+  const AL::Math::Position3D pos(1.0f, -2.0f, 3.0f);
+
+  const std::array<float, 3> lArray = pos.toArray();
+  EXPECT_EQ(1.0f, lArray[0]);
+  EXPECT_EQ(-2.0f, lArray[1]);
+  EXPECT_EQ(3.0f, lArray[2]);
+  EXPECT_TRUE(AL::Math::Position3D(lArray).isNear(pos, 0.0f));
+
+  float lBuffer[4] = {0.0f, 0.0f, 0.0f, 7.0f};
+  EXPECT_EQ(lBuffer + 3, pos.writeTo(lBuffer));
+  EXPECT_EQ(7.0f, lBuffer[3]);
+  EXPECT_TRUE(AL::Math::Position3D(lBuffer, 3u).isNear(pos, 0.0f));
+  EXPECT_THROW(AL::Math::Position3D(lBuffer, 4u), std::runtime_error);
+
+  AL::Math::Position3D lRead;
+  EXPECT_EQ(lBuffer + 3, lRead.readFrom(lBuffer));
+  EXPECT_TRUE(lRead.isNear(pos, 0.0f));
+
+  // any output iterator
+  std::vector<float> lVector;
+  pos.writeTo(std::back_inserter(lVector));
+  EXPECT_EQ(pos.toVector(), lVector);
+}
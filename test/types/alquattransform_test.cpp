@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/types/alquattransform.h>
+#include <almath/tools/altransformhelpers.h>
+#include <almath/tools/almath.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace
+{
+  const AL::Math::Transform kT1 =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::Transform kT2 =
+      AL::Math::Transform::fromPosition(-0.5f, 0.0f, 0.7f, -1.2f, 0.6f, 0.2f);
+}
+
+TEST(ALQuatTransformTest, conversions)
+{
+  const AL::Math::QuatTransform lQT1 =
+      AL::Math::quatTransformFromTransform(kT1);
+  EXPECT_NEAR(1.0f, AL::Math::norm(lQT1.rotation), 1e-6f);
+  EXPECT_TRUE(AL::Math::transformFromQuatTransform(lQT1).isNear(kT1, 1e-6f));
+
+  const AL::Math::Position6D lPos(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::QuatTransform lFromPos =
+      AL::Math::quatTransformFromPosition6D(lPos);
+  EXPECT_TRUE(lFromPos.isNear(lQT1, 1e-6f));
+  EXPECT_TRUE(AL::Math::position6DFromQuatTransform(lFromPos).isNear(
+                lPos, 1e-5f));
+
+  // Displacement holds the same data
+  const AL::Math::Displacement lDisp =
+      AL::Math::displacementFromQuatTransform(lQT1);
+  EXPECT_TRUE(lDisp.Q == lQT1.rotation);
+  EXPECT_TRUE(lDisp.P == lQT1.translation);
+  const AL::Math::QuatTransform lBack =
+      AL::Math::quatTransformFromDisplacement(lDisp);
+  EXPECT_TRUE(lBack.rotation == lQT1.rotation);
+  EXPECT_TRUE(lBack.translation == lQT1.translation);
+}
+
+TEST(ALQuatTransformTest, composition)
+{
+  const AL::Math::QuatTransform lQT1 =
+      AL::Math::quatTransformFromTransform(kT1);
+  const AL::Math::QuatTransform lQT2 =
+      AL::Math::quatTransformFromTransform(kT2);
+
+  EXPECT_TRUE(AL::Math::transformFromQuatTransform(lQT1 * lQT2).isNear(
+                kT1 * kT2, 1e-5f));
+
+  // same result as Displacement, which holds the same data
+  const AL::Math::Displacement lDisp =
+      AL::Math::displacementFromQuatTransform(lQT1) *
+      AL::Math::displacementFromQuatTransform(lQT2);
+  EXPECT_TRUE((lQT1 * lQT2).isNear(
+                AL::Math::quatTransformFromDisplacement(lDisp), 1e-5f));
+
+  // aliasing
+  AL::Math::QuatTransform lQT = lQT1;
+  lQT *= lQT;
+  EXPECT_TRUE(lQT.isNear(lQT1 * lQT1, 1e-6f));
+
+  // points
+  const AL::Math::Position3D lPos(0.5f, -1.0f, 2.0f);
+  EXPECT_TRUE((lQT1 * lPos).isNear(kT1 * lPos, 1e-5f));
+  EXPECT_TRUE(AL::Math::quatTransformRotate(lQT1, lPos).isNear(
+                lQT1.rotation * lPos, 1e-5f));
+}
+
+TEST(ALQuatTransformTest, inverse)
+{
+  const AL::Math::QuatTransform lQT1 =
+      AL::Math::quatTransformFromTransform(kT1);
+  EXPECT_TRUE(AL::Math::transformFromQuatTransform(lQT1.inverse()).isNear(
+                kT1.inverse(), 1e-5f));
+  EXPECT_TRUE((lQT1 * lQT1.inverse()).isNear(AL::Math::QuatTransform(),
+                                             1e-6f));
+  AL::Math::QuatTransform lQT = lQT1;
+  AL::Math::quatTransformInverse(lQT, lQT);
+  EXPECT_TRUE(lQT.rotation == lQT1.inverse().rotation);
+  EXPECT_TRUE(lQT.translation == lQT1.inverse().translation);
+}
+
+TEST(ALQuatTransformTest, normalize)
+{
+  const AL::Math::QuatTransform lQT1 =
+      AL::Math::quatTransformFromTransform(kT1);
+  const AL::Math::QuatTransform lQT2 =
+      AL::Math::quatTransformFromTransform(kT2);
+
+  // a long chain, normalized from time to time
+  AL::Math::QuatTransform lChain;
+  for (int i = 0; i < 1000; ++i)
+  {
+    lChain *= (i % 2 == 0) ? lQT1 : lQT2;
+    if (i % 100 == 99)
+    {
+      lChain.normalizeQuatTransform();
+      EXPECT_NEAR(1.0f, AL::Math::norm(lChain.rotation), 1e-6f);
+    }
+  }
+
+  AL::Math::QuatTransform lScaled(lQT1.rotation * 2.0f, lQT1.translation);
+  AL::Math::normalizeQuatTransform(lScaled);
+  EXPECT_TRUE(lScaled.isNear(lQT1, 1e-6f));
+  EXPECT_TRUE(lScaled.translation == lQT1.translation);
+
+  AL::Math::QuatTransform lNull(AL::Math::Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+  EXPECT_THROW(AL::Math::normalizeQuatTransform(lNull), std::runtime_error);
+}
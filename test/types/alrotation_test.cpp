@@ -9,6 +9,7 @@
 #include <almath/tools/altrigonometry.h>
 
 #include <almath/tools/almathio.h>
+#include <stdexcept>
 
 TEST(ALRotationTest, basicOperator)
 {
@@ -311,3 +312,21 @@ TEST(ALRotationTest, toVector)
   EXPECT_NEAR(rot.r3_c2, vec[7], eps);
   EXPECT_NEAR(rot.r3_c3, vec[8], eps);
 }
+
+TEST(ALRotationTest, arrayConversions)
+{
+  const AL::Math::Rotation rot = AL::Math::Rotation::fromAngleDirection(
+        0.5f, 0.0f, 0.6f, 0.8f);
+  const std::array<float, 9> lArray = rot.toArray();
+  EXPECT_EQ(rot.toVector(), std::vector<float>(lArray.begin(), lArray.end()));
+  EXPECT_TRUE(AL::Math::Rotation(lArray).isNear(rot, 0.0f));
+  EXPECT_TRUE(AL::Math::Rotation(lArray.data(), 9u).isNear(rot, 0.0f));
+
+  // the rotation part of a transform
+  const float lTransform[12] = {
+    lArray[0], lArray[1], lArray[2], 10.0f,
+    lArray[3], lArray[4], lArray[5], 20.0f,
+    lArray[6], lArray[7], lArray[8], 30.0f};
+  EXPECT_TRUE(AL::Math::Rotation(lTransform, 12u).isNear(rot, 0.0f));
+  EXPECT_THROW(AL::Math::Rotation(lTransform, 10u), std::runtime_error);
+}
@@ -12,6 +12,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <stdexcept>
 
 TEST(TransformTest, constructor)
 {
@@ -781,3 +782,115 @@ TEST(ALTransformTest, transformToFloatVector)
   EXPECT_NEAR(tf.r3_c3, vec[10], eps);
   EXPECT_NEAR(tf.r3_c4, vec[11], eps);
 }
+
+TEST(ALTransformTest, inverseRigid)
+{
+  const AL::Math::Transform lT1 =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::Transform lT2 =
+      AL::Math::Transform::fromPosition(-0.5f, 0.0f, 0.7f, -1.2f, 0.6f, 0.2f);
+
+  EXPECT_TRUE(lT1.inverseRigid() == lT1.inverse());
+  EXPECT_TRUE(AL::Math::transformInverseRigid(lT1) ==
+              AL::Math::transformInverse(lT1));
+
+  EXPECT_TRUE(AL::Math::transformInverseRigidMultiply(lT1, lT2).isNear(
+                AL::Math::transformDiff(lT1, lT2), 1e-6f));
+  AL::Math::Transform lT3 = lT2;
+  AL::Math::transformInverseRigidMultiply(lT1, lT3, lT3);
+  EXPECT_TRUE(lT3 == AL::Math::transformInverseRigidMultiply(lT1, lT2));
+  lT3 = lT1;
+  AL::Math::transformInverseRigidMultiply(lT3, lT2, lT3);
+  EXPECT_TRUE(lT3 == AL::Math::transformInverseRigidMultiply(lT1, lT2));
+}
+
+TEST(ALTransformTest, inverseRigidArray)
+{
+  std::vector<AL::Math::Transform> lIn;
+  for (int i = 0; i < 7; ++i)
+  {
+    const float f = 0.3f*static_cast<float>(i);
+    lIn.push_back(AL::Math::Transform::fromPosition(f, -f, 0.5f,
+                                                     f, 0.2f, -f));
+  }
+  std::vector<AL::Math::Transform> lOut(lIn.size());
+  AL::Math::transformInverseRigid(lIn.data(), lOut.data(), lIn.size());
+  for (std::size_t i = 0u; i < lIn.size(); ++i)
+  {
+    EXPECT_TRUE(lOut[i] == lIn[i].inverse());
+  }
+  std::vector<AL::Math::Transform> lInPlace(lIn);
+  AL::Math::transformInverseRigid(lInPlace.data(), lInPlace.data(),
+                                  lInPlace.size());
+  EXPECT_TRUE(lInPlace == lOut);
+
+  AL::Math::transformInverseRigidMultiply(lIn[2], lIn.data(), lOut.data(),
+                                          lIn.size());
+  for (std::size_t i = 0u; i < lIn.size(); ++i)
+  {
+    EXPECT_TRUE(lOut[i] ==
+                AL::Math::transformInverseRigidMultiply(lIn[2], lIn[i]));
+  }
+  // the left hand side is an element of the output
+  lInPlace = lIn;
+  AL::Math::transformInverseRigidMultiply(lInPlace[2], lIn.data(),
+                                          lInPlace.data(), lIn.size());
+  EXPECT_TRUE(lInPlace == lOut);
+}
+
+namespace
+{
+  int gRigidChecks = 0;
+  void countRigidChecks(const AL::Math::Transform&, const char*)
+  {
+    ++gRigidChecks;
+  }
+}
+
+TEST(ALTransformTest, rigidTransformCheck)
+{
+  AL::Math::Transform lScaled;
+  lScaled.r1_c1 = 2.0f;
+
+  const AL::Math::RigidTransformCheck lDefault =
+      AL::Math::setRigidTransformCheck(&countRigidChecks);
+  gRigidChecks = 0;
+  AL::Math::transformInverseRigid(lScaled);
+  AL::Math::transformInverseRigidMultiply(lScaled, lScaled);
+  EXPECT_EQ(AL::Math::setRigidTransformCheck(lDefault), &countRigidChecks);
+#ifdef NDEBUG
+  EXPECT_EQ(0, gRigidChecks);
+#else
+  EXPECT_EQ(2, gRigidChecks);
+  EXPECT_THROW(lScaled.inverseRigid(), std::runtime_error);
+  EXPECT_NO_THROW(AL::Math::Transform::fromRotX(0.3f).inverseRigid());
+#endif
+}
+
+TEST(ALTransformTest, arrayConversions)
+{
+  const AL::Math::Transform lT = AL::Math::Transform::fromRotY(0.3f) *
+      AL::Math::Transform(0.1f, -0.2f, 0.3f);
+
+  const std::array<float, 16> lArray = lT.toArray();
+  EXPECT_EQ(lT.toVector(), std::vector<float>(lArray.begin(), lArray.end()));
+  EXPECT_TRUE(AL::Math::Transform(lArray).isNear(lT, 0.0f));
+  EXPECT_TRUE(AL::Math::Transform(lArray.data(), 16u).isNear(lT, 0.0f));
+  EXPECT_TRUE(AL::Math::Transform(lArray.data(), 12u).isNear(lT, 0.0f));
+  EXPECT_THROW(AL::Math::Transform(lArray.data(), 9u), std::runtime_error);
+
+  // readFrom reads the 3x4 part and does not normalize
+  float lBuffer[16];
+  EXPECT_EQ(lBuffer + 16, lT.writeTo(lBuffer));
+  lBuffer[0] = 2.0f;
+  AL::Math::Transform lRead;
+  EXPECT_EQ(lBuffer + 12, lRead.readFrom(lBuffer));
+  EXPECT_EQ(2.0f, lRead.r1_c1);
+  EXPECT_EQ(lT.r3_c4, lRead.r3_c4);
+
+  // the constructors normalize the rotation part, as the std::vector one
+  const AL::Math::Transform lNormalized(lBuffer, 16u);
+  EXPECT_TRUE(lNormalized.isTransform());
+  EXPECT_TRUE(lNormalized.isNear(AL::Math::Transform(
+      std::vector<float>(lBuffer, lBuffer + 16)), 0.0f));
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+
+#include <almath/types/altransformbatch.h>
+#include <almath/tools/almathio.h>
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace
+{
+  std::vector<AL::Math::Transform> makeTransforms(std::size_t pSize,
+                                                  float pOffset)
+  {
+    std::vector<AL::Math::Transform> lTransforms;
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = static_cast<float>(i) + pOffset;
+      lTransforms.push_back(AL::Math::Transform::fromPosition(
+                              0.1f*f, -0.2f*f, 0.3f,
+                              0.05f*f, -0.03f*f, 0.07f*f));
+    }
+    return lTransforms;
+  }
+}
+
+TEST(ALTransformBatchTest, constructor)
+{
+  AL::Math::TransformBatch pBatch;
+  EXPECT_TRUE(pBatch.empty());
+  EXPECT_EQ(0u, pBatch.size());
+
+  pBatch = AL::Math::TransformBatch(3u);
+  EXPECT_EQ(3u, pBatch.size());
+  EXPECT_EQ(0u, pBatch.stride() % AL::Math::TransformBatch::LANES);
+  for (std::size_t i = 0u; i < pBatch.size(); ++i)
+  {
+    EXPECT_TRUE(pBatch.get(i) == AL::Math::Transform());
+  }
+
+  const std::vector<AL::Math::Transform> pTransforms = makeTransforms(11u, 0.0f);
+  pBatch = AL::Math::TransformBatch(pTransforms);
+  EXPECT_EQ(pTransforms.size(), pBatch.size());
+  for (std::size_t i = 0u; i < pBatch.size(); ++i)
+  {
+    EXPECT_TRUE(pBatch.get(i) == pTransforms[i]);
+  }
+  EXPECT_FLOAT_EQ(pTransforms[5].r2_c4,
+      pBatch.data(AL::Math::TransformBatch::R2_C4)[5]);
+}
+
+TEST(ALTransformBatchTest, conversions)
+{
+  const std::vector<AL::Math::Transform> pTransforms = makeTransforms(13u, 1.0f);
+  AL::Math::TransformBatch pBatch;
+  pBatch.assign(pTransforms);
+  EXPECT_TRUE(pBatch.toVector() == pTransforms);
+
+  std::vector<AL::Math::Transform> pOut(2u);
+  pBatch.toVector(pOut);
+  EXPECT_TRUE(pOut == pTransforms);
+
+  // shrinking keeps the first elements, growing appends identities
+  pBatch.resize(4u);
+  EXPECT_EQ(4u, pBatch.size());
+  EXPECT_TRUE(pBatch.get(3u) == pTransforms[3u]);
+  pBatch.resize(20u);
+  EXPECT_TRUE(pBatch.get(3u) == pTransforms[3u]);
+  EXPECT_TRUE(pBatch.get(4u) == AL::Math::Transform());
+  EXPECT_TRUE(pBatch.get(19u) == AL::Math::Transform());
+
+  pBatch.set(19u, pTransforms[0]);
+  EXPECT_TRUE(pBatch.get(19u) == pTransforms[0]);
+}
+
+TEST(ALTransformBatchTest, multiply)
+{
+  const std::vector<AL::Math::Transform> pIn1 = makeTransforms(19u, 0.0f);
+  const std::vector<AL::Math::Transform> pIn2 = makeTransforms(19u, 5.0f);
+  AL::Math::TransformBatch pBatch1(pIn1);
+  AL::Math::TransformBatch pBatch2(pIn2);
+  AL::Math::TransformBatch pBatchOut;
+
+  AL::Math::transformMultiply(pBatch1, pBatch2, pBatchOut);
+  ASSERT_EQ(pIn1.size(), pBatchOut.size());
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    EXPECT_TRUE(pBatchOut.get(i).isNear(pIn1[i] * pIn2[i], 1e-6f));
+  }
+
+  AL::Math::transformMultiply(pIn1[3], pBatch2, pBatchOut);
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    EXPECT_TRUE(pBatchOut.get(i).isNear(pIn1[3] * pIn2[i], 1e-6f));
+  }
+
+  AL::Math::transformMultiply(pBatch1, pIn2[3], pBatchOut);
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    EXPECT_TRUE(pBatchOut.get(i).isNear(pIn1[i] * pIn2[3], 1e-6f));
+  }
+
+  // in place
+  AL::Math::transformMultiply(pBatch1, pBatch2, pBatch1);
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    EXPECT_TRUE(pBatch1.get(i).isNear(pIn1[i] * pIn2[i], 1e-6f));
+  }
+
+  pBatch2.resize(3u);
+  EXPECT_THROW(AL::Math::transformMultiply(pBatch1, pBatch2, pBatchOut),
+               std::runtime_error);
+}
+
+TEST(ALTransformBatchTest, preMultiply)
+{
+  const std::vector<AL::Math::Transform> pIn1 = makeTransforms(9u, 0.0f);
+  const std::vector<AL::Math::Transform> pIn2 = makeTransforms(9u, 2.0f);
+  AL::Math::TransformBatch pBatch1(pIn1);
+  AL::Math::TransformBatch pBatchOut(pIn2);
+
+  AL::Math::transformPreMultiply(pBatch1, pBatchOut);
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    AL::Math::Transform pExpected = pIn2[i];
+    AL::Math::transformPreMultiply(pIn1[i], pExpected);
+    EXPECT_TRUE(pBatchOut.get(i).isNear(pExpected, 1e-6f));
+  }
+
+  pBatchOut.assign(pIn2);
+  AL::Math::transformPreMultiply(pIn1[1], pBatchOut);
+  for (std::size_t i = 0u; i < pIn1.size(); ++i)
+  {
+    AL::Math::Transform pExpected = pIn2[i];
+    AL::Math::transformPreMultiply(pIn1[1], pExpected);
+    EXPECT_TRUE(pBatchOut.get(i).isNear(pExpected, 1e-6f));
+  }
+
+  pBatchOut.resize(2u);
+  EXPECT_THROW(AL::Math::transformPreMultiply(pBatch1, pBatchOut),
+               std::runtime_error);
+}
+
+TEST(ALTransformBatchTest, inverse)
+{
+  const std::vector<AL::Math::Transform> pIn = makeTransforms(17u, 0.5f);
+  AL::Math::TransformBatch pBatch(pIn);
+  AL::Math::TransformBatch pBatchOut;
+
+  AL::Math::transformInverse(pBatch, pBatchOut);
+  for (std::size_t i = 0u; i < pIn.size(); ++i)
+  {
+    EXPECT_TRUE(pBatchOut.get(i).isNear(
+                  AL::Math::transformInverse(pIn[i]), 1e-6f));
+  }
+
+  AL::Math::transformInverse(pBatch, pBatch);
+  for (std::size_t i = 0u; i < pIn.size(); ++i)
+  {
+    EXPECT_TRUE(pBatch.get(i).isNear(
+                  AL::Math::transformInverse(pIn[i]), 1e-6f));
+  }
+
+  AL::Math::TransformBatch pEmpty;
+  AL::Math::transformInverse(pEmpty, pBatchOut);
+  EXPECT_TRUE(pBatchOut.empty());
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/types/altransformexpression.h>
+#include <almath/tools/almath.h>
+#include <almath/tools/altransformhelpers.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+  // the frames of a serial chain
+  std::vector<AL::Math::Transform> makeChain(std::size_t pSize)
+  {
+    std::vector<AL::Math::Transform> lChain(pSize);
+    for (std::size_t i = 0u; i < pSize; ++i)
+    {
+      const float f = 0.1f * static_cast<float>(i);
+      lChain[i] = AL::Math::Transform::fromPosition(0.05f, -f, 0.1f,
+                                                    f, 0.3f - f, 0.2f + f);
+    }
+    return lChain;
+  }
+}
+
+TEST(ALTransformExpressionTest, transformChain)
+{
+  const std::vector<AL::Math::Transform> lT = makeChain(4u);
+  const AL::Math::Transform lEager = lT[0] * lT[1] * lT[2] * lT[3];
+
+  const AL::Math::Transform lLazy =
+      AL::Math::lazy(lT[0]) * lT[1] * lT[2] * lT[3];
+  EXPECT_TRUE(lLazy.isNear(lEager, 1e-6f));
+  EXPECT_TRUE((AL::Math::lazy(lT[0]) * lT[1]).eval().isNear(lT[0] * lT[1],
+                                                            1e-6f));
+  EXPECT_TRUE(AL::Math::Transform(AL::Math::lazy(lT[2])) == lT[2]);
+
+  // grouping
+  const AL::Math::Transform lGrouped =
+      (AL::Math::lazy(lT[0]) * lT[1]) * (AL::Math::lazy(lT[2]) * lT[3]);
+  EXPECT_TRUE(lGrouped.isNear(lEager, 1e-6f));
+  const AL::Math::Transform lRight = lT[0] * (AL::Math::lazy(lT[1]) * lT[2]);
+  EXPECT_TRUE(lRight.isNear(lT[0] * lT[1] * lT[2], 1e-6f));
+
+  // implicit conversions to Transform
+  AL::Math::Transform lAcc = lT[0];
+  lAcc *= AL::Math::lazy(lT[1]) * lT[2] * lT[3];
+  EXPECT_TRUE(lAcc.isNear(lEager, 1e-6f));
+  EXPECT_TRUE(AL::Math::transformInverse(AL::Math::lazy(lT[0]) * lT[1]).isNear(
+                (lT[0] * lT[1]).inverse(), 1e-5f));
+
+  // the result may be assigned to one of the operands
+  AL::Math::Transform lInPlace = lT[0];
+  lInPlace = AL::Math::lazy(lInPlace) * lT[1] * lInPlace;
+  EXPECT_TRUE(lInPlace.isNear(lT[0] * lT[1] * lT[0], 1e-6f));
+}
+
+TEST(ALTransformExpressionTest, rotations)
+{
+  const std::vector<AL::Math::Transform> lT = makeChain(2u);
+  const AL::Math::Rotation lR1 =
+      AL::Math::Rotation::fromAngleDirection(0.4f, 0.0f, 0.6f, 0.8f);
+  const AL::Math::Rotation lR2 = AL::Math::Rotation::fromRotX(-1.2f);
+  const AL::Math::Transform lTR1 = AL::Math::transformFromRotation(lR1);
+  const AL::Math::Transform lTR2 = AL::Math::transformFromRotation(lR2);
+
+  EXPECT_TRUE((AL::Math::lazy(lT[0]) * lR1 * lT[1]).eval().isNear(
+                lT[0] * lTR1 * lT[1], 1e-6f));
+  EXPECT_TRUE((AL::Math::lazy(lR1) * lT[0] * lR2).eval().isNear(
+                lTR1 * lT[0] * lTR2, 1e-6f));
+  EXPECT_TRUE((lR2 * (AL::Math::lazy(lT[1]) * lR1)).eval().isNear(
+                lTR2 * lT[1] * lTR1, 1e-6f));
+  EXPECT_TRUE((AL::Math::lazy(lR1) * lR2).eval().isNear(lTR1 * lTR2, 1e-6f));
+  EXPECT_TRUE(AL::Math::lazy(lR1).eval().isNear(lTR1, 0.0f));
+}
+
+TEST(ALTransformExpressionTest, position)
+{
+  const std::vector<AL::Math::Transform> lT = makeChain(8u);
+  const AL::Math::Rotation lR = AL::Math::Rotation::fromRotY(0.9f);
+  const AL::Math::Position3D lPos(0.5f, -1.0f, 2.0f);
+
+  AL::Math::Transform lEager = lT[0];
+  for (std::size_t i = 1u; i < lT.size(); ++i)
+  {
+    lEager *= lT[i];
+  }
+  const AL::Math::Position3D lLazy = AL::Math::lazy(lT[0]) * lT[1] * lT[2] *
+      lT[3] * lT[4] * lT[5] * lT[6] * lT[7] * lPos;
+  EXPECT_TRUE(lLazy.isNear(lEager * lPos, 1e-5f));
+
+  EXPECT_TRUE((AL::Math::lazy(lT[0]) * lR * lT[1] * lPos).isNear(
+                lT[0] * (lR * (lT[1] * lPos)), 1e-6f));
+  EXPECT_TRUE((AL::Math::lazy(lR) * lPos).isNear(lR * lPos, 0.0f));
+  EXPECT_TRUE((AL::Math::lazy(lT[3]) * lPos).isNear(lT[3] * lPos, 0.0f));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Aldebaran Robotics. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the COPYING file.
+ */
+#include <almath/types/altransformt.h>
+#include <almath/types/alvelocity6dt.h>
+#include <almath/tools/almath.h>
+#include <almath/tools/altransformhelpers.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(ALTransformTTest, LayoutCompatible)
+{
+  EXPECT_EQ(sizeof(AL::Math::Transform),
+            sizeof(AL::Math::TransformT<float>));
+  EXPECT_EQ(sizeof(AL::Math::Rotation), sizeof(AL::Math::RotationT<float>));
+  EXPECT_EQ(sizeof(AL::Math::Quaternion),
+            sizeof(AL::Math::QuaternionT<float>));
+  EXPECT_EQ(sizeof(AL::Math::Position3D),
+            sizeof(AL::Math::Position3DT<float>));
+  EXPECT_EQ(sizeof(AL::Math::Velocity6D),
+            sizeof(AL::Math::Velocity6DT<float>));
+  EXPECT_EQ(12u*sizeof(double), sizeof(AL::Math::Transformd));
+}
+
+TEST(ALTransformTTest, MatchesFloatTypes)
+{
+  const AL::Math::Transform lT1 =
+      AL::Math::Transform::fromPosition(0.1f, 0.2f, 0.3f, 0.4f, -0.3f, 1.1f);
+  const AL::Math::Transform lT2 =
+      AL::Math::Transform::fromPosition(-0.5f, 0.0f, 0.7f, -1.2f, 0.6f, 0.2f);
+  const AL::Math::Transformd lT1d(lT1);
+  const AL::Math::Transformd lT2d(lT2);
+
+  EXPECT_TRUE((lT1d*lT2d).toTransform().isNear(lT1*lT2, 1e-6f));
+  EXPECT_TRUE(lT1d.inverse().toTransform().isNear(lT1.inverse(), 1e-6f));
+  EXPECT_NEAR(lT1d.determinant(), 1.0, 1e-6);
+  const AL::Math::Transformd lRigid =
+      AL::Math::Transformd(0.1, 0.2, 0.3)*AL::Math::Transformd::fromRotY(0.7);
+  EXPECT_TRUE((lRigid*lRigid.inverse()).isNear(AL::Math::Transformd(), 1e-15));
+
+  const AL::Math::Position3D lPos(0.5f, -1.0f, 2.0f);
+  const AL::Math::Position3Dd lPosd(lPos);
+  EXPECT_TRUE((lT1d*lPosd).toPosition3D().isNear(lT1*lPos, 1e-6f));
+
+  const AL::Math::Rotationd lRotd(AL::Math::rotationFromTransform(lT1));
+  EXPECT_TRUE((lRotd*lPosd).toPosition3D().isNear(
+                AL::Math::rotationFromTransform(lT1)*lPos, 1e-6f));
+
+  EXPECT_TRUE(AL::Math::Transformd::fromRotY(0.3).toTransform().isNear(
+                AL::Math::Transform::fromRotY(0.3f), 1e-6f));
+  EXPECT_TRUE(AL::Math::Rotationd::fromRotZ(-1.3).toRotation().isNear(
+                AL::Math::Rotation::fromRotZ(-1.3f), 1e-6f));
+}
+
+TEST(ALTransformTTest, Quaternion)
+{
+  const AL::Math::Quaterniond lQua =
+      AL::Math::Quaterniond::fromAngleAndAxisRotation(0.7, 0.0, 0.6, 0.8);
+  const AL::Math::Quaternion lQuaf =
+      AL::Math::Quaternion::fromAngleAndAxisRotation(0.7f, 0.0f, 0.6f, 0.8f);
+  EXPECT_TRUE(lQua.toQuaternion().isNear(lQuaf, 1e-6f));
+  EXPECT_TRUE((lQua*lQua.inverse()).isNear(AL::Math::Quaterniond(), 1e-12));
+  EXPECT_TRUE(AL::Math::Rotationd::fromQuaternion(lQua).toRotation().isNear(
+                AL::Math::Rotation::fromQuaternion(lQuaf.w, lQuaf.x,
+                                                   lQuaf.y, lQuaf.z), 1e-6f));
+  EXPECT_THROW(AL::Math::Quaterniond(0.0, 0.0, 0.0, 0.0).normalize(),
+               std::runtime_error);
+}
+
+TEST(ALTransformTTest, Conversions)
+{
+  const AL::Math::Position3Dd lPos(1.0 + 1e-12, 2.0, 3.0);
+  const AL::Math::Position3DT<float> lPosf(lPos);
+  EXPECT_EQ(1.0f, lPosf.x);
+  EXPECT_TRUE(AL::Math::Position3Dd(lPosf) != lPos);
+  EXPECT_TRUE(AL::Math::Position3Dd(lPosf).isNear(lPos, 1e-9));
+
+  const AL::Math::Velocity6Dd lVel(1.0, 2.0, 2.0, 0.0, 4.0, 0.0);
+  EXPECT_DOUBLE_EQ(5.0, lVel.norm());
+  EXPECT_TRUE((2.0*lVel).toVelocity6D() ==
+              AL::Math::Velocity6D(2.0f, 4.0f, 4.0f, 0.0f, 8.0f, 0.0f));
+  EXPECT_THROW(lVel/0.0, std::runtime_error);
+}
@@ -137,3 +137,20 @@ TEST(ALVelocity6DTest, writeToVector)
   EXPECT_FLOAT_EQ(vel.wzd, vec[5]);
   EXPECT_EQ(6, it - vec.begin());
 }
+
+TEST(ALVelocity6DTest, arrayConversions)
+{
+  const AL::Math::Velocity6D vel(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f);
+  const std::array<float, 6> lArray = vel.toArray();
+  EXPECT_EQ(vel.toVector(), std::vector<float>(lArray.begin(), lArray.end()));
+  EXPECT_TRUE(AL::Math::Velocity6D(lArray).isNear(vel, 0.0f));
+  EXPECT_TRUE(AL::Math::Velocity6D(lArray.data(), 6u).isNear(vel, 0.0f));
+  EXPECT_THROW(AL::Math::Velocity6D(lArray.data(), 3u), std::runtime_error);
+
+  // writeToVector keeps its behavior
+  std::vector<float> lVector(7, 0.0f);
+  std::vector<float>::iterator lIt = lVector.begin() + 1;
+  vel.writeToVector(lIt);
+  EXPECT_EQ(lVector.end(), lIt);
+  EXPECT_EQ(6.0f, lVector[6]);
+}